@@ -10,9 +10,9 @@
 
 #include "Qos_Helper.h"
 #include "Definitions.h"
+#include "PartitionMatcher.h"
 #include "SafetyProfileStreams.h"
 
-#include <ace/ACE.h> /* For ACE::wild_match() */
 #include <ace/OS_NS_string.h>
 
 #if OPENDDS_CONFIG_SECURITY
@@ -114,80 +114,11 @@ is_wildcard(const char *str)
   return false;
 }
 
-class PartitionName {
-public:
-  PartitionName(const char* name)
-    : name_(name),
-      wildcard_(is_wildcard(name)) {}
-
-  bool matches(const PartitionName& n) {
-    if (wildcard_ && n.wildcard_)
-      return false; // wildcards never match
-
-    if (wildcard_)
-      return ACE::wild_match(n.name_, name_, true, true);
-
-    else if (n.wildcard_)
-      return ACE::wild_match(name_, n.name_, true, true);
-
-    else
-      return ACE_OS::strcmp(name_, n.name_) == 0;
-  }
-
-private:
-  const char* name_;
-  bool wildcard_;
-};
-
-bool
-matches_name(const DDS::PartitionQosPolicy& qos, const PartitionName& name)
-{
-  for (CORBA::ULong i = 0; i < qos.name.length(); ++i) {
-    PartitionName qos_name(qos.name[i]);
-
-    if (qos_name.matches(name))
-      return true;
-  }
-
-  return false;
-}
-
-bool
-matches_default(const DDS::PartitionQosPolicy& qos)
-{
-  if (qos.name.length() == 0)
-    return true; // default
-
-  for (CORBA::ULong i = 0; i < qos.name.length(); ++i) {
-    if (*qos.name[i] == 0)
-      return true; // default (empty string)
-  }
-
-  return false;
-}
-
 bool
 matching_partitions(const DDS::PartitionQosPolicy& pub,
                     const DDS::PartitionQosPolicy& sub)
 {
-  if (matches_default(pub)) {
-    if (matches_default(sub))
-      return true;
-
-    // Zero-length sequences should be treated the same as a
-    // sequence of length 1 that contains an empty string:
-    if (pub.name.length() == 0)
-      return matches_name(sub, "");
-  }
-
-  for (CORBA::ULong i = 0; i < pub.name.length(); ++i) {
-    const char* name = pub.name[i];
-
-    if (matches_name(sub, name))
-      return true;
-  }
-
-  return false;
+  return PartitionMatcher::instance()->matches(pub, sub);
 }
 
 void
@@ -38,6 +38,13 @@ void
 increment_incompatibility_count(OpenDDS::DCPS::IncompatibleQosStatus* status,
                                 DDS::QosPolicyId_t incompatible_policy);
 
+/// True if the two transport locator sequences have a transport type in
+/// common.
+OpenDDS_Dcps_Export
+bool
+compatibleTransports(const OpenDDS::DCPS::TransportLocatorSeq& s1,
+                     const OpenDDS::DCPS::TransportLocatorSeq& s2);
+
 /// Compares whether a publication and subscription are compatible
 /// by comparing their constituent parts.
 OpenDDS_Dcps_Export
@@ -45,6 +45,7 @@
 #include <ace/Reactor.h>
 #include <ace/OS_NS_sys_time.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <stdexcept>
 #ifndef OPENDDS_NO_OBJECT_MODEL_PROFILE
@@ -61,7 +62,8 @@ namespace OpenDDS {
 namespace DCPS {
 
 DataReaderImpl::DataReaderImpl()
-  : qos_(TheServiceParticipant->initial_DataReaderQos())
+  : sample_counts_(make_rch<ReceivedSampleCounts>())
+  , qos_(TheServiceParticipant->initial_DataReaderQos())
   , reverse_sample_lock_(sample_lock_)
   , topic_servant_(0)
   , type_support_(0)
@@ -286,7 +288,7 @@ DataReaderImpl::add_association(const WriterAssociation& writer,
     }
 
     {
-      ACE_Guard<ACE_Recursive_Thread_Mutex> guard(statistics_lock_);
+      ACE_Write_Guard<ACE_RW_Thread_Mutex> guard(statistics_lock_);
       statistics_.insert(
         StatsMapType::value_type(
           writer_id,
@@ -486,7 +488,7 @@ DataReaderImpl::remove_associations(const WriterIdSeq& writers,
       for (CORBA::ULong i = 0; i < wr_len; i++) {
         const GUID_t writer_id = writers[i];
         {
-          ACE_Guard<ACE_Recursive_Thread_Mutex> guard(statistics_lock_);
+          ACE_Write_Guard<ACE_RW_Thread_Mutex> guard(statistics_lock_);
           statistics_.erase(writer_id);
         }
       }
@@ -1779,20 +1781,7 @@ void DataReaderImpl::sample_info(DDS::SampleInfo & sample_info,
 
 CORBA::Long DataReaderImpl::total_samples() const
 {
-  //!!!caller should have acquired sample_lock_
-  ACE_GUARD_RETURN(ACE_Recursive_Thread_Mutex, instance_guard, this->instances_lock_,0);
-
-  CORBA::Long count(0);
-
-  for (SubscriptionInstanceMapType::iterator iter = instances_.begin();
-      iter != instances_.end();
-      ++iter) {
-    SubscriptionInstance_rch ptr = iter->second;
-
-    count += static_cast<CORBA::Long>(ptr->rcvd_samples_.size());
-  }
-
-  return count;
+  return static_cast<CORBA::Long>(sample_counts_->total);
 }
 
 void
@@ -1978,42 +1967,75 @@ DataReaderImpl::state_updated(DDS::InstanceHandle_t handle)
 
 OpenDDS::DCPS::WriterStats::WriterStats(
     int amount,
-    DataCollector<double>::OnFull type) : stats_(amount, type)
+    DataCollector<double>::OnFull type)
+  : histogram_(new Histogram(Histogram::DEFAULT_SUB_BUCKET_BITS, LATENCY_VALUE_BITS), keep_count())
 {
+  if (amount > 0 || type == DataCollector<double>::Unbounded) {
+    raw_ = make_rch<RawData>(amount, type);
+  }
 }
 
 void OpenDDS::DCPS::WriterStats::add_stat(const TimeDuration& delay)
 {
-  double datum = static_cast<double>(delay.value().sec());
-  datum += delay.value().usec() / 1000000.0;
-  this->stats_.add(datum);
+  const ACE_Time_Value& value = delay.value();
+  const ACE_INT64 usec = static_cast<ACE_INT64>(value.sec()) * 1000000 + value.usec();
+  // Clock skew between hosts can make the latency negative.
+  histogram_->record(usec > 0 ? static_cast<ACE_UINT64>(usec) : 0);
+
+  if (raw_) {
+    double datum = static_cast<double>(value.sec());
+    datum += value.usec() / 1000000.0;
+    ACE_Guard<ACE_Thread_Mutex> guard(raw_->lock_);
+    raw_->stats_.add(datum);
+  }
 }
 
 OpenDDS::DCPS::LatencyStatistics OpenDDS::DCPS::WriterStats::get_stats() const
 {
+  HistogramSnapshot snapshot;
+  histogram_->snapshot(snapshot);
+
+  static const double usec_per_sec = 1000000.0;
   LatencyStatistics value;
 
-  value.publication = GUID_UNKNOWN;
-  value.n           = this->stats_.n();
-  value.maximum     = this->stats_.maximum();
-  value.minimum     = this->stats_.minimum();
-  value.mean        = this->stats_.mean();
-  value.variance    = this->stats_.var();
+  value.publication     = GUID_UNKNOWN;
+  value.n               = static_cast<CORBA::ULong>(snapshot.count());
+  value.maximum         = static_cast<double>(snapshot.maximum()) / usec_per_sec;
+  value.minimum         = static_cast<double>(snapshot.minimum()) / usec_per_sec;
+  value.mean            = snapshot.mean() / usec_per_sec;
+  value.variance        = snapshot.variance() / (usec_per_sec * usec_per_sec);
+  value.median          = static_cast<double>(snapshot.value_at_percentile(50.0)) / usec_per_sec;
+  value.percentile_90   = static_cast<double>(snapshot.value_at_percentile(90.0)) / usec_per_sec;
+  value.percentile_99   = static_cast<double>(snapshot.value_at_percentile(99.0)) / usec_per_sec;
+  value.percentile_99_9 = static_cast<double>(snapshot.value_at_percentile(99.9)) / usec_per_sec;
 
   return value;
 }
 
+void OpenDDS::DCPS::WriterStats::get_histogram(HistogramSnapshot& snapshot) const
+{
+  histogram_->snapshot(snapshot);
+}
+
 void OpenDDS::DCPS::WriterStats::reset_stats()
 {
-  this->stats_.reset();
+  histogram_->reset();
+  if (raw_) {
+    ACE_Guard<ACE_Thread_Mutex> guard(raw_->lock_);
+    raw_->stats_.reset();
+  }
 }
 
 #ifndef OPENDDS_SAFETY_PROFILE
 std::ostream& OpenDDS::DCPS::WriterStats::raw_data(std::ostream& str) const
 {
-  str << std::dec << this->stats_.size()
-                              << " samples out of " << this->stats_.n() << std::endl;
-  return str << this->stats_;
+  if (!raw_) {
+    return str << "0 samples out of " << std::dec << get_stats().n << std::endl;
+  }
+  ACE_Guard<ACE_Thread_Mutex> guard(raw_->lock_);
+  str << std::dec << raw_->stats_.size()
+                              << " samples out of " << raw_->stats_.n() << std::endl;
+  return str << raw_->stats_;
 }
 #endif //OPENDDS_SAFETY_PROFILE
 
@@ -2280,54 +2302,61 @@ void DataReaderImpl::dispose_unregister(const ReceivedDataSample&,
 
 void DataReaderImpl::process_latency(const ReceivedDataSample& sample)
 {
-  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(statistics_lock_);
-  StatsMapType::iterator location = this->statistics_.find(sample.header_.publication_id_);
-
-  if (location != this->statistics_.end()) {
-    const DDS::Duration_t zero = { DDS::DURATION_ZERO_SEC, DDS::DURATION_ZERO_NSEC };
-
-    // Only when the user has specified a latency budget or statistics
-    // are enabled we need to calculate our latency
-    if ((this->statistics_enabled()) ||
-        (this->qos_.latency_budget.duration > zero)) {
-      const DDS::Time_t timestamp = {
-        sample.header_.source_timestamp_sec_,
-        sample.header_.source_timestamp_nanosec_
-      };
-      const TimeDuration latency = SystemTimePoint::now() - SystemTimePoint(timestamp);
+  const DDS::Duration_t zero = { DDS::DURATION_ZERO_SEC, DDS::DURATION_ZERO_NSEC };
+  const bool budget = qos_.latency_budget.duration > zero;
+  bool over_budget = false;
 
-      if (this->statistics_enabled()) {
-        location->second.add_stat(latency);
-      }
+  {
+    // Recording into the writer's histogram is lock free, so the map only
+    // needs to be protected from concurrent association changes.
+    ACE_Read_Guard<ACE_RW_Thread_Mutex> guard(statistics_lock_);
+    StatsMapType::iterator location = this->statistics_.find(sample.header_.publication_id_);
+
+    if (location != this->statistics_.end()) {
+      // Only when the user has specified a latency budget or statistics
+      // are enabled we need to calculate our latency
+      const bool enabled = this->statistics_enabled();
+      if (enabled || budget) {
+        const DDS::Time_t timestamp = {
+          sample.header_.source_timestamp_sec_,
+          sample.header_.source_timestamp_nanosec_
+        };
+        const TimeDuration latency = SystemTimePoint::now() - SystemTimePoint(timestamp);
+
+        if (enabled) {
+          location->second.add_stat(latency);
+        }
 
-      if (DCPS_debug_level > 9) {
-        ACE_DEBUG((LM_DEBUG,
-            ACE_TEXT("(%P|%t) DataReaderImpl::process_latency() - ")
-            ACE_TEXT("measured latency of %C for current sample.\n"),
-            latency.str().c_str()));
-      }
+        if (DCPS_debug_level > 9) {
+          ACE_DEBUG((LM_DEBUG,
+              ACE_TEXT("(%P|%t) DataReaderImpl::process_latency() - ")
+              ACE_TEXT("measured latency of %C for current sample.\n"),
+              latency.str().c_str()));
+        }
 
-      if (this->qos_.latency_budget.duration > zero) {
         // Check latency against the budget.
-        if (latency > TimeDuration(this->qos_.latency_budget.duration)) {
-          this->notify_latency(sample.header_.publication_id_);
-        }
+        over_budget = budget && latency > TimeDuration(this->qos_.latency_budget.duration);
       }
+    } else if (DCPS_debug_level > 0) {
+      /// NB: This message is generated contemporaneously with a similar
+      ///     message from writer_activity().  That message is not marked
+      ///     as an error, so we follow that lead and leave this as an
+      ///     informational message, guarded by debug level.  This seems
+      ///     to be due to late samples (samples delivered after an
+      ///     association has been torn down).  We may want to promote this
+      ///     to a warning if other conditions causing this symptom are
+      ///     discovered.
+      ACE_DEBUG((LM_DEBUG,
+          ACE_TEXT("(%P|%t) DataReaderImpl::process_latency() - ")
+          ACE_TEXT("reader %C is not associated with writer %C (late sample?).\n"),
+          LogGuid(get_guid()).c_str(),
+          LogGuid(sample.header_.publication_id_).c_str()));
     }
-  } else if (DCPS_debug_level > 0) {
-    /// NB: This message is generated contemporaneously with a similar
-    ///     message from writer_activity().  That message is not marked
-    ///     as an error, so we follow that lead and leave this as an
-    ///     informational message, guarded by debug level.  This seems
-    ///     to be due to late samples (samples delivered after an
-    ///     association has been torn down).  We may want to promote this
-    ///     to a warning if other conditions causing this symptom are
-    ///     discovered.
-    ACE_DEBUG((LM_DEBUG,
-        ACE_TEXT("(%P|%t) DataReaderImpl::process_latency() - ")
-        ACE_TEXT("reader %C is not associated with writer %C (late sample?).\n"),
-        LogGuid(get_guid()).c_str(),
-        LogGuid(sample.header_.publication_id_).c_str()));
+  }
+
+  // The listener may query the statistics, so it is called without the lock.
+  if (over_budget) {
+    this->notify_latency(sample.header_.publication_id_);
   }
 }
 
@@ -2366,7 +2395,7 @@ void
 DataReaderImpl::get_latency_stats(
     OpenDDS::DCPS::LatencyStatisticsSeq & stats)
 {
-  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(statistics_lock_);
+  ACE_Read_Guard<ACE_RW_Thread_Mutex> guard(statistics_lock_);
   stats.length(static_cast<CORBA::ULong>(this->statistics_.size()));
   int index = 0;
 
@@ -2382,7 +2411,7 @@ DataReaderImpl::get_latency_stats(
 void
 DataReaderImpl::reset_latency_stats()
 {
-  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(statistics_lock_);
+  ACE_Read_Guard<ACE_RW_Thread_Mutex> guard(statistics_lock_);
   for (StatsMapType::iterator current = this->statistics_.begin();
       current != this->statistics_.end();
       ++current) {
@@ -3566,6 +3595,20 @@ const DataReaderImpl::HandleSet& DataReaderImpl::lookup_matching_instances(CORBA
   return ci->second;
 }
 
+namespace {
+  struct DeadlineLess {
+    bool operator()(const SubscriptionInstance& a, const SubscriptionInstance& b) const
+    {
+      return a.deadline_ < b.deadline_;
+    }
+
+    bool operator()(const SubscriptionInstance_rch& a, const SubscriptionInstance_rch& b) const
+    {
+      return a->deadline_ < b->deadline_;
+    }
+  };
+}
+
 void DataReaderImpl::schedule_deadline(SubscriptionInstance_rch instance,
                                        bool timer_called)
 {
@@ -3573,11 +3616,11 @@ void DataReaderImpl::schedule_deadline(SubscriptionInstance_rch instance,
   if (instance->deadline_ == MonotonicTimePoint::zero_value) {
     instance->deadline_ = MonotonicTimePoint::now() + deadline_period_;
     const bool schedule = deadline_queue_.empty();
-    deadline_queue_.insert(std::make_pair(instance->deadline_, instance));
+    deadline_queue_.insert_sorted(instance, DeadlineLess());
     if (!timer_called) {
       if (schedule) {
         deadline_task_->schedule(deadline_period_);
-      } else if (deadline_queue_.begin()->second == instance) {
+      } else if (deadline_queue_.front() == instance.in()) {
         // Moved to front.
         deadline_task_->cancel();
         deadline_task_->schedule(deadline_period_);
@@ -3590,12 +3633,7 @@ void DataReaderImpl::cancel_deadline(SubscriptionInstance_rch instance)
 {
   // Should be called with sample_lock_.
   if (instance->deadline_ != MonotonicTimePoint::zero_value) {
-    for (DeadlineQueue::iterator pos = deadline_queue_.lower_bound(instance->deadline_), limit = deadline_queue_.upper_bound(instance->deadline_); pos != limit; ++pos) {
-      if (pos->second == instance) {
-        deadline_queue_.erase(pos);
-        break;
-      }
-    }
+    deadline_queue_.remove(instance.in());
     instance->deadline_ = MonotonicTimePoint::zero_value;
   }
 }
@@ -3662,13 +3700,10 @@ void DataReaderImpl::process_deadline(SubscriptionInstance_rch instance,
     }
 
     // This next part is without status_lock_ held to avoid reactor deadlock.
-    if (timer_called) {
-      instance->deadline_ = MonotonicTimePoint::zero_value;
-      schedule_deadline(instance, timer_called);
-    } else {
-      cancel_deadline(instance);
-      schedule_deadline(instance, timer_called);
-    }
+    // The timer has already taken the instance off the queue, but a sample
+    // may have put it back while the listener was called.
+    cancel_deadline(instance);
+    schedule_deadline(instance, timer_called);
   }
 }
 
@@ -3685,45 +3720,29 @@ void DataReaderImpl::reset_deadline_period(const TimeDuration& deadline_period)
     deadline_period_ = deadline_period;
 
     if (deadline_queue_enabled_) {
-      ACE_GUARD(ACE_Recursive_Thread_Mutex, instance_guard, this->instances_lock_);
-      const MonotonicTimePoint now = MonotonicTimePoint::now();
-      for (SubscriptionInstanceMapType::iterator iter = this->instances_.begin();
-           iter != this->instances_.end();
-           ++iter) {
-        if (iter->second->deadline_ != MonotonicTimePoint::zero_value) {
-          reschedule_deadline(iter->second, now);
-        }
+      ACE_GUARD(ACE_Recursive_Thread_Mutex, guard, sample_lock_);
+      if (deadline_queue_.empty()) {
+        return;
       }
-    }
-  }
-}
-
-void DataReaderImpl::reschedule_deadline(SubscriptionInstance_rch instance,
-                                         const MonotonicTimePoint& now)
-{
-  ACE_GUARD(ACE_Recursive_Thread_Mutex, guard, sample_lock_);
-
-  // So the datareader can call back into us.
-  if (instance->deadline_ != MonotonicTimePoint::zero_value) {
 
-    // Remove.
-    for (DeadlineQueue::iterator pos = deadline_queue_.lower_bound(instance->deadline_), limit = deadline_queue_.upper_bound(instance->deadline_); pos != limit; ++pos) {
-      if (pos->second == instance) {
-        deadline_queue_.erase(pos);
-        break;
+      // The new deadlines need not be in the order of the old ones, so the
+      // queue is rebuilt instead of repositioning one instance at a time.
+      const MonotonicTimePoint now = MonotonicTimePoint::now();
+      OPENDDS_VECTOR(SubscriptionInstance_rch) instances;
+      instances.reserve(deadline_queue_.size());
+      while (!deadline_queue_.empty()) {
+        const SubscriptionInstance_rch instance = deadline_queue_.pop_front();
+        instance->deadline_ = now + (deadline_period_ - (instance->deadline_ - now));
+        instances.push_back(instance);
       }
-    }
 
-    instance->deadline_ = now + (deadline_period_ - (instance->deadline_ - now));
+      std::stable_sort(instances.begin(), instances.end(), DeadlineLess());
+      for (size_t i = 0; i < instances.size(); ++i) {
+        deadline_queue_.push_back(instances[i]);
+      }
 
-    const bool schedule = deadline_queue_.empty();
-    deadline_queue_.insert(std::make_pair(instance->deadline_, instance));
-    if (schedule) {
-      deadline_task_->schedule(deadline_period_);
-    } else if (deadline_queue_.begin()->second == instance) {
-      // Moved to front.
       deadline_task_->cancel();
-      deadline_task_->schedule(deadline_period_);
+      deadline_task_->schedule(deadline_queue_.front()->deadline_ - now);
     }
   }
 }
@@ -3733,15 +3752,15 @@ void DataReaderImpl::deadline_task(const MonotonicTimePoint& now)
   ThreadStatusManager::Event ev(TheServiceParticipant->get_thread_status_manager());
 
   ACE_GUARD(ACE_Recursive_Thread_Mutex, guard, sample_lock_);
-  for (DeadlineQueue::iterator pos = deadline_queue_.begin(), limit = deadline_queue_.end(); pos != limit && pos->first <= now;) {
-    SubscriptionInstance_rch instance = pos->second;
-    deadline_queue_.erase(pos++);
-    // pos is no longer valid.
+  // Processing an instance puts it back at the end of the queue with a
+  // deadline after now, so this only visits the instances that expired.
+  while (!deadline_queue_.empty() && deadline_queue_.front()->deadline_ <= now) {
+    const SubscriptionInstance_rch instance = deadline_queue_.pop_front();
     process_deadline(instance, now, true);
   }
 
   if (!deadline_queue_.empty()) {
-    deadline_task_->schedule(deadline_queue_.begin()->first - now);
+    deadline_task_->schedule(deadline_queue_.front()->deadline_ - now);
   }
 }
 
@@ -21,6 +21,7 @@
 #include "DomainParticipantImpl.h"
 #include "EntityImpl.h"
 #include "GroupRakeData.h"
+#include "Histogram.h"
 #include "InstanceState.h"
 #include "MultiTopicImpl.h"
 #include "OwnershipManager.h"
@@ -82,8 +83,15 @@ enum MarshalingType {
 };
 
 /// Elements stored for managing statistical data.
+///
+/// Latency is recorded into a Histogram, which needs no lock, so copies
+/// of a WriterStats share the same counters.  The raw data buffer is only
+/// kept when a raw latency buffer size was requested.
 class OpenDDS_Dcps_Export WriterStats {
 public:
+  /// Latency is recorded in microseconds, so 36 bits cover about 19 hours.
+  static const unsigned int LATENCY_VALUE_BITS = 36;
+
   /// Default constructor.
   WriterStats(
     int amount = 0,
@@ -98,6 +106,9 @@ public:
   /// Extract the current latency statistics for this writer.
   LatencyStatistics get_stats() const;
 
+  /// Copy the latency histogram for this writer, in microseconds.
+  void get_histogram(HistogramSnapshot& snapshot) const;
+
   /// Reset the latency statistics for this writer.
   void reset_stats();
 
@@ -107,8 +118,20 @@ public:
 #endif
 
 private:
-  /// Latency statistics for the DataWriter to this DataReader.
-  Stats<double> stats_;
+  struct RawData : public virtual RcObject {
+    RawData(int amount, DataCollector<double>::OnFull type)
+      : stats_(amount, type)
+    {}
+
+    ACE_Thread_Mutex lock_;
+    Stats<double> stats_;
+  };
+
+  /// Latency of the DataWriter to this DataReader.
+  RcHandle<Histogram> histogram_;
+
+  /// Raw latency data, null unless a raw buffer was requested.
+  RcHandle<RawData> raw_;
 };
 
 #ifndef OPENDDS_NO_CONTENT_SUBSCRIPTION_PROFILE
@@ -400,6 +423,11 @@ public:
   {
     return static_cast<size_t>(depth_);
   }
+  /// Samples held by all instances of this reader.
+  const ReceivedSampleCounts_rch& sample_counts() const
+  {
+    return sample_counts_;
+  }
   size_t get_n_chunks() const
   {
     return n_chunks_;
@@ -721,6 +749,9 @@ protected:
   /// @TODO: remove the recursive nature of the instances_lock if not needed.
   mutable ACE_Recursive_Thread_Mutex instances_lock_;
 
+  /// Updated by the sample lists of the instances.
+  const ReceivedSampleCounts_rch sample_counts_;
+
   /// Check if the received data sample or instance should
   /// be filtered.
   /**
@@ -963,7 +994,9 @@ private:
   /// Watchdog responsible for reporting missed offered
   /// deadlines.
   TimeDuration deadline_period_;
-  typedef OPENDDS_MULTIMAP(MonotonicTimePoint, SubscriptionInstance_rch) DeadlineQueue;
+  /// Instances with a deadline, earliest first.  Every instance has the same
+  /// period so a new deadline is almost always the latest.
+  typedef IntrusiveList<SubscriptionInstance, &SubscriptionInstance::deadline_links_> DeadlineQueue;
   DeadlineQueue deadline_queue_;
   bool deadline_queue_enabled_;
   typedef PmfSporadicTask<DataReaderImpl> DRISporadicTask;
@@ -972,8 +1005,6 @@ private:
   void schedule_deadline(SubscriptionInstance_rch instance,
                          bool timer_called);
   void reset_deadline_period(const TimeDuration& deadline_period);
-  void reschedule_deadline(SubscriptionInstance_rch instance,
-                           const MonotonicTimePoint& now);
   void cancel_deadline(SubscriptionInstance_rch instance);
   void cancel_all_deadlines();
   void deadline_task(const MonotonicTimePoint& now);
@@ -999,9 +1030,11 @@ private:
   /// RW lock for reading/writing publications.
   ACE_RW_Thread_Mutex writers_lock_;
 
-  /// Statistics for this reader, collected for each writer.
+  /// Statistics for this reader, collected for each writer.  The write
+  /// side of statistics_lock_ is only taken to add or remove writers,
+  /// latency is recorded under the read side.
   StatsMapType statistics_;
-  ACE_Recursive_Thread_Mutex statistics_lock_;
+  ACE_RW_Thread_Mutex statistics_lock_;
 
   /// Bound (or initial reservation) of raw latency buffer.
   unsigned int raw_latency_buffer_size_;
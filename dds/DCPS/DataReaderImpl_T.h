@@ -11,6 +11,7 @@
 #include "GuidConverter.h"
 #include "MultiTopicImpl.h"
 #include "RakeResults_T.h"
+#include "SampleArena.h"
 #include "SubscriberImpl.h"
 #include "TypeSupportImpl.h"
 #include "Util.h"
@@ -103,6 +104,7 @@ namespace OpenDDS {
         : MessageType(other)
       {
       }
+      ~MessageTypeWithAllocator();
 
       const MessageType* message() const { return this; }
 
@@ -118,7 +120,21 @@ namespace OpenDDS {
       ACE_New_Allocator* allocator_;
     };
 
-    typedef OpenDDS::DCPS::Cached_Allocator_With_Overflow<MessageTypeMemoryBlock, ACE_Thread_Mutex>  DataAllocator;
+    /// Allocates samples and keeps the bodies of released ones for reuse.
+    class DataAllocator
+      : public OpenDDS::DCPS::Cached_Allocator_With_Overflow<MessageTypeMemoryBlock, ACE_Thread_Mutex>
+    {
+    public:
+      explicit DataAllocator(size_t n_chunks)
+        : OpenDDS::DCPS::Cached_Allocator_With_Overflow<MessageTypeMemoryBlock, ACE_Thread_Mutex>(n_chunks)
+        , arena_(n_chunks)
+      {}
+
+      SampleArena<MessageType>& arena() { return arena_; }
+
+    private:
+      SampleArena<MessageType> arena_;
+    };
 
     DataReaderImpl_T()
       : filter_delayed_sample_task_(make_rch<DRISporadicTask>(TheServiceParticipant->time_source(), TheServiceParticipant->interceptor(), rchandle_from(this), &DataReaderImpl_T::filter_delayed))
@@ -139,6 +155,15 @@ namespace OpenDDS {
           purge_data(ptr);
         }
       //X SHH release the data samples in the instance_map_.
+
+      if (data_allocator() && OpenDDS::DCPS::DCPS_debug_level >= 2) {
+        const typename SampleArena<MessageType>::Statistics stats = data_allocator()->arena().statistics();
+        ACE_DEBUG((LM_DEBUG,
+                   ACE_TEXT("(%P|%t) %CDataReaderImpl::~DataReaderImpl_T: ")
+                   ACE_TEXT("sample arena reused %B, fallback %B, retained %B, discarded %B\n"),
+                   TraitsType::type_name(),
+                   stats.reused, stats.fallback, stats.retained, stats.discarded));
+      }
     }
 
     /**
@@ -1075,6 +1100,11 @@ protected:
                              OpenDDS::DCPS::MarshalingType marshaling_type)
   {
     unique_ptr<MessageTypeWithAllocator> data(new (*data_allocator()) MessageTypeWithAllocator);
+    if (!marshal_skip_serialize_ && marshaling_type != OpenDDS::DCPS::KEY_ONLY_MARSHALING) {
+      // Deserializing the full sample overwrites every member, so it can use
+      // the buffers of a released sample.
+      data_allocator()->arena().reuse(*data);
+    }
     dynamic_hook(*data);
 
     Message_Block_Ptr payload(sample.data(&mb_alloc_));
@@ -1955,10 +1985,15 @@ void store_instance_data(unique_ptr<MessageTypeWithAllocator> instance_data,
 void finish_store_instance_data(unique_ptr<MessageTypeWithAllocator> instance_data, const DataSampleHeader& header,
   SubscriptionInstance_rch instance_ptr, bool is_dispose_msg, bool is_unregister_msg )
 {
-  if ((qos_.resource_limits.max_samples_per_instance !=
-        DDS::LENGTH_UNLIMITED) &&
-      (instance_ptr->rcvd_samples_.size() >=
-        static_cast<size_t>(qos_.resource_limits.max_samples_per_instance))) {
+  // Both limits are checked against counts kept by the sample lists, so
+  // this doesn't depend on the number of instances.
+  const bool instance_limit = qos_.resource_limits.max_samples_per_instance != DDS::LENGTH_UNLIMITED &&
+    instance_ptr->rcvd_samples_.size() >= static_cast<size_t>(qos_.resource_limits.max_samples_per_instance);
+  const bool reader_limit = !instance_limit &&
+    qos_.resource_limits.max_samples != DDS::LENGTH_UNLIMITED &&
+    sample_counts_->total >= static_cast<size_t>(qos_.resource_limits.max_samples);
+
+  if (instance_limit || reader_limit) {
 
     // According to spec 1.2, Samples that contain no data do not
     // count towards the limits imposed by the RESOURCE_LIMITS QoS policy
@@ -1973,8 +2008,8 @@ void finish_store_instance_data(unique_ptr<MessageTypeWithAllocator> instance_da
 
       set_status_changed_flag(DDS::SAMPLE_REJECTED_STATUS, true);
 
-      sample_rejected_status_.last_reason =
-        DDS::REJECTED_BY_SAMPLES_PER_INSTANCE_LIMIT;
+      sample_rejected_status_.last_reason = instance_limit ?
+        DDS::REJECTED_BY_SAMPLES_PER_INSTANCE_LIMIT : DDS::REJECTED_BY_SAMPLES_LIMIT;
       ++sample_rejected_status_.total_count;
       ++sample_rejected_status_.total_count_change;
       sample_rejected_status_.last_instance_handle = instance_ptr->instance_handle_;
@@ -1997,60 +2032,6 @@ void finish_store_instance_data(unique_ptr<MessageTypeWithAllocator> instance_da
       item->dec_ref();
     }
   }
-  else if (qos_.resource_limits.max_samples != DDS::LENGTH_UNLIMITED)
-  {
-    CORBA::Long total_samples = 0;
-    {
-      ACE_GUARD(ACE_Recursive_Thread_Mutex, instance_guard, instances_lock_);
-      for (OpenDDS::DCPS::DataReaderImpl::SubscriptionInstanceMapType::iterator iter = instances_.begin();
-        iter != instances_.end();
-        ++iter) {
-        OpenDDS::DCPS::SubscriptionInstance_rch ptr = iter->second;
-
-        total_samples += (CORBA::Long) ptr->rcvd_samples_.size();
-      }
-    }
-
-    if (total_samples >= qos_.resource_limits.max_samples)
-    {
-      // According to spec 1.2, Samples that contain no data do not
-      // count towards the limits imposed by the RESOURCE_LIMITS QoS policy
-      // so do not remove the oldest sample when unregister/dispose
-      // message arrives.
-
-      if (!is_dispose_msg && !is_unregister_msg
-        && !instance_ptr->rcvd_samples_.matches(DDS::READ_SAMPLE_STATE))
-      {
-        DDS::DataReaderListener_var listener
-          = listener_for(DDS::SAMPLE_REJECTED_STATUS);
-
-        set_status_changed_flag(DDS::SAMPLE_REJECTED_STATUS, true);
-
-        sample_rejected_status_.last_reason =
-          DDS::REJECTED_BY_SAMPLES_LIMIT;
-        ++sample_rejected_status_.total_count;
-        ++sample_rejected_status_.total_count_change;
-        sample_rejected_status_.last_instance_handle = instance_ptr->instance_handle_;
-        if (!CORBA::is_nil(listener.in()))
-        {
-          ACE_GUARD(typename DataReaderImpl::Reverse_Lock_t, unlock_guard, reverse_sample_lock_);
-
-          listener->on_sample_rejected(this, sample_rejected_status_);
-          sample_rejected_status_.total_count_change = 0;
-        }  // do we want to do something if listener is nil???
-        notify_status_condition_no_sample_lock();
-
-        return;
-      }
-      else if (!is_dispose_msg && !is_unregister_msg)
-      {
-        // Discard the oldest previously-read sample
-        OpenDDS::DCPS::ReceivedDataElement *item =
-          instance_ptr->rcvd_samples_.remove_head();
-        item->dec_ref();
-      }
-    }
-  }
 
   const ValueDispatcher* vd = get_value_dispatcher();
   const DDS::Time_t timestamp = {
@@ -2480,6 +2461,15 @@ bool marshal_skip_serialize_;
 
 };
 
+template <typename MessageType>
+DataReaderImpl_T<MessageType>::MessageTypeWithAllocator::~MessageTypeWithAllocator()
+{
+  // Every MessageTypeWithAllocator is allocated from a DataAllocator, see
+  // operator new.
+  MessageTypeMemoryBlock* const block = reinterpret_cast<MessageTypeMemoryBlock*>(this);
+  static_cast<DataAllocator*>(block->allocator_)->arena().recycle(*this);
+}
+
 template <typename MessageType>
 void* DataReaderImpl_T<MessageType>::MessageTypeWithAllocator::operator new(size_t , ACE_New_Allocator& pool)
 {
@@ -519,6 +519,8 @@ const char* to_string(SubMessageId value)
     return "MULTICAST_NAK";
   case MULTICAST_NAKACK:
     return "MULTICAST_NAKACK";
+  case MULTICAST_FEC:
+    return "MULTICAST_FEC";
   default:
     ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) ERROR: to_string(SubMessageId): ")
       ACE_TEXT("%d is either invalid or not recognized.\n"),
@@ -54,6 +54,7 @@ enum SubMessageId {
   MULTICAST_SYNACK,
   MULTICAST_NAK,
   MULTICAST_NAKACK,
+  MULTICAST_FEC,
   SUBMESSAGE_ID_MAX // must be the last enumerator
 };
 
@@ -290,7 +291,9 @@ private:
   };
 };
 
-typedef Cached_Allocator_With_Overflow<DataSampleHeader, ACE_Null_Mutex> DataSampleHeaderAllocator;
+// Header buffers are allocated by writing threads without the data
+// container's lock and freed by transport threads.
+typedef Cached_Allocator_With_Overflow<DataSampleHeader, ACE_Thread_Mutex> DataSampleHeaderAllocator;
 
 OpenDDS_Dcps_Export
 const char* to_string(MessageId value);
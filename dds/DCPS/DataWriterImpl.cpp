@@ -65,6 +65,8 @@ DataWriterImpl::DataWriterImpl()
   , n_chunks_(TheServiceParticipant->n_chunks())
   , association_chunk_multiplier_(TheServiceParticipant->association_chunk_multiplier())
   , qos_(TheServiceParticipant->initial_DataWriterQos())
+  , readers_share_expected_sequence_(true)
+  , shared_expected_sequence_(SequenceNumber::SEQUENCENUMBER_UNKNOWN())
   , skip_serialize_(false)
   , db_lock_pool_(new DataBlockLockPool((unsigned long)TheServiceParticipant->n_chunks()))
   , topic_id_(GUID_UNKNOWN)
@@ -73,7 +75,7 @@ DataWriterImpl::DataWriterImpl()
   , listener_mask_(DEFAULT_STATUS_MASK)
   , domain_id_(0)
   , publication_id_(GUID_UNKNOWN)
-  , sequence_number_(SequenceNumber::SEQUENCENUMBER_UNKNOWN())
+  , sequence_number_(0)
   , coherent_(false)
   , coherent_samples_(0)
   , last_deadline_missed_total_count_(0)
@@ -245,6 +247,7 @@ DataWriterImpl::add_association(const ReaderAssociation& reader,
 
   {
     ACE_GUARD(ACE_Thread_Mutex, reader_info_guard, this->reader_info_lock_);
+    unshare_expected_sequence_i();
     reader_info_.insert(std::make_pair(reader.readerId,
                                        ReaderInfo(reader.filterClassName,
                                                   publisher_content_filter_ ? reader.filterExpression.in() : "",
@@ -507,6 +510,7 @@ DataWriterImpl::association_complete_i(const GUID_t& remote_id)
     SendStateDataSampleList list = this->get_resend_data();
     {
       ACE_GUARD(ACE_Thread_Mutex, reader_info_guard, this->reader_info_lock_);
+      unshare_expected_sequence_i();
       // Update the reader's expected sequence
       SequenceNumber& seq =
         reader_info_.find(remote_id)->second.expected_sequence_;
@@ -742,6 +746,7 @@ void DataWriterImpl::replay_durable_data_for(const GUID_t& remote_id)
     SendStateDataSampleList list = this->get_resend_data();
     {
       ACE_GUARD(ACE_Thread_Mutex, reader_info_guard, this->reader_info_lock_);
+      unshare_expected_sequence_i();
       // Update the reader's expected sequence
       SequenceNumber& seq =
         reader_info_.find(remote_id)->second.expected_sequence_;
@@ -1873,8 +1878,6 @@ DataWriterImpl::write(Message_Block_Ptr data,
 {
   DBG_ENTRY_LVL("DataWriterImpl","write",6);
 
-  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(lock_);
-
   // take ownership of sequence allocated in FooDWImpl::write_w_timestamp()
   GUIDSeq_var filter_out_var(filter_out);
 
@@ -1885,13 +1888,29 @@ DataWriterImpl::write(Message_Block_Ptr data,
                      DDS::RETCODE_NOT_ENABLED);
   }
 
+  // Everything that doesn't depend on the other samples is done before
+  // taking the locks, so threads writing to different instances only
+  // contend while their samples are numbered and queued.
+  DataSampleHeader header;
+  Message_Block_Ptr message;
+  DDS::ReturnCode_t ret = create_sample_data_message(move(data),
+                                                     header,
+                                                     message,
+                                                     source_timestamp,
+                                                     (filter_out != 0));
+  if (ret != DDS::RETCODE_OK) {
+    return ret;
+  }
+
+  ACE_Guard<ACE_Recursive_Thread_Mutex> guard(lock_);
+
   ACE_GUARD_RETURN (ACE_Recursive_Thread_Mutex,
                     dc_guard,
                     get_lock(),
                     DDS::RETCODE_ERROR);
 
   DataSampleElement* element = 0;
-  DDS::ReturnCode_t ret = this->data_container_->obtain_buffer(element, handle);
+  ret = this->data_container_->obtain_buffer(element, handle);
 
   if (ret == DDS::RETCODE_TIMEOUT) {
     return ret; // silent for timeout
@@ -1905,19 +1924,9 @@ DataWriterImpl::write(Message_Block_Ptr data,
                      ret);
   }
 
-  Message_Block_Ptr temp;
-  ret = create_sample_data_message(move(data),
-                                   handle,
-                                   element->get_header(),
-                                   temp,
-                                   source_timestamp,
-                                   (filter_out != 0));
-  element->set_sample(move(temp));
-
-  if (ret != DDS::RETCODE_OK) {
-    data_container_->release_buffer(element);
-    return ret;
-  }
+  serialize_sample_header(header, *message);
+  element->get_header() = header;
+  element->set_sample(move(message));
 
   element->set_filter_out(filter_out_var._retn()); // ownership passed to element
 
@@ -1979,31 +1988,41 @@ DataWriterImpl::track_sequence_number(GUIDSeq* filter_out)
   ACE_GUARD(ACE_Thread_Mutex, reader_info_guard, this->reader_info_lock_);
 
 #ifndef OPENDDS_NO_CONTENT_FILTERED_TOPIC
-  // Track individual expected sequence numbers in ReaderInfo
-  RepoIdSet excluded;
+  if (filter_out && filter_out->length() && !reader_info_.empty()) {
+    // Track individual expected sequence numbers in ReaderInfo
+    unshare_expected_sequence_i();
 
-  if (filter_out && !reader_info_.empty()) {
+    RepoIdSet excluded;
     const GUID_t* buf = filter_out->get_buffer();
     excluded.insert(buf, buf + filter_out->length());
-  }
 
-  for (RepoIdToReaderInfoMap::iterator iter = reader_info_.begin(),
-       end = reader_info_.end(); iter != end; ++iter) {
-    // If not excluding this reader, update expected sequence
-    if (excluded.count(iter->first) == 0) {
-      iter->second.expected_sequence_ = sn;
+    for (RepoIdToReaderInfoMap::iterator iter = reader_info_.begin(),
+         end = reader_info_.end(); iter != end; ++iter) {
+      // If not excluding this reader, update expected sequence
+      if (excluded.count(iter->first) == 0) {
+        iter->second.expected_sequence_ = sn;
+      }
     }
+    return;
   }
-
 #else
   ACE_UNUSED_ARG(filter_out);
-  for (RepoIdToReaderInfoMap::iterator iter = reader_info_.begin(),
-       end = reader_info_.end(); iter != end; ++iter) {
-    iter->second.expected_sequence_ = sn;
-  }
-
 #endif // OPENDDS_NO_CONTENT_FILTERED_TOPIC
 
+  readers_share_expected_sequence_ = true;
+  shared_expected_sequence_ = sn;
+}
+
+void
+DataWriterImpl::unshare_expected_sequence_i()
+{
+  if (readers_share_expected_sequence_) {
+    for (RepoIdToReaderInfoMap::iterator iter = reader_info_.begin(),
+         end = reader_info_.end(); iter != end; ++iter) {
+      iter->second.expected_sequence_ = shared_expected_sequence_;
+    }
+    readers_share_expected_sequence_ = false;
+  }
 }
 
 void
@@ -2148,8 +2167,7 @@ DataWriterImpl::create_control_message(MessageId message_id,
 
   header_data.publisher_id_ = publisher->publisher_id_;
 
-  ACE_Guard<ACE_Thread_Mutex> guard(sn_lock_);
-  SequenceNumber sequence = sequence_number_;
+  // Sequence numbers are assigned with the data container's lock held.
   if (message_id == INSTANCE_REGISTRATION
       || message_id == DISPOSE_INSTANCE
       || message_id == UNREGISTER_INSTANCE
@@ -2157,11 +2175,9 @@ DataWriterImpl::create_control_message(MessageId message_id,
       || message_id == REQUEST_ACK) {
 
     header_data.sequence_repair_ = need_sequence_repair();
-    header_data.sequence_ = get_next_sn_i();
+    header_data.sequence_ = get_next_sn();
     header_data.key_fields_only_ = true;
-    sequence = sequence_number_;
   }
-  guard.release();
 
   ACE_Message_Block* message = 0;
   ACE_NEW_MALLOC_RETURN(message,
@@ -2187,11 +2203,8 @@ DataWriterImpl::create_control_message(MessageId message_id,
   if (header_data.sequence_ != SequenceNumber::SEQUENCENUMBER_UNKNOWN()) {
     ACE_GUARD_RETURN(ACE_Thread_Mutex, reader_info_guard, this->reader_info_lock_, 0);
     // Update the expected sequence number for all readers
-    RepoIdToReaderInfoMap::iterator reader;
-
-    for (reader = reader_info_.begin(); reader != reader_info_.end(); ++reader) {
-      reader->second.expected_sequence_ = sequence;
-    }
+    readers_share_expected_sequence_ = true;
+    shared_expected_sequence_ = header_data.sequence_;
   }
   if (DCPS_debug_level >= 4) {
     ACE_DEBUG((LM_DEBUG,
@@ -2205,27 +2218,14 @@ DataWriterImpl::create_control_message(MessageId message_id,
 
 DDS::ReturnCode_t
 DataWriterImpl::create_sample_data_message(Message_Block_Ptr data,
-                                           DDS::InstanceHandle_t instance_handle,
                                            DataSampleHeader& header_data,
                                            Message_Block_Ptr& message,
                                            const DDS::Time_t& source_timestamp,
                                            bool content_filter)
 {
-  PublicationInstance_rch instance =
-    data_container_->get_handle_instance(instance_handle);
-
-  if (0 == instance) {
-    ACE_ERROR_RETURN((LM_ERROR,
-                      ACE_TEXT("(%P|%t) DataWriterImpl::create_sample_data_message ")
-                      ACE_TEXT("failed to find instance for handle %d\n"),
-                      instance_handle),
-                     DDS::RETCODE_ERROR);
-  }
-
   header_data.message_id_ = SAMPLE_DATA;
   header_data.byte_order_ =
     this->swap_bytes() ? !ACE_CDR_BYTE_ORDER : ACE_CDR_BYTE_ORDER;
-  header_data.coherent_change_ = this->coherent_;
 
   RcHandle<PublisherImpl> publisher = this->publisher_servant_.lock();
 
@@ -2241,11 +2241,6 @@ DataWriterImpl::create_sample_data_message(Message_Block_Ptr data,
   header_data.content_filter_ = content_filter;
   header_data.cdr_encapsulation_ = this->cdr_encapsulation();
   header_data.message_length_ = static_cast<ACE_UINT32>(data->total_length());
-  {
-    ACE_Guard<ACE_Thread_Mutex> guard(sn_lock_);
-    header_data.sequence_repair_ = need_sequence_repair();
-    header_data.sequence_ = get_next_sn_i();
-  }
   header_data.source_timestamp_sec_ = source_timestamp.sec;
   header_data.source_timestamp_nanosec_ = source_timestamp.nanosec;
 
@@ -2276,15 +2271,24 @@ DataWriterImpl::create_sample_data_message(Message_Block_Ptr data,
                                           mb_allocator_.get()),
                         DDS::RETCODE_ERROR);
   message.reset(tmp_message);
-  *message << header_data;
+  return DDS::RETCODE_OK;
+}
+
+void
+DataWriterImpl::serialize_sample_header(DataSampleHeader& header_data,
+                                        ACE_Message_Block& message)
+{
+  header_data.coherent_change_ = this->coherent_;
+  header_data.sequence_repair_ = need_sequence_repair();
+  header_data.sequence_ = get_next_sn();
+  message << header_data;
   if (DCPS_debug_level >= 4) {
     ACE_DEBUG((LM_DEBUG,
-               ACE_TEXT("(%P|%t) DataWriterImpl::create_sample_data_message: ")
+               ACE_TEXT("(%P|%t) DataWriterImpl::serialize_sample_header: ")
                ACE_TEXT("from publication %C sending data sample: %C .\n"),
                LogGuid(publication_id_).c_str(),
                to_string(header_data).c_str()));
   }
-  return DDS::RETCODE_OK;
 }
 
 void
@@ -2785,9 +2789,14 @@ DataWriterImpl::need_sequence_repair()
 bool
 DataWriterImpl::need_sequence_repair_i() const
 {
+  const SequenceNumber sn = get_max_sn();
+  if (readers_share_expected_sequence_) {
+    return !reader_info_.empty() && shared_expected_sequence_ != sn;
+  }
+
   for (RepoIdToReaderInfoMap::const_iterator it = reader_info_.begin(),
        end = reader_info_.end(); it != end; ++it) {
-    if (it->second.expected_sequence_ != sequence_number_) {
+    if (it->second.expected_sequence_ != sn) {
       return true;
     }
   }
@@ -434,16 +434,26 @@ public:
    * the sample data. The header contains the information
    * needed. e.g. message id, length of whole message...
    * The fast allocator is used to allocate the message block,
-   * data block and header.
+   * data block and header.  It takes no locks, so the header is
+   * left for serialize_sample_header() to complete and write.
    */
   DDS::ReturnCode_t
   create_sample_data_message(Message_Block_Ptr data,
-                             DDS::InstanceHandle_t instance_handle,
                              DataSampleHeader& header_data,
                              Message_Block_Ptr& message,
                              const DDS::Time_t& source_timestamp,
                              bool content_filter);
 
+  /**
+   * Assign the sample's sequence number and write the header into the
+   * message block made by create_sample_data_message().  Called with
+   * lock_ and the data container's lock held: the transport expects
+   * sequence numbers in the order samples are queued, and sends GAPs
+   * for numbers it hasn't seen.
+   */
+  void serialize_sample_header(DataSampleHeader& header_data,
+                               ACE_Message_Block& message);
+
 #ifndef OPENDDS_NO_PERSISTENCE_PROFILE
   /// Make sent data available beyond the lifetime of this
   /// @c DataWriter.
@@ -488,8 +498,8 @@ public:
 
   SequenceNumber get_max_sn() const
   {
-    ACE_Guard<ACE_Thread_Mutex> guard(sn_lock_);
-    return sequence_number_;
+    const SequenceNumber::Value value = sequence_number_;
+    return value ? SequenceNumber(value) : SequenceNumber::SEQUENCENUMBER_UNKNOWN();
   }
 
   const ValueDispatcher* get_value_dispatcher() const
@@ -514,18 +524,7 @@ protected:
 
   SequenceNumber get_next_sn()
   {
-    ACE_Guard<ACE_Thread_Mutex> guard(sn_lock_);
-    return get_next_sn_i();
-  }
-
-  SequenceNumber get_next_sn_i()
-  {
-    if (sequence_number_ == SequenceNumber::SEQUENCENUMBER_UNKNOWN()) {
-      sequence_number_ = SequenceNumber();
-    } else {
-      ++sequence_number_;
-    }
-    return sequence_number_;
+    return SequenceNumber(++sequence_number_);
   }
 
   // Perform cast to get extended version of listener (otherwise nil)
@@ -585,6 +584,17 @@ protected:
   typedef OPENDDS_MAP_CMP(GUID_t, ReaderInfo, GUID_tKeyLessThan) RepoIdToReaderInfoMap;
   RepoIdToReaderInfoMap reader_info_;
 
+  /// While true every reader expects shared_expected_sequence_ and
+  /// ReaderInfo::expected_sequence_ is not kept up to date, so a sample sent
+  /// to all readers doesn't have to visit each one.  Protected by
+  /// reader_info_lock_.
+  bool readers_share_expected_sequence_;
+  SequenceNumber shared_expected_sequence_;
+
+  /// Give each reader its own copy of the shared expected sequence before
+  /// they diverge.  Called with reader_info_lock_ held.
+  void unshare_expected_sequence_i();
+
   struct AckCustomization {
     GUIDSeq customized_;
     AckToken& token_;
@@ -749,10 +759,11 @@ private:
   WeakRcHandle<PublisherImpl> publisher_servant_;
   /// The repository id of this datawriter/publication.
   GUID_t publication_id_;
-  /// The sequence number unique in DataWriter scope.
-  SequenceNumber sequence_number_;
-  /// Mutex for sequence_number_
-  mutable ACE_Thread_Mutex sn_lock_;
+  /// Value of the last sequence number assigned in DataWriter scope, or 0
+  /// before the first.  Numbers are assigned while the data container's lock
+  /// is held, so they follow the order samples are queued, but reading the
+  /// current one takes no lock.
+  Atomic<SequenceNumber::Value> sequence_number_;
   /// Flag indicating DataWriter current belongs to
   /// a coherent change set.
   bool coherent_;
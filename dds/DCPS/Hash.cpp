@@ -7,6 +7,9 @@
 
 #include "Hash.h"
 
+#include <ace/Message_Block.h>
+
+#include <algorithm>
 #include <cstring>
 
 using std::memcpy;
@@ -328,6 +331,18 @@ void MD5Hash(MD5Result& result, const void* input, size_t size)
   MD5_Final(result, &ctx);
 }
 
+void MD5Hash(MD5Result& result, const ACE_Message_Block& input, size_t size)
+{
+  MD5_CTX ctx;
+  MD5_Init(&ctx);
+  for (const ACE_Message_Block* mb = &input; mb && size; mb = mb->cont()) {
+    const size_t len = (std::min)(mb->length(), size);
+    MD5_Update(&ctx, mb->rd_ptr(), static_cast<unsigned long>(len));
+    size -= len;
+  }
+  MD5_Final(result, &ctx);
+}
+
 }
 }
 
@@ -14,6 +14,10 @@
 #include <cstdint>
 #endif
 
+ACE_BEGIN_VERSIONED_NAMESPACE_DECL
+class ACE_Message_Block;
+ACE_END_VERSIONED_NAMESPACE_DECL
+
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
@@ -23,6 +27,11 @@ typedef unsigned char MD5Result[16];
 OpenDDS_Dcps_Export
 void MD5Hash(MD5Result& result, const void* input, size_t size);
 
+/// Hash the first size bytes readable from the message block chain starting
+/// at input (or the whole chain if it is shorter) without copying it.
+OpenDDS_Dcps_Export
+void MD5Hash(MD5Result& result, const ACE_Message_Block& input, size_t size);
+
 #ifdef ACE_HAS_CPP11
 OpenDDS_Dcps_Export
 inline uint32_t one_at_a_time_hash(const uint8_t* key, size_t length, uint32_t start_hash = 0u)
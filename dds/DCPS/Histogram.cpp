@@ -0,0 +1,292 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
+
+#include "Histogram.h"
+
+#include <ace/Guard_T.h>
+
+#include <algorithm>
+#include <cmath>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+namespace {
+  const unsigned int MAX_SUB_BUCKET_BITS = 16;
+  const ACE_UINT64 UINT64_ONES = ~ACE_UINT64(0);
+
+  unsigned int clamp_sub_bucket_bits(unsigned int sub_bucket_bits)
+  {
+    return std::min(std::max(sub_bucket_bits, 1u), MAX_SUB_BUCKET_BITS);
+  }
+
+  unsigned int clamp_max_value_bits(unsigned int sub_bucket_bits, unsigned int max_value_bits)
+  {
+    return std::min(std::max(max_value_bits, clamp_sub_bucket_bits(sub_bucket_bits) + 1), 64u);
+  }
+
+  unsigned int most_significant_bit(ACE_UINT64 value)
+  {
+    unsigned int msb = 0;
+    for (unsigned int shift = 32; shift; shift >>= 1) {
+      if (value >> shift) {
+        value >>= shift;
+        msb += shift;
+      }
+    }
+    return msb;
+  }
+
+#ifdef ACE_HAS_CPP11
+  const std::memory_order relaxed = std::memory_order_relaxed;
+#endif
+}
+
+HistogramSnapshot::HistogramSnapshot()
+  : sub_bucket_bits_(0)
+  , max_value_bits_(0)
+  , count_(0)
+  , minimum_(UINT64_ONES)
+  , maximum_(0)
+  , sum_(0)
+{
+}
+
+HistogramSnapshot::HistogramSnapshot(unsigned int sub_bucket_bits, unsigned int max_value_bits)
+  : sub_bucket_bits_(clamp_sub_bucket_bits(sub_bucket_bits))
+  , max_value_bits_(clamp_max_value_bits(sub_bucket_bits, max_value_bits))
+  , counts_(Histogram::bucket_count(sub_bucket_bits_, max_value_bits_), 0)
+  , count_(0)
+  , minimum_(UINT64_ONES)
+  , maximum_(0)
+  , sum_(0)
+{
+}
+
+bool
+HistogramSnapshot::add_bucket(size_t index, ACE_UINT64 count)
+{
+  if (index >= counts_.size()) {
+    return false;
+  }
+  if (count == 0) {
+    return true;
+  }
+
+  const ACE_UINT64 low = Histogram::bucket_lowest(index, sub_bucket_bits_);
+  const ACE_UINT64 high = Histogram::bucket_highest(index, sub_bucket_bits_);
+  counts_[index] += count;
+  count_ += count;
+  sum_ += count * (low + (high - low) / 2);
+  minimum_ = std::min(minimum_, low);
+  maximum_ = std::max(maximum_, high);
+  return true;
+}
+
+double
+HistogramSnapshot::mean() const
+{
+  return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0;
+}
+
+double
+HistogramSnapshot::variance() const
+{
+  if (count_ == 0) {
+    return 0.0;
+  }
+
+  const double avg = mean();
+  double sum_squares = 0.0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    if (counts_[i]) {
+      const ACE_UINT64 low = std::max(Histogram::bucket_lowest(i, sub_bucket_bits_), minimum_);
+      const ACE_UINT64 high = std::min(Histogram::bucket_highest(i, sub_bucket_bits_), maximum_);
+      const double delta = (static_cast<double>(low) + static_cast<double>(high)) / 2.0 - avg;
+      sum_squares += static_cast<double>(counts_[i]) * delta * delta;
+    }
+  }
+  return sum_squares / static_cast<double>(count_);
+}
+
+ACE_UINT64
+HistogramSnapshot::value_at_percentile(double percentile) const
+{
+  if (count_ == 0) {
+    return 0;
+  }
+
+  const double fraction = std::min(std::max(percentile, 0.0), 100.0) / 100.0;
+  ACE_UINT64 target = static_cast<ACE_UINT64>(std::ceil(fraction * static_cast<double>(count_)));
+  target = std::min(std::max(target, ACE_UINT64(1)), count_);
+
+  ACE_UINT64 seen = 0;
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    seen += counts_[i];
+    if (seen >= target) {
+      const ACE_UINT64 value = std::min(Histogram::bucket_highest(i, sub_bucket_bits_), maximum_);
+      // A concurrent record() may not have published its minimum yet.
+      return minimum_ <= maximum_ ? std::max(value, minimum_) : value;
+    }
+  }
+  return maximum_;
+}
+
+bool
+HistogramSnapshot::merge(const HistogramSnapshot& other)
+{
+  if (other.counts_.empty()) {
+    return true;
+  }
+
+  if (counts_.empty()) {
+    sub_bucket_bits_ = other.sub_bucket_bits_;
+    max_value_bits_ = other.max_value_bits_;
+    counts_.assign(other.counts_.size(), 0);
+  } else if (sub_bucket_bits_ != other.sub_bucket_bits_ ||
+             max_value_bits_ != other.max_value_bits_) {
+    return false;
+  }
+
+  for (size_t i = 0; i < counts_.size(); ++i) {
+    counts_[i] += other.counts_[i];
+  }
+  count_ += other.count_;
+  sum_ += other.sum_;
+  if (other.count_) {
+    minimum_ = std::min(minimum_, other.minimum_);
+    maximum_ = std::max(maximum_, other.maximum_);
+  }
+  return true;
+}
+
+Histogram::Histogram(unsigned int sub_bucket_bits, unsigned int max_value_bits)
+  : sub_bucket_bits_(clamp_sub_bucket_bits(sub_bucket_bits))
+  , max_value_bits_(clamp_max_value_bits(sub_bucket_bits, max_value_bits))
+  , bucket_count_(bucket_count(sub_bucket_bits_, max_value_bits_))
+  , counts_(new Atomic<ACE_UINT64>[bucket_count_])
+{
+  reset();
+}
+
+Histogram::~Histogram()
+{
+  delete [] counts_;
+}
+
+size_t
+Histogram::bucket_count(unsigned int sub_bucket_bits, unsigned int max_value_bits)
+{
+  return size_t(max_value_bits - sub_bucket_bits + 1) << sub_bucket_bits;
+}
+
+size_t
+Histogram::bucket_index(ACE_UINT64 value, unsigned int sub_bucket_bits, unsigned int max_value_bits)
+{
+  if (max_value_bits < 64) {
+    value = std::min(value, (ACE_UINT64(1) << max_value_bits) - 1);
+  }
+
+  const ACE_UINT64 sub_buckets = ACE_UINT64(1) << sub_bucket_bits;
+  if (value < sub_buckets) {
+    return static_cast<size_t>(value);
+  }
+
+  // value >> exponent is in [sub_buckets, 2 * sub_buckets).
+  const unsigned int exponent = most_significant_bit(value) - sub_bucket_bits;
+  return static_cast<size_t>((ACE_UINT64(exponent) << sub_bucket_bits) + (value >> exponent));
+}
+
+ACE_UINT64
+Histogram::bucket_lowest(size_t index, unsigned int sub_bucket_bits)
+{
+  const size_t block = index >> sub_bucket_bits;
+  if (block == 0) {
+    return index;
+  }
+  const size_t sub_bucket = index & ((size_t(1) << sub_bucket_bits) - 1);
+  return (ACE_UINT64(sub_bucket) + (ACE_UINT64(1) << sub_bucket_bits)) << (block - 1);
+}
+
+ACE_UINT64
+Histogram::bucket_highest(size_t index, unsigned int sub_bucket_bits)
+{
+  const size_t block = index >> sub_bucket_bits;
+  if (block == 0) {
+    return index;
+  }
+  return bucket_lowest(index, sub_bucket_bits) + ((ACE_UINT64(1) << (block - 1)) - 1);
+}
+
+void
+Histogram::record(ACE_UINT64 value)
+{
+  const size_t index = bucket_index(value, sub_bucket_bits_, max_value_bits_);
+
+#ifdef ACE_HAS_CPP11
+  counts_[index].fetch_add(1, relaxed);
+  sum_.fetch_add(value, relaxed);
+
+  ACE_UINT64 current = minimum_.load(relaxed);
+  while (value < current && !minimum_.compare_exchange_weak(current, value, relaxed)) {}
+
+  current = maximum_.load(relaxed);
+  while (value > current && !maximum_.compare_exchange_weak(current, value, relaxed)) {}
+#else
+  ACE_Guard<ACE_Thread_Mutex> guard(lock_);
+  ++counts_[index];
+  sum_ += value;
+  if (value < minimum_.load()) {
+    minimum_ = value;
+  }
+  if (value > maximum_.load()) {
+    maximum_ = value;
+  }
+#endif
+}
+
+void
+Histogram::snapshot(HistogramSnapshot& snapshot) const
+{
+#ifndef ACE_HAS_CPP11
+  ACE_Guard<ACE_Thread_Mutex> guard(lock_);
+#endif
+
+  snapshot.sub_bucket_bits_ = sub_bucket_bits_;
+  snapshot.max_value_bits_ = max_value_bits_;
+  snapshot.counts_.resize(bucket_count_);
+  snapshot.count_ = 0;
+  for (size_t i = 0; i < bucket_count_; ++i) {
+    snapshot.counts_[i] = counts_[i].load();
+    snapshot.count_ += snapshot.counts_[i];
+  }
+  snapshot.sum_ = sum_.load();
+  snapshot.minimum_ = minimum_.load();
+  snapshot.maximum_ = maximum_.load();
+}
+
+void
+Histogram::reset()
+{
+#ifndef ACE_HAS_CPP11
+  ACE_Guard<ACE_Thread_Mutex> guard(lock_);
+#endif
+
+  for (size_t i = 0; i < bucket_count_; ++i) {
+    counts_[i] = 0;
+  }
+  sum_ = 0;
+  minimum_ = UINT64_ONES;
+  maximum_ = 0;
+}
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,153 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_HISTOGRAM_H
+#define OPENDDS_DCPS_HISTOGRAM_H
+
+#include "dcps_export.h"
+
+#include "Atomic.h"
+#include "PoolAllocator.h"
+#include "RcHandle_T.h"
+#include "RcObject.h"
+
+#include <ace/Basic_Types.h>
+#ifndef ACE_HAS_CPP11
+#  include <ace/Thread_Mutex.h>
+#endif
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+#pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/**
+ * @class HistogramSnapshot
+ *
+ * @brief Point in time copy of a Histogram.
+ *
+ * Snapshots are plain values: they can be copied, merged with snapshots of
+ * other histograms that use the same bucket layout, and queried for
+ * percentiles without touching the histogram they were taken from.
+ */
+class OpenDDS_Dcps_Export HistogramSnapshot {
+public:
+  HistogramSnapshot();
+
+  /// Empty snapshot with the bucket layout of a Histogram constructed with
+  /// the same arguments, to be filled in with add_bucket().
+  HistogramSnapshot(unsigned int sub_bucket_bits, unsigned int max_value_bits);
+
+  /// Number of values recorded.
+  ACE_UINT64 count() const { return count_; }
+
+  /// Smallest and largest values recorded.  Both are exact.
+  ACE_UINT64 minimum() const { return count_ ? minimum_ : 0; }
+  ACE_UINT64 maximum() const { return maximum_; }
+
+  /// Exact mean of the recorded values.
+  double mean() const;
+
+  /// Variance computed from the bucket midpoints.
+  double variance() const;
+
+  /// Smallest value v such that at least "percentile" percent of the
+  /// recorded values are less than or equal to v, to within the
+  /// precision of the buckets.  The result never exceeds maximum().
+  ACE_UINT64 value_at_percentile(double percentile) const;
+
+  /// Add the counts from "other" to this snapshot.  An empty snapshot
+  /// adopts the bucket layout of "other".  Returns false, leaving this
+  /// snapshot unchanged, if the bucket layouts differ.
+  bool merge(const HistogramSnapshot& other);
+
+  /// Add "count" values to bucket "index", such as when rebuilding a
+  /// snapshot from the counts() of another one.  The minimum, maximum and
+  /// mean are then only as precise as the buckets.  Returns false if the
+  /// index is out of range.
+  bool add_bucket(size_t index, ACE_UINT64 count);
+
+  unsigned int sub_bucket_bits() const { return sub_bucket_bits_; }
+  unsigned int max_value_bits() const { return max_value_bits_; }
+  const OPENDDS_VECTOR(ACE_UINT64)& counts() const { return counts_; }
+
+private:
+  friend class Histogram;
+
+  unsigned int sub_bucket_bits_;
+  unsigned int max_value_bits_;
+  OPENDDS_VECTOR(ACE_UINT64) counts_;
+  ACE_UINT64 count_;
+  ACE_UINT64 minimum_;
+  ACE_UINT64 maximum_;
+  ACE_UINT64 sum_;
+};
+
+/**
+ * @class Histogram
+ *
+ * @brief Log-bucketed (HDR style) histogram of unsigned integer values.
+ *
+ * Every power of two range is split into 2^sub_bucket_bits linear buckets,
+ * so the bucket a value lands in is at most 1/2^sub_bucket_bits of the
+ * value wide.  Values with more than max_value_bits significant bits are
+ * counted in the last bucket; minimum and maximum stay exact.
+ *
+ * record() only performs relaxed atomic updates so any number of threads
+ * can record concurrently without a lock.  Without C++11 atomics the
+ * updates are serialized by a mutex instead.
+ */
+class OpenDDS_Dcps_Export Histogram : public virtual RcObject {
+public:
+  static const unsigned int DEFAULT_SUB_BUCKET_BITS = 5;
+
+  explicit Histogram(unsigned int sub_bucket_bits = DEFAULT_SUB_BUCKET_BITS,
+                     unsigned int max_value_bits = 64);
+  ~Histogram();
+
+  void record(ACE_UINT64 value);
+
+  /// Copy the current counts into "snapshot".
+  void snapshot(HistogramSnapshot& snapshot) const;
+
+  /// Discard everything recorded so far.
+  void reset();
+
+  size_t bucket_count() const { return bucket_count_; }
+
+  /// Bucket layout helpers, shared with HistogramSnapshot.
+  static size_t bucket_count(unsigned int sub_bucket_bits, unsigned int max_value_bits);
+  static size_t bucket_index(ACE_UINT64 value, unsigned int sub_bucket_bits, unsigned int max_value_bits);
+  static ACE_UINT64 bucket_lowest(size_t index, unsigned int sub_bucket_bits);
+  static ACE_UINT64 bucket_highest(size_t index, unsigned int sub_bucket_bits);
+
+private:
+  Histogram(const Histogram&);
+  Histogram& operator=(const Histogram&);
+
+  const unsigned int sub_bucket_bits_;
+  const unsigned int max_value_bits_;
+  const size_t bucket_count_;
+  Atomic<ACE_UINT64>* const counts_;
+  Atomic<ACE_UINT64> minimum_;
+  Atomic<ACE_UINT64> maximum_;
+  Atomic<ACE_UINT64> sum_;
+#ifndef ACE_HAS_CPP11
+  mutable ACE_Thread_Mutex lock_;
+#endif
+};
+
+typedef RcHandle<Histogram> Histogram_rch;
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* OPENDDS_DCPS_HISTOGRAM_H */
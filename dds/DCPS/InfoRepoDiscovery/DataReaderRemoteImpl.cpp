@@ -6,6 +6,7 @@
  */
 
 #include "DataReaderRemoteImpl.h"
+#include "InfoRepoDiscovery.h"
 
 #include "dds/DCPS/DataReaderCallbacks.h"
 #include "dds/DCPS/debug.h"
@@ -16,8 +17,10 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
-DataReaderRemoteImpl::DataReaderRemoteImpl(DataReaderCallbacks& parent)
+DataReaderRemoteImpl::DataReaderRemoteImpl(DataReaderCallbacks& parent,
+                                           InfoRepoDiscovery& discovery)
   : parent_(parent)
+  , discovery_(discovery)
 {
 }
 
@@ -43,6 +46,37 @@ DataReaderRemoteImpl::add_association(const WriterAssociation& writer,
   }
 }
 
+void
+DataReaderRemoteImpl::add_associations(const WriterAssociationSeq& writers,
+                                       bool active)
+{
+  // the local copy of parent_ is necessary to prevent race condition
+  RcHandle<DataReaderCallbacks> parent = parent_.lock();
+  if (parent) {
+    for (CORBA::ULong i = 0; i < writers.length(); ++i) {
+      parent->add_association(writers[i], active);
+    }
+  }
+}
+
+void
+DataReaderRemoteImpl::add_association_to_readers(const ReaderIdSeq& others,
+                                                 const WriterAssociation& writer,
+                                                 bool active)
+{
+  // the local copy of parent_ is necessary to prevent race condition
+  RcHandle<DataReaderCallbacks> parent = parent_.lock();
+  if (parent) {
+    parent->add_association(writer, active);
+  }
+
+  // The others are in the same participant, so their servants are here too.
+  RcHandle<InfoRepoDiscovery> discovery = discovery_.lock();
+  if (discovery) {
+    discovery->add_association_to_readers(others, writer, active);
+  }
+}
+
 void
 DataReaderRemoteImpl::remove_associations(const WriterIdSeq& writers,
                                           CORBA::Boolean notify_lost)
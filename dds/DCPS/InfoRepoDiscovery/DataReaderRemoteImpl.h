@@ -24,6 +24,8 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
+class InfoRepoDiscovery;
+
 /**
 * @class DataReaderRemoteImpl
 *
@@ -35,13 +37,20 @@ class DataReaderRemoteImpl
   : public virtual POA_OpenDDS::DCPS::DataReaderRemote {
 public:
 
-  explicit DataReaderRemoteImpl(DataReaderCallbacks& parent);
+  DataReaderRemoteImpl(DataReaderCallbacks& parent, InfoRepoDiscovery& discovery);
 
   virtual ~DataReaderRemoteImpl();
 
   virtual void add_association(const WriterAssociation& writer,
                                bool active);
 
+  virtual void add_associations(const WriterAssociationSeq& writers,
+                                bool active);
+
+  virtual void add_association_to_readers(const ReaderIdSeq& others,
+                                          const WriterAssociation& writer,
+                                          bool active);
+
   virtual void remove_associations(const WriterIdSeq& writers,
                                    CORBA::Boolean callback);
 
@@ -51,6 +60,7 @@ public:
 
 private:
   WeakRcHandle<DataReaderCallbacks> parent_;
+  WeakRcHandle<InfoRepoDiscovery> discovery_;
 };
 
 OPENDDS_END_VERSIONED_NAMESPACE_DECL
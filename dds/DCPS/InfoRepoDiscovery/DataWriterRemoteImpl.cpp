@@ -6,6 +6,7 @@
  */
 
 #include "DataWriterRemoteImpl.h"
+#include "InfoRepoDiscovery.h"
 
 #include "dds/DCPS/DataWriterCallbacks.h"
 #include "dds/DCPS/debug.h"
@@ -16,8 +17,10 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
-DataWriterRemoteImpl::DataWriterRemoteImpl(DataWriterCallbacks& parent)
+DataWriterRemoteImpl::DataWriterRemoteImpl(DataWriterCallbacks& parent,
+                                           InfoRepoDiscovery& discovery)
   : parent_(parent)
+  , discovery_(discovery)
 {
 }
 
@@ -43,6 +46,37 @@ DataWriterRemoteImpl::add_association(const ReaderAssociation& reader,
   }
 }
 
+void
+DataWriterRemoteImpl::add_associations(const ReaderAssociationSeq& readers,
+                                       bool active)
+{
+  // the local copy of parent_ is necessary to prevent race condition
+  RcHandle<DataWriterCallbacks> parent = parent_.lock();
+  if (parent.in()) {
+    for (CORBA::ULong i = 0; i < readers.length(); ++i) {
+      parent->add_association(readers[i], active);
+    }
+  }
+}
+
+void
+DataWriterRemoteImpl::add_association_to_writers(const WriterIdSeq& others,
+                                                 const ReaderAssociation& reader,
+                                                 bool active)
+{
+  // the local copy of parent_ is necessary to prevent race condition
+  RcHandle<DataWriterCallbacks> parent = parent_.lock();
+  if (parent.in()) {
+    parent->add_association(reader, active);
+  }
+
+  // The others are in the same participant, so their servants are here too.
+  RcHandle<InfoRepoDiscovery> discovery = discovery_.lock();
+  if (discovery) {
+    discovery->add_association_to_writers(others, reader, active);
+  }
+}
+
 void
 DataWriterRemoteImpl::remove_associations(const ReaderIdSeq& readers,
                                           CORBA::Boolean notify_lost)
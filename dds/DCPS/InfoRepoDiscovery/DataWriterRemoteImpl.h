@@ -21,6 +21,7 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
+class InfoRepoDiscovery;
 
 /**
 * @class DataWriterRemoteImpl
@@ -31,13 +32,20 @@ namespace DCPS {
 class DataWriterRemoteImpl
   : public virtual POA_OpenDDS::DCPS::DataWriterRemote {
 public:
-  explicit DataWriterRemoteImpl(DataWriterCallbacks& parent);
+  DataWriterRemoteImpl(DataWriterCallbacks& parent, InfoRepoDiscovery& discovery);
 
   virtual ~DataWriterRemoteImpl();
 
   virtual void add_association(const ReaderAssociation& readers,
                                bool active);
 
+  virtual void add_associations(const ReaderAssociationSeq& readers,
+                                bool active);
+
+  virtual void add_association_to_writers(const WriterIdSeq& others,
+                                          const ReaderAssociation& reader,
+                                          bool active);
+
   virtual void remove_associations(const ReaderIdSeq& readers,
                                    CORBA::Boolean callback);
 
@@ -50,6 +58,7 @@ public:
 
 private:
   WeakRcHandle<DataWriterCallbacks> parent_;
+  WeakRcHandle<InfoRepoDiscovery> discovery_;
 };
 
 } // namespace DCPS
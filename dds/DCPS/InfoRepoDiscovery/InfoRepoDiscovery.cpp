@@ -672,7 +672,7 @@ InfoRepoDiscovery::add_publication(DDS::DomainId_t domainId,
   try {
     DCPS::DataWriterRemoteImpl* writer_remote_impl = 0;
     ACE_NEW_RETURN(writer_remote_impl,
-                   DataWriterRemoteImpl(*publication),
+                   DataWriterRemoteImpl(*publication, *this),
                    false);
 
     //this is taking ownership of the DataWriterRemoteImpl (server side) allocated above
@@ -782,7 +782,7 @@ InfoRepoDiscovery::add_subscription(DDS::DomainId_t domainId,
   try {
     DCPS::DataReaderRemoteImpl* reader_remote_impl = 0;
     ACE_NEW_RETURN(reader_remote_impl,
-                   DataReaderRemoteImpl(*subscription),
+                   DataReaderRemoteImpl(*subscription, *this),
                    false);
 
     //this is taking ownership of the DataReaderRemoteImpl (server side) allocated above
@@ -895,6 +895,50 @@ InfoRepoDiscovery::update_subscription_params(DDS::DomainId_t domainId,
 
 // Managing reader/writer associations:
 
+void
+InfoRepoDiscovery::add_association_to_readers(const ReaderIdSeq& readers,
+                                              const WriterAssociation& writer,
+                                              bool active)
+{
+  OPENDDS_VECTOR(DataReaderRemote_var) remotes;
+  {
+    ACE_GUARD(ACE_Thread_Mutex, g, lock_);
+    for (CORBA::ULong i = 0; i < readers.length(); ++i) {
+      const DataReaderMap::const_iterator drr = dataReaderMap_.find(readers[i]);
+      if (drr != dataReaderMap_.end()) {
+        remotes.push_back(drr->second);
+      }
+    }
+  }
+
+  // Not holding lock_, since the readers call back into discovery.
+  for (size_t i = 0; i < remotes.size(); ++i) {
+    remotes[i]->add_association(writer, active);
+  }
+}
+
+void
+InfoRepoDiscovery::add_association_to_writers(const WriterIdSeq& writers,
+                                              const ReaderAssociation& reader,
+                                              bool active)
+{
+  OPENDDS_VECTOR(DataWriterRemote_var) remotes;
+  {
+    ACE_GUARD(ACE_Thread_Mutex, g, lock_);
+    for (CORBA::ULong i = 0; i < writers.length(); ++i) {
+      const DataWriterMap::const_iterator dwr = dataWriterMap_.find(writers[i]);
+      if (dwr != dataWriterMap_.end()) {
+        remotes.push_back(dwr->second);
+      }
+    }
+  }
+
+  // Not holding lock_, since the writers call back into discovery.
+  for (size_t i = 0; i < remotes.size(); ++i) {
+    remotes[i]->add_association(reader, active);
+  }
+}
+
 void
 InfoRepoDiscovery::removeDataReaderRemote(const GUID_t& subscriptionId)
 {
@@ -218,6 +218,23 @@ public:
     const OpenDDS::DCPS::GUID_t& subscriptionId,
     const DDS::StringSeq& params);
 
+
+  // Association operations:
+
+  /// Tell each of the local readers about the writer, on behalf of a
+  /// DataReaderRemote::add_association_to_readers() from the InfoRepo
+  void add_association_to_readers(
+    const OpenDDS::DCPS::ReaderIdSeq& readers,
+    const OpenDDS::DCPS::WriterAssociation& writer,
+    bool active);
+
+  /// Tell each of the local writers about the reader, on behalf of a
+  /// DataWriterRemote::add_association_to_writers() from the InfoRepo
+  void add_association_to_writers(
+    const OpenDDS::DCPS::WriterIdSeq& writers,
+    const OpenDDS::DCPS::ReaderAssociation& reader,
+    bool active);
+
 private:
   const String name_;
   const String config_prefix_;
@@ -0,0 +1,184 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_INTRUSIVE_LIST_H
+#define OPENDDS_DCPS_INTRUSIVE_LIST_H
+
+#include "RcHandle_T.h"
+
+#include <cstddef>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+template <typename T>
+class IntrusiveListLinks;
+
+/**
+ * Doubly linked list of reference counted elements that carry their own
+ * links, so linking and unlinking an element never allocates.
+ *
+ * LinksMember names the IntrusiveListLinks<T> member of T used by this list,
+ * which lets an element be on one list per links member.  The list holds a
+ * reference to each element on it.  It does no locking.
+ */
+template <typename T, IntrusiveListLinks<T> T::*LinksMember>
+class IntrusiveList {
+public:
+  IntrusiveList()
+    : head_(0)
+    , tail_(0)
+    , size_(0)
+  {}
+
+  ~IntrusiveList()
+  {
+    clear();
+  }
+
+  bool empty() const { return head_ == 0; }
+  size_t size() const { return size_; }
+
+  T* front() const { return head_; }
+  T* back() const { return tail_; }
+
+  static T* next(const T* element) { return (element->*LinksMember).next_; }
+  static T* prev(const T* element) { return (element->*LinksMember).prev_; }
+
+  static bool is_linked(const T* element) { return (element->*LinksMember).linked_; }
+
+  void push_back(const RcHandle<T>& element)
+  {
+    insert_after(tail_, element);
+  }
+
+  /// Insert element after pos, or at the front if pos is null.  element must
+  /// not be on this list already.
+  void insert_after(T* pos, const RcHandle<T>& element)
+  {
+    T* const e = element.in();
+    IntrusiveListLinks<T>& links = e->*LinksMember;
+    links.prev_ = pos;
+    links.next_ = pos ? (pos->*LinksMember).next_ : head_;
+    links.linked_ = true;
+    if (links.next_) {
+      (links.next_->*LinksMember).prev_ = e;
+    } else {
+      tail_ = e;
+    }
+    if (pos) {
+      (pos->*LinksMember).next_ = e;
+    } else {
+      head_ = e;
+    }
+    ++size_;
+    e->_add_ref();
+  }
+
+  /// Insert element after the last element that less does not order after
+  /// it, searching from the back.  This keeps a sorted list sorted in
+  /// constant time when elements mostly arrive in order.
+  template <typename Less>
+  void insert_sorted(const RcHandle<T>& element, Less less)
+  {
+    T* pos = tail_;
+    while (pos && less(*element, *pos)) {
+      pos = prev(pos);
+    }
+    insert_after(pos, element);
+  }
+
+  /// Unlink element and return the reference the list held, or a null handle
+  /// if element was not on the list.
+  RcHandle<T> remove(T* element)
+  {
+    IntrusiveListLinks<T>& links = element->*LinksMember;
+    if (!links.linked_) {
+      return RcHandle<T>();
+    }
+    if (links.prev_) {
+      (links.prev_->*LinksMember).next_ = links.next_;
+    } else {
+      head_ = links.next_;
+    }
+    if (links.next_) {
+      (links.next_->*LinksMember).prev_ = links.prev_;
+    } else {
+      tail_ = links.prev_;
+    }
+    links.prev_ = links.next_ = 0;
+    links.linked_ = false;
+    --size_;
+    return RcHandle<T>(element, keep_count());
+  }
+
+  RcHandle<T> pop_front()
+  {
+    return head_ ? remove(head_) : RcHandle<T>();
+  }
+
+  /// Move element, which must be on this list, to the back.
+  void move_to_back(T* element)
+  {
+    if (element != tail_) {
+      push_back(remove(element));
+    }
+  }
+
+  void clear()
+  {
+    while (head_) {
+      pop_front();
+    }
+  }
+
+private:
+  IntrusiveList(const IntrusiveList&);
+  IntrusiveList& operator=(const IntrusiveList&);
+
+  T* head_;
+  T* tail_;
+  size_t size_;
+};
+
+/// Links of an element of an IntrusiveList.
+template <typename T>
+class IntrusiveListLinks {
+public:
+  IntrusiveListLinks()
+    : prev_(0)
+    , next_(0)
+    , linked_(false)
+  {}
+
+  // Copying an element does not put the copy on a list.
+  IntrusiveListLinks(const IntrusiveListLinks&)
+    : prev_(0)
+    , next_(0)
+    , linked_(false)
+  {}
+
+  IntrusiveListLinks& operator=(const IntrusiveListLinks&)
+  {
+    return *this;
+  }
+
+private:
+  template <typename U, IntrusiveListLinks<U> U::*>
+  friend class IntrusiveList;
+
+  T* prev_;
+  T* next_;
+  bool linked_;
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_DCPS_INTRUSIVE_LIST_H
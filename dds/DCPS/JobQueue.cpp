@@ -25,23 +25,14 @@ int JobQueue::handle_exception(ACE_HANDLE /*fd*/)
 {
   ThreadStatusManager::Event ev(TheServiceParticipant->get_thread_status_manager());
 
-  Queue q;
+  // Jobs enqueued after this find the queue empty and notify again.
+  Queue::Batch q;
+  job_queue_.take_all(q);
 
-  {
-    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, mutex_, -1);
-    q.swap(job_queue_);
-  }
-
-  for (Queue::const_iterator pos = q.begin(), limit = q.end(); pos != limit; ++pos) {
+  for (Queue::Batch::const_iterator pos = q.begin(), limit = q.end(); pos != limit; ++pos) {
     (*pos)->execute();
   }
 
-  ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, mutex_, -1);
-  if (!job_queue_.empty()) {
-    guard.release();
-    reactor()->notify(this);
-  }
-
   return 0;
 }
 
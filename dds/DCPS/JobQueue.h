@@ -9,6 +9,7 @@
 #define OPENDDS_DCPS_JOB_QUEUE_H
 
 #include "RcEventHandler.h"
+#include "MpscQueue.h"
 #include "PoolAllocator.h"
 #include "dcps_export.h"
 
@@ -60,18 +61,15 @@ public:
 
   void enqueue(JobPtr job)
   {
-    ACE_GUARD(ACE_Thread_Mutex, guard, mutex_);
-    const bool empty = job_queue_.empty();
-    job_queue_.push_back(job);
-    if (empty) {
-      guard.release();
+    // Only the job that finds the queue empty notifies, the rest are picked
+    // up by the same handle_exception.
+    if (job_queue_.push(job)) {
       reactor()->notify(this);
     }
   }
 
 private:
-  ACE_Thread_Mutex mutex_;
-  typedef OPENDDS_VECTOR(JobPtr) Queue;
+  typedef MpscQueue<JobPtr> Queue;
   Queue job_queue_;
 
   int handle_exception(ACE_HANDLE /*fd*/);
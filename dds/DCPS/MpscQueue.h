@@ -0,0 +1,148 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_MPSC_QUEUE_H
+#define OPENDDS_DCPS_MPSC_QUEUE_H
+
+#include "Atomic.h"
+#include "PoolAllocationBase.h"
+#include "PoolAllocator.h"
+
+#ifndef ACE_HAS_CPP11
+#  include <ace/Guard_T.h>
+#  include <ace/Thread_Mutex.h>
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/**
+ * Unbounded queue with many producers and a consumer that takes everything
+ * queued so far at once.
+ *
+ * Producers push onto a linked stack with a compare-and-swap and the
+ * consumer detaches the whole stack with an exchange, so neither side
+ * blocks the other.  push() reports the empty to non-empty transition so
+ * that only one producer per batch wakes the consumer.  Without C++11
+ * atomics the stack is guarded by a mutex instead.
+ */
+template <typename T>
+class MpscQueue {
+public:
+  typedef OPENDDS_VECTOR(T) Batch;
+
+  MpscQueue()
+    : head_(0)
+  {}
+
+  ~MpscQueue()
+  {
+    Node* node = head_;
+    while (node) {
+      Node* const next = node->next;
+      delete node;
+      node = next;
+    }
+  }
+
+  /// Returns true if the queue was empty, i.e. the consumer needs to be
+  /// notified.
+  bool push(const T& value)
+  {
+    Node* const node = new Node(value);
+    // Once node is published the consumer may take and delete it, so the old
+    // head is checked from a local.
+#ifdef ACE_HAS_CPP11
+    Node* head = head_.load(std::memory_order_relaxed);
+    do {
+      node->next = head;
+    } while (!head_.compare_exchange_weak(head, node,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+#else
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+    Node* const head = head_;
+    node->next = head;
+    head_ = node;
+#endif
+    return head == 0;
+  }
+
+  /// Append everything pushed so far to batch, oldest first.  Returns false
+  /// if the queue was empty.
+  bool take_all(Batch& batch)
+  {
+#ifdef ACE_HAS_CPP11
+    Node* node = head_.exchange(0, std::memory_order_acquire);
+#else
+    Node* node;
+    {
+      ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+      node = head_;
+      head_ = 0;
+    }
+#endif
+    if (!node) {
+      return false;
+    }
+
+    // The stack is newest first.
+    Node* oldest = 0;
+    while (node) {
+      Node* const next = node->next;
+      node->next = oldest;
+      oldest = node;
+      node = next;
+    }
+
+    while (oldest) {
+      Node* const next = oldest->next;
+      batch.push_back(oldest->value);
+      delete oldest;
+      oldest = next;
+    }
+    return true;
+  }
+
+  bool empty() const
+  {
+#ifdef ACE_HAS_CPP11
+    return head_.load(std::memory_order_relaxed) == 0;
+#else
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+    return head_ == 0;
+#endif
+  }
+
+private:
+  MpscQueue(const MpscQueue&);
+  MpscQueue& operator=(const MpscQueue&);
+
+  struct Node : public PoolAllocationBase {
+    explicit Node(const T& v)
+      : value(v)
+      , next(0)
+    {}
+
+    T value;
+    Node* next;
+  };
+
+#ifdef ACE_HAS_CPP11
+  Atomic<Node*> head_;
+#else
+  mutable ACE_Thread_Mutex mutex_;
+  Node* head_;
+#endif
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_DCPS_MPSC_QUEUE_H
@@ -0,0 +1,293 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
+
+#include "PartitionMatcher.h"
+
+#include "DCPS_Utils.h"
+
+#include <ace/ACE.h>
+#include <ace/Guard_T.h>
+#include <ace/Singleton.h>
+
+#include <cstring>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+PartitionPattern::PartitionPattern(const char* name)
+  : name_(name)
+  , wildcard_(is_wildcard(name))
+  , malformed_(false)
+{
+  if (wildcard_) {
+    compile();
+  }
+}
+
+void PartitionPattern::compile()
+{
+  const size_t length = name_.size();
+  for (size_t pos = 0; pos < length; ++pos) {
+    char c = name_[pos];
+    if (c == '*') {
+      // Consecutive stars are the same as one.
+      if (tokens_.empty() || tokens_.back().kind != Token::ANY_STRING) {
+        tokens_.push_back(Token(Token::ANY_STRING));
+      }
+      continue;
+    }
+    if (c == '?') {
+      tokens_.push_back(Token(Token::ANY_CHAR));
+      continue;
+    }
+    if (c == '[') {
+      Token token(Token::CHAR_CLASS);
+      size_t end = pos;
+      if (!compile_class(end, token)) {
+        malformed_ = true;
+        tokens_.clear();
+        return;
+      }
+      tokens_.push_back(token);
+      pos = end;
+      continue;
+    }
+    if (c == '\\') {
+      if (pos + 1 == length) {
+        malformed_ = true;
+        tokens_.clear();
+        return;
+      }
+      c = name_[++pos];
+    }
+    if (tokens_.empty() || tokens_.back().kind != Token::LITERAL) {
+      tokens_.push_back(Token(Token::LITERAL));
+    }
+    tokens_.back().chars += c;
+  }
+}
+
+bool PartitionPattern::compile_class(size_t& pos, Token& token) const
+{
+  const size_t length = name_.size();
+  size_t i = pos + 1;
+  if (i < length && name_[i] == '!') {
+    token.negate = true;
+    ++i;
+  }
+  // "]" is a member if it's first.
+  for (bool first = true; i < length && (first || name_[i] != ']'); ++i, first = false) {
+    const char c = name_[i];
+    if (!first && c == '-' && i + 1 < length && name_[i + 1] != ']') {
+      const unsigned char low = static_cast<unsigned char>(name_[i - 1]);
+      const unsigned char high = static_cast<unsigned char>(name_[i + 1]);
+      // An empty range is ignored.
+      for (unsigned int r = low + 1u; r <= high; ++r) {
+        token.chars += static_cast<char>(r);
+      }
+      if (high > low) {
+        ++i;
+      }
+    } else {
+      token.chars += c;
+    }
+  }
+  if (i >= length) {
+    return false;
+  }
+  pos = i;
+  return true;
+}
+
+bool PartitionPattern::matches_token(const Token& token, const char* name, size_t pos, size_t length)
+{
+  switch (token.kind) {
+  case Token::LITERAL:
+    return token.chars.size() <= length - pos
+      && std::memcmp(token.chars.data(), name + pos, token.chars.size()) == 0;
+  case Token::ANY_CHAR:
+    return pos < length;
+  case Token::CHAR_CLASS:
+    return pos < length && (token.chars.find(name[pos]) != String::npos) != token.negate;
+  default:
+    return false;
+  }
+}
+
+bool PartitionPattern::matches(const char* name) const
+{
+  if (!wildcard_) {
+    return name_ == name;
+  }
+  if (malformed_) {
+    return ACE::wild_match(name, name_.c_str(), true, true);
+  }
+
+  // Every token other than "*" matches a fixed number of characters, so when
+  // something doesn't match it's enough to retry from the last "*" with it
+  // taking one more character.
+  const size_t length = std::strlen(name);
+  const size_t no_star = tokens_.size();
+  size_t star = no_star;
+  size_t star_pos = 0;
+  size_t t = 0;
+  size_t pos = 0;
+  while (pos < length || t < tokens_.size()) {
+    if (t < tokens_.size()) {
+      const Token& token = tokens_[t];
+      if (token.kind == Token::ANY_STRING) {
+        if (++t == tokens_.size()) {
+          return true;
+        }
+        star = t;
+        star_pos = pos;
+        continue;
+      }
+      if (matches_token(token, name, pos, length)) {
+        pos += token.kind == Token::LITERAL ? token.chars.size() : 1;
+        ++t;
+        continue;
+      }
+    }
+    if (star == no_star || star_pos >= length) {
+      return false;
+    }
+    t = star;
+    pos = ++star_pos;
+  }
+  return true;
+}
+
+bool PartitionPattern::matches(const PartitionPattern& other) const
+{
+  if (wildcard_ && other.wildcard_) {
+    return false; // wildcards never match
+  }
+  if (wildcard_) {
+    return matches(other.name_.c_str());
+  }
+  return other.matches(name_.c_str());
+}
+
+PartitionMatcher::PartitionMatcher()
+  : next_id_(0)
+  , verdict_hits_(0)
+  , verdict_misses_(0)
+{
+}
+
+PartitionMatcher* PartitionMatcher::instance()
+{
+  return ACE_Singleton<PartitionMatcher, ACE_SYNCH_MUTEX>::instance();
+}
+
+bool PartitionMatcher::matches(const DDS::PartitionQosPolicy& pub, const DDS::PartitionQosPolicy& sub)
+{
+  ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+
+  // Clear before interning so that neither set is removed while in use.  Ids
+  // aren't reused, so verdicts for the old sets can't be mistaken for new
+  // ones.
+  if (sets_.size() + 2 > MAX_SETS) {
+    sets_.clear();
+    verdicts_.clear();
+  }
+  const PartitionSet& pub_set = intern(pub);
+  const PartitionSet& sub_set = intern(sub);
+
+  const SetPair key(pub_set.id, sub_set.id);
+  const VerdictMap::const_iterator pos = verdicts_.find(key);
+  if (pos != verdicts_.end()) {
+    ++verdict_hits_;
+    return pos->second;
+  }
+
+  ++verdict_misses_;
+  if (verdicts_.size() >= MAX_VERDICTS) {
+    verdicts_.clear();
+  }
+  const bool verdict = evaluate(pub_set, sub_set);
+  verdicts_[key] = verdict;
+  return verdict;
+}
+
+size_t PartitionMatcher::verdict_hits() const
+{
+  ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+  return verdict_hits_;
+}
+
+size_t PartitionMatcher::verdict_misses() const
+{
+  ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+  return verdict_misses_;
+}
+
+const PartitionMatcher::PartitionSet& PartitionMatcher::intern(const DDS::PartitionQosPolicy& partition)
+{
+  // Names are kept with their terminators so that an empty list and a list
+  // with an empty name have different keys.
+  String key;
+  for (CORBA::ULong i = 0; i < partition.name.length(); ++i) {
+    const char* const name = partition.name[i];
+    key.append(name, std::strlen(name) + 1);
+  }
+
+  const std::pair<SetMap::iterator, bool> result = sets_.insert(SetMap::value_type(key, PartitionSet()));
+  PartitionSet& set = result.first->second;
+  if (result.second) {
+    set.id = next_id_++;
+    set.is_default = partition.name.length() == 0;
+    set.names.reserve(partition.name.length());
+    for (CORBA::ULong i = 0; i < partition.name.length(); ++i) {
+      set.names.push_back(PartitionPattern(partition.name[i]));
+      if (set.names.back().name().empty()) {
+        set.is_default = true;
+      }
+    }
+  }
+  return set;
+}
+
+bool PartitionMatcher::matches_name(const PartitionSet& set, const PartitionPattern& name)
+{
+  for (size_t i = 0; i < set.names.size(); ++i) {
+    if (set.names[i].matches(name)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool PartitionMatcher::evaluate(const PartitionSet& pub, const PartitionSet& sub)
+{
+  if (pub.is_default) {
+    if (sub.is_default) {
+      return true;
+    }
+
+    // Zero-length sequences should be treated the same as a
+    // sequence of length 1 that contains an empty string:
+    if (pub.names.empty()) {
+      return matches_name(sub, PartitionPattern(""));
+    }
+  }
+
+  for (size_t i = 0; i < pub.names.size(); ++i) {
+    if (matches_name(sub, pub.names[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,137 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_PARTITION_MATCHER_H
+#define OPENDDS_DCPS_PARTITION_MATCHER_H
+
+#include "dcps_export.h"
+#include "PoolAllocator.h"
+
+#include <dds/DdsDcpsInfrastructureC.h>
+
+#include <ace/Thread_Mutex.h>
+
+#if !defined (ACE_LACKS_PRAGMA_ONCE)
+#pragma once
+#endif /* ACE_LACKS_PRAGMA_ONCE */
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/**
+ * A partition name with its wildcards, if any, parsed once.
+ *
+ * Wildcard patterns use the same syntax as ACE::wild_match() with character
+ * classes: "?", "*", "[abc]", "[a-z]", "[!abc]", and "\" to escape the next
+ * character.  Patterns with a "[" without a closing "]" or ending with an
+ * unescaped "\" are passed to ACE::wild_match() as they are, so that they
+ * match the same names as before.  Names without wildcards are compared as
+ * they are.
+ */
+class OpenDDS_Dcps_Export PartitionPattern {
+public:
+  explicit PartitionPattern(const char* name);
+
+  const String& name() const { return name_; }
+  bool wildcard() const { return wildcard_; }
+  /// A wildcard that isn't compiled, see above.
+  bool malformed() const { return malformed_; }
+
+  /// True if "name", which is taken literally, matches this pattern.
+  bool matches(const char* name) const;
+
+  /// True if either name matches the other.  Two wildcards never match.
+  bool matches(const PartitionPattern& other) const;
+
+private:
+  struct Token {
+    enum Kind { LITERAL, ANY_CHAR, ANY_STRING, CHAR_CLASS };
+
+    explicit Token(Kind k)
+      : kind(k)
+      , negate(false)
+    {}
+
+    Kind kind;
+    /// The characters of a LITERAL or the members of a CHAR_CLASS.
+    String chars;
+    bool negate;
+  };
+  typedef OPENDDS_VECTOR(Token) Tokens;
+
+  void compile();
+  /// Parse the class starting at the "[" at "pos".  Returns false if it
+  /// isn't closed.
+  bool compile_class(size_t& pos, Token& token) const;
+  static bool matches_token(const Token& token, const char* name, size_t pos, size_t length);
+
+  String name_;
+  bool wildcard_;
+  bool malformed_;
+  Tokens tokens_;
+};
+
+/**
+ * Decides if the partitions of a publisher and a subscriber match, the same
+ * way as matching_partitions().
+ *
+ * Each distinct list of partition names is interned and compiled the first
+ * time it's seen, and the verdict for each pair of lists is cached, so
+ * checking endpoints with the same partitions again is a lookup.  Both are
+ * bounded and cleared when full.
+ */
+class OpenDDS_Dcps_Export PartitionMatcher {
+public:
+  PartitionMatcher();
+
+  /// The matcher used by matching_partitions().
+  static PartitionMatcher* instance();
+
+  bool matches(const DDS::PartitionQosPolicy& pub, const DDS::PartitionQosPolicy& sub);
+
+  size_t verdict_hits() const;
+  size_t verdict_misses() const;
+
+  /// Bound on the number of interned partition lists.
+  static const size_t MAX_SETS = 1024;
+
+  /// Bound on the number of cached verdicts.
+  static const size_t MAX_VERDICTS = 4096;
+
+private:
+  typedef unsigned int SetId;
+
+  struct PartitionSet {
+    PartitionSet() : id(0), is_default(false) {}
+    SetId id;
+    /// Empty or has an empty name.
+    bool is_default;
+    OPENDDS_VECTOR(PartitionPattern) names;
+  };
+  typedef OPENDDS_MAP(String, PartitionSet) SetMap;
+
+  typedef std::pair<SetId, SetId> SetPair;
+  typedef OPENDDS_MAP(SetPair, bool) VerdictMap;
+
+  const PartitionSet& intern(const DDS::PartitionQosPolicy& partition);
+  static bool evaluate(const PartitionSet& pub, const PartitionSet& sub);
+  static bool matches_name(const PartitionSet& set, const PartitionPattern& name);
+
+  mutable ACE_Thread_Mutex mutex_;
+  SetMap sets_;
+  SetId next_id_;
+  VerdictMap verdicts_;
+  size_t verdict_hits_;
+  size_t verdict_misses_;
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* OPENDDS_DCPS_PARTITION_MATCHER_H */
@@ -10,6 +10,7 @@
 
 #include "dcps_export.h"
 #include "InstanceDataSampleList.h"
+#include "IntrusiveList.h"
 #include "DataSampleElement.h"
 #include "PoolAllocationBase.h"
 #include "ace/Synch_Traits.h"
@@ -72,6 +73,9 @@ struct OpenDDS_Dcps_Export PublicationInstance : public virtual RcObject {
 
   /// Deadline for Deadline QoS.
   MonotonicTimePoint deadline_;
+
+  /// Position in the WriteDataContainer's deadline queue.
+  IntrusiveListLinks<PublicationInstance> deadline_links_;
 };
 
 typedef RcHandle<PublicationInstance> PublicationInstance_rch;
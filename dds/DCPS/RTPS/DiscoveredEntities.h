@@ -14,6 +14,7 @@
 
 #include <dds/DCPS/Definitions.h>
 #include <dds/DCPS/FibonacciSequence.h>
+#include <dds/DCPS/Hash.h>
 #include <dds/DCPS/PoolAllocationBase.h>
 #include <dds/DCPS/SequenceNumber.h>
 
@@ -21,6 +22,8 @@
 #  include "RtpsSecurityC.h"
 #endif
 
+#include <cstring>
+
 #ifndef ACE_LACKS_PRAGMA_ONCE
 #  pragma once
 #endif
@@ -49,6 +52,30 @@ typedef Security::SPDPdiscoveredParticipantData ParticipantData_t;
 typedef SPDPdiscoveredParticipantData ParticipantData_t;
 #endif
 
+/// Digest of the serialized payload of the last announcement applied for a
+/// discovered entity.  Announcements are resent periodically and are almost
+/// always unchanged, so a matching digest means the announcement only needs
+/// to renew liveliness and doesn't have to be deserialized and applied again.
+struct AnnouncementDigest {
+  AnnouncementDigest()
+    : valid_(false)
+  {}
+
+  AnnouncementDigest(const ACE_Message_Block& payload, size_t size)
+    : valid_(true)
+  {
+    DCPS::MD5Hash(md5_, payload, size);
+  }
+
+  bool operator==(const AnnouncementDigest& other) const
+  {
+    return valid_ && other.valid_ && std::memcmp(md5_, other.md5_, sizeof md5_) == 0;
+  }
+
+  bool valid_;
+  DCPS::MD5Result md5_;
+};
+
 struct DiscoveredParticipant {
   DiscoveredParticipant()
     : location_ih_(DDS::HANDLE_NIL)
@@ -155,6 +182,7 @@ struct DiscoveredParticipant {
   DDS::InstanceHandle_t bit_ih_;
   DCPS::SequenceNumber max_seq_;
   ACE_UINT16 seq_reset_count_;
+  AnnouncementDigest spdp_digest_;
   typedef OPENDDS_LIST(BuiltinAssociationRecord) BuiltinAssociationRecords;
   BuiltinAssociationRecords builtin_pending_records_;
   BuiltinAssociationRecords builtin_associated_records_;
@@ -176,6 +204,8 @@ struct DiscoveredParticipant {
   DCPS::FibonacciSequence<DCPS::TimeDuration> handshake_resend_falloff_;
   DCPS::MonotonicTimePoint stateless_msg_deadline_;
 
+  /// When attempt_authentication started the current handshake.
+  DCPS::MonotonicTimePoint handshake_start_;
   DCPS::MonotonicTimePoint handshake_deadline_;
   AuthState auth_state_;
   HandshakeState handshake_state_;
@@ -245,6 +275,7 @@ struct DiscoveredSubscription : DCPS::PoolAllocationBase {
 
   DCPS::RepoIdSet matched_endpoints_;
   DCPS::DiscoveredReaderData reader_data_;
+  AnnouncementDigest digest_;
   DDS::InstanceHandle_t bit_ih_;
   DCPS::MonotonicTime_t participant_discovered_at_;
   ACE_CDR::ULong transport_context_;
@@ -305,6 +336,7 @@ struct DiscoveredPublication : DCPS::PoolAllocationBase {
 
   DCPS::RepoIdSet matched_endpoints_;
   DCPS::DiscoveredWriterData writer_data_;
+  AnnouncementDigest digest_;
   DDS::InstanceHandle_t bit_ih_;
   DCPS::MonotonicTime_t participant_discovered_at_;
   ACE_CDR::ULong transport_context_;
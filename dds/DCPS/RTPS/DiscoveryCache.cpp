@@ -0,0 +1,212 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "DiscoveryCache.h"
+
+#include <dds/DCPS/Serializer.h>
+#include <dds/DCPS/NetworkResource.h>
+
+#include <ace/OS_NS_stdio.h>
+#include <ace/OS_NS_unistd.h>
+
+#include <fstream>
+#include <iterator>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace RTPS {
+
+using DCPS::String;
+
+namespace {
+  const ACE_CDR::ULong prefix_size = sizeof(DCPS::GuidPrefix_t);
+  const ACE_CDR::ULong address_size = sizeof(DCPS::Locator_t().address);
+
+  bool matches_identifier(const XTypes::TypeIdentifierTypeObjectPair& pair)
+  {
+    const XTypes::TypeIdentifier& ti = pair.type_identifier;
+    if ((ti.kind() != XTypes::EK_MINIMAL && ti.kind() != XTypes::EK_COMPLETE) ||
+        pair.type_object.kind != ti.kind()) {
+      return false;
+    }
+    return XTypes::makeTypeIdentifier(pair.type_object) == ti;
+  }
+
+  bool write_expires(DCPS::Serializer& ser, const DCPS::SystemTimePoint& expires)
+  {
+    const DDS::Time_t time = expires.to_dds_time();
+    return (ser << time.sec) && (ser << time.nanosec);
+  }
+
+  bool read_expires(DCPS::Serializer& ser, DCPS::SystemTimePoint& expires)
+  {
+    DDS::Time_t time;
+    if (!(ser >> time.sec) || !(ser >> time.nanosec)) {
+      return false;
+    }
+    expires = DCPS::SystemTimePoint(time);
+    return true;
+  }
+
+  /// Keep the entry of "from" that expires later.
+  template <typename Map>
+  void merge_later(Map& into, const Map& from)
+  {
+    for (typename Map::const_iterator it = from.begin(); it != from.end(); ++it) {
+      const std::pair<typename Map::iterator, bool> pos = into.insert(*it);
+      if (!pos.second && pos.first->second.expires < it->second.expires) {
+        pos.first->second = it->second;
+      }
+    }
+  }
+}
+
+const ACE_CDR::ULong DiscoveryCache::MAGIC;
+const ACE_CDR::ULong DiscoveryCache::VERSION;
+
+bool DiscoveryCache::load(const String& path, const DCPS::SystemTimePoint& now)
+{
+  participants.clear();
+  types.length(0);
+
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  const String contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  ACE_Message_Block buffer(contents.size());
+  buffer.copy(contents.data(), contents.size());
+
+  DCPS::Serializer ser(&buffer, XTypes::get_typeobject_encoding());
+  ACE_CDR::ULong magic, version, count;
+  if (!(ser >> magic) || magic != MAGIC || !(ser >> version) || version != VERSION ||
+      !(ser >> count)) {
+    return false;
+  }
+
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    DCPS::GUID_t guid = DCPS::GUID_UNKNOWN;
+    DCPS::Locator_t locator;
+    Participant participant;
+    if (!ser.read_octet_array(guid.guidPrefix, prefix_size) ||
+        !(ser >> locator.kind) || !(ser >> locator.port) ||
+        !ser.read_octet_array(locator.address, address_size) ||
+        !read_expires(ser, participant.expires)) {
+      return false;
+    }
+    guid.entityId = DCPS::ENTITYID_PARTICIPANT;
+
+    ACE_INET_Addr address;
+    if (participant.expires > now && DCPS::locator_to_address(address, locator, false) == 0) {
+      participant.address = DCPS::NetworkAddress(address);
+      participants[guid] = participant;
+    }
+  }
+
+  if (!(ser >> count)) {
+    return false;
+  }
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    XTypes::TypeIdentifierTypeObjectPair pair;
+    if (!(ser >> pair)) {
+      return false;
+    }
+    if (matches_identifier(pair)) {
+      types.append(pair);
+    }
+  }
+  return true;
+}
+
+void DiscoveryCache::merge(const DiscoveryCache& other)
+{
+  merge_later(participants, other.participants);
+
+  OPENDDS_SET(XTypes::TypeIdentifier) have;
+  for (CORBA::ULong i = 0; i < types.length(); ++i) {
+    have.insert(types[i].type_identifier);
+  }
+  for (CORBA::ULong i = 0; i < other.types.length(); ++i) {
+    if (have.insert(other.types[i].type_identifier).second) {
+      types.append(other.types[i]);
+    }
+  }
+}
+
+bool DiscoveryCache::save(const String& path, const DCPS::SystemTimePoint& now,
+                          const DCPS::GUID_t& writer) const
+{
+  // Whatever another participant saved since this one loaded the file.  If
+  // two save at once, the one that renames first loses its new entries
+  // until it saves again.
+  DiscoveryCache merged;
+  merged.load(path, now);
+  merged.merge(*this);
+  return merged.write(path, writer);
+}
+
+bool DiscoveryCache::write(const String& path, const DCPS::GUID_t& writer) const
+{
+  const DCPS::Encoding& encoding = XTypes::get_typeobject_encoding();
+  size_t size = 0;
+  DCPS::primitive_serialized_size_ulong(encoding, size, 3);
+  for (ParticipantMap::const_iterator it = participants.begin(); it != participants.end(); ++it) {
+    DCPS::primitive_serialized_size_octet(encoding, size, prefix_size);
+    DCPS::primitive_serialized_size_ulong(encoding, size, 2);
+    DCPS::primitive_serialized_size_octet(encoding, size, address_size);
+    DCPS::primitive_serialized_size_ulong(encoding, size, 2);
+  }
+  DCPS::primitive_serialized_size_ulong(encoding, size);
+  for (CORBA::ULong i = 0; i < types.length(); ++i) {
+    DCPS::serialized_size(encoding, size, types[i]);
+  }
+
+  ACE_Message_Block buffer(size);
+  DCPS::Serializer ser(&buffer, encoding);
+  bool ok = (ser << MAGIC) && (ser << VERSION) &&
+    (ser << static_cast<ACE_CDR::ULong>(participants.size()));
+  for (ParticipantMap::const_iterator it = participants.begin(); ok && it != participants.end(); ++it) {
+    DCPS::Locator_t locator;
+    DCPS::address_to_locator(locator, it->second.address.to_addr());
+    ok = ser.write_octet_array(it->first.guidPrefix, prefix_size) &&
+      (ser << locator.kind) && (ser << locator.port) &&
+      ser.write_octet_array(locator.address, address_size) &&
+      write_expires(ser, it->second.expires);
+  }
+  ok = ok && (ser << types.length());
+  for (CORBA::ULong i = 0; ok && i < types.length(); ++i) {
+    ok = ser << types[i];
+  }
+  if (!ok) {
+    return false;
+  }
+
+  // Every participant sharing the file writes its own temporary file.
+  String temp = path + ".";
+  for (size_t i = 0; i < prefix_size; ++i) {
+    char hex[3];
+    ACE_OS::snprintf(hex, sizeof hex, "%02x", writer.guidPrefix[i]);
+    temp += hex;
+  }
+  {
+    std::ofstream file(temp.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file.write(buffer.rd_ptr(), buffer.length()) || !file.flush()) {
+      file.close();
+      ACE_OS::unlink(temp.c_str());
+      return false;
+    }
+  }
+  if (ACE_OS::rename(temp.c_str(), path.c_str()) != 0) {
+    ACE_OS::unlink(temp.c_str());
+    return false;
+  }
+  return true;
+}
+
+} // namespace RTPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,82 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+#ifndef OPENDDS_DCPS_RTPS_DISCOVERY_CACHE_H
+#define OPENDDS_DCPS_RTPS_DISCOVERY_CACHE_H
+
+#include "rtps_export.h"
+
+#include <dds/Versioned_Namespace.h>
+
+#include <dds/DCPS/GuidUtils.h>
+#include <dds/DCPS/NetworkAddress.h>
+#include <dds/DCPS/PoolAllocator.h>
+#include <dds/DCPS/TimeTypes.h>
+#include <dds/DCPS/XTypes/TypeObject.h>
+
+#ifndef ACE_LACKS_PRAGMA_ONCE
+#  pragma once
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace RTPS {
+
+/**
+ * What the participants of a domain have discovered, saved to a file so that
+ * a restarted process doesn't have to start over.
+ *
+ * Everything loaded is provisional.  Participants are only used as extra
+ * destinations for SPDP announcements until they announce themselves or
+ * their lease runs out, so they still have to be discovered as usual, just
+ * sooner.  A type object is only kept if its type identifier, which is a
+ * hash of the type object, still matches it, and then doesn't have to be
+ * requested with the type lookup service.  Endpoints aren't cached: they
+ * couldn't be matched before SEDP announces them again, since their QoS and
+ * locators may have changed, and their types are in the type objects.
+ */
+class OpenDDS_Rtps_Export DiscoveryCache {
+public:
+  struct Participant {
+    /// Where the participant's announcements came from.
+    DCPS::NetworkAddress address;
+    /// When the participant's lease runs out.
+    DCPS::SystemTimePoint expires;
+  };
+  typedef OPENDDS_MAP_CMP(DCPS::GUID_t, Participant, DCPS::GUID_tKeyLessThan) ParticipantMap;
+
+  ParticipantMap participants;
+  XTypes::TypeIdentifierTypeObjectPairSeq types;
+
+  /// Replace the contents with those of the file at "path".  Participants
+  /// whose lease has run out by "now" and type objects that
+  /// don't match their identifiers are left out.
+  bool load(const DCPS::String& path, const DCPS::SystemTimePoint& now);
+
+  /// Add what "other" has that this doesn't.  For participants in both, the
+  /// one with the later expiration is kept.
+  void merge(const DiscoveryCache& other);
+
+  /// Merge the contents into the file at "path", which all the participants
+  /// of a domain share, so that entries saved by others that haven't
+  /// expired by "now" are kept.  The result is written to a temporary file
+  /// named after "writer", the participant saving, and renamed to "path" so
+  /// that a reader never sees a partial file.
+  bool save(const DCPS::String& path, const DCPS::SystemTimePoint& now,
+            const DCPS::GUID_t& writer) const;
+
+  static const ACE_CDR::ULong MAGIC = 0x4f444443; // "ODDC"
+  static const ACE_CDR::ULong VERSION = 3;
+
+private:
+  bool write(const DCPS::String& path, const DCPS::GUID_t& writer) const;
+};
+
+} // namespace RTPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_DCPS_RTPS_DISCOVERY_CACHE_H
@@ -0,0 +1,450 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "EndpointMatchIndex.h"
+
+#include <dds/DCPS/DCPS_Utils.h>
+#include <dds/DCPS/GuidConverter.h>
+
+#include <algorithm>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace RTPS {
+
+namespace {
+  // An empty partition sequence is the default partition, the same as a
+  // sequence holding only the empty string.
+  void partition_names(const DDS::PartitionQosPolicy& partition, OPENDDS_VECTOR(String)& names)
+  {
+    names.clear();
+    for (CORBA::ULong i = 0; i < partition.name.length(); ++i) {
+      names.push_back(partition.name[i].in());
+    }
+    if (names.empty()) {
+      names.push_back(String());
+    }
+  }
+
+  template <typename T>
+  void append(String& key, const T& value)
+  {
+    key.append(reinterpret_cast<const char*>(&value), sizeof value);
+  }
+
+  void append(String& key, const DDS::Duration_t& value)
+  {
+    append(key, value.sec);
+    append(key, value.nanosec);
+  }
+
+  /// Everything DCPS::compatibleQOS() looks at except the transports and
+  /// the partitions.
+  template <typename EntityQos, typename GroupQos>
+  String profile_key(bool reader, const EntityQos& qos, const GroupQos& group)
+  {
+    String key;
+    append(key, reader);
+    append(key, qos.reliability.kind);
+    append(key, qos.durability.kind);
+    append(key, qos.liveliness.kind);
+    append(key, qos.liveliness.lease_duration);
+    append(key, qos.deadline.period);
+    append(key, qos.latency_budget.duration);
+    append(key, qos.ownership.kind);
+    append(key, qos.representation.value.length());
+    for (CORBA::ULong i = 0; i < qos.representation.value.length(); ++i) {
+      append(key, qos.representation.value[i]);
+    }
+    append(key, group.presentation.access_scope);
+    append(key, group.presentation.coherent_access);
+    append(key, group.presentation.ordered_access);
+    return key;
+  }
+
+  template <typename FromQos, typename FromGroup, typename ToQos, typename ToGroup>
+  void copy_policies(const FromQos& from, const FromGroup& from_group, ToQos& to, ToGroup& to_group)
+  {
+    to.reliability = from.reliability;
+    to.durability = from.durability;
+    to.liveliness = from.liveliness;
+    to.deadline = from.deadline;
+    to.latency_budget = from.latency_budget;
+    to.ownership = from.ownership;
+    to.representation = from.representation;
+    to_group.presentation = from_group.presentation;
+  }
+
+  // Copy the policies of a writer or reader into the profile members for it.
+  void store(const DDS::DataWriterQos& qos, const DDS::PublisherQos& group,
+             DDS::DataWriterQos& writer_qos, DDS::PublisherQos& publisher_qos,
+             DDS::DataReaderQos&, DDS::SubscriberQos&)
+  {
+    copy_policies(qos, group, writer_qos, publisher_qos);
+  }
+
+  void store(const DDS::DataReaderQos& qos, const DDS::SubscriberQos& group,
+             DDS::DataWriterQos&, DDS::PublisherQos&,
+             DDS::DataReaderQos& reader_qos, DDS::SubscriberQos& subscriber_qos)
+  {
+    copy_policies(qos, group, reader_qos, subscriber_qos);
+  }
+
+  void store(const DDS::PublicationBuiltinTopicData& data, const DDS::PublicationBuiltinTopicData&,
+             DDS::DataWriterQos& writer_qos, DDS::PublisherQos& publisher_qos,
+             DDS::DataReaderQos&, DDS::SubscriberQos&)
+  {
+    copy_policies(data, data, writer_qos, publisher_qos);
+  }
+
+  void store(const DDS::SubscriptionBuiltinTopicData& data, const DDS::SubscriptionBuiltinTopicData&,
+             DDS::DataWriterQos&, DDS::PublisherQos&,
+             DDS::DataReaderQos& reader_qos, DDS::SubscriberQos& subscriber_qos)
+  {
+    copy_policies(data, data, reader_qos, subscriber_qos);
+  }
+
+  void transport_types(const DCPS::TransportLocatorSeq& locators, OPENDDS_VECTOR(String)& types)
+  {
+    types.clear();
+    for (CORBA::ULong i = 0; i < locators.length(); ++i) {
+      types.push_back(locators[i].transport_type.in());
+    }
+  }
+
+  bool common_transport(const OPENDDS_VECTOR(String)& a, const OPENDDS_VECTOR(String)& b)
+  {
+    for (size_t i = 0; i < a.size(); ++i) {
+      if (std::find(b.begin(), b.end(), a[i]) != b.end()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void replay(const DCPS::IncompatibleQosStatus& from, DCPS::IncompatibleQosStatus& to)
+  {
+    for (CORBA::ULong i = 0; i < from.policies.length(); ++i) {
+      for (CORBA::Long count = 0; count < from.policies[i].count; ++count) {
+        DCPS::increment_incompatibility_count(&to, from.policies[i].policy_id);
+      }
+    }
+  }
+}
+
+EndpointMatchIndex::EndpointMatchIndex()
+  : next_profile_(0)
+  , verdict_hits_(0)
+  , verdict_misses_(0)
+{
+}
+
+void
+EndpointMatchIndex::insert(const DCPS::GUID_t& id, const String& topic, bool local,
+                           const DDS::DataWriterQos& qos, const DDS::PublisherQos& publisher_qos,
+                           const DCPS::TransportLocatorSeq& locators)
+{
+  insert_i(id, topic, local, qos, publisher_qos, publisher_qos.partition, locators);
+}
+
+void
+EndpointMatchIndex::insert(const DCPS::GUID_t& id, const String& topic, bool local,
+                           const DDS::DataReaderQos& qos, const DDS::SubscriberQos& subscriber_qos,
+                           const DCPS::TransportLocatorSeq& locators)
+{
+  insert_i(id, topic, local, qos, subscriber_qos, subscriber_qos.partition, locators);
+}
+
+void
+EndpointMatchIndex::insert(const DCPS::GUID_t& id, const String& topic, bool local,
+                           const DDS::PublicationBuiltinTopicData& data,
+                           const DCPS::TransportLocatorSeq& locators)
+{
+  insert_i(id, topic, local, data, data, data.partition, locators);
+}
+
+void
+EndpointMatchIndex::insert(const DCPS::GUID_t& id, const String& topic, bool local,
+                           const DDS::SubscriptionBuiltinTopicData& data,
+                           const DCPS::TransportLocatorSeq& locators)
+{
+  insert_i(id, topic, local, data, data, data.partition, locators);
+}
+
+template <typename EntityQos, typename GroupQos>
+void
+EndpointMatchIndex::insert_i(const DCPS::GUID_t& id, const String& topic, bool local,
+                             const EntityQos& qos, const GroupQos& group,
+                             const DDS::PartitionQosPolicy& partition,
+                             const DCPS::TransportLocatorSeq& locators)
+{
+  remove(id);
+
+  const bool reader = DCPS::GuidConverter(id).isReader();
+  Entry& entry = entries_[id];
+  entry.topic = topic;
+  entry.bucket = bucket_index(reader, local);
+  partition_names(partition, entry.names);
+  transport_types(locators, entry.transports);
+
+  const std::pair<ProfileMap::iterator, bool> result =
+    profiles_.insert(std::make_pair(profile_key(reader, qos, group), Profile()));
+  if (result.second) {
+    // Ids are not reused, so cached verdicts of released profiles can't be
+    // mistaken for those of new ones.
+    result.first->second.id = ++next_profile_;
+    Profile& profile = result.first->second;
+    store(qos, group, profile.writer_qos, profile.publisher_qos,
+          profile.reader_qos, profile.subscriber_qos);
+  }
+  ++result.first->second.refs;
+  entry.profile = &*result.first;
+
+  Bucket& bucket = topics_[topic].buckets[entry.bucket];
+  bucket.ids.insert(id);
+  bucket.groups[group_key(entry)].insert(id);
+  for (size_t i = 0; i < entry.names.size(); ++i) {
+    const String& name = entry.names[i];
+    if (DCPS::is_wildcard(name.c_str())) {
+      WildcardMap::iterator pos = bucket.wildcards.find(name);
+      if (pos == bucket.wildcards.end()) {
+        pos = bucket.wildcards.insert(WildcardMap::value_type(name, Wildcard(name))).first;
+      }
+      pos->second.ids.insert(id);
+    } else {
+      bucket.exact[name].insert(id);
+    }
+  }
+}
+
+void
+EndpointMatchIndex::remove(const DCPS::GUID_t& id)
+{
+  const EntryMap::iterator pos = entries_.find(id);
+  if (pos == entries_.end()) {
+    return;
+  }
+  Entry& entry = pos->second;
+
+  const TopicMap::iterator topic = topics_.find(entry.topic);
+  if (topic != topics_.end()) {
+    Bucket& bucket = topic->second.buckets[entry.bucket];
+    bucket.ids.erase(id);
+    const GroupMap::iterator group = bucket.groups.find(group_key(entry));
+    if (group != bucket.groups.end()) {
+      group->second.erase(id);
+      if (group->second.empty()) {
+        bucket.groups.erase(group);
+      }
+    }
+    for (size_t i = 0; i < entry.names.size(); ++i) {
+      const String& name = entry.names[i];
+      if (DCPS::is_wildcard(name.c_str())) {
+        const WildcardMap::iterator pos = bucket.wildcards.find(name);
+        if (pos != bucket.wildcards.end()) {
+          pos->second.ids.erase(id);
+          if (pos->second.ids.empty()) {
+            bucket.wildcards.erase(pos);
+          }
+        }
+      } else {
+        const NameMap::iterator ids = bucket.exact.find(name);
+        if (ids != bucket.exact.end()) {
+          ids->second.erase(id);
+          if (ids->second.empty()) {
+            bucket.exact.erase(ids);
+          }
+        }
+      }
+    }
+
+    bool empty = true;
+    for (size_t i = 0; empty && i < BUCKETS; ++i) {
+      empty = topic->second.buckets[i].ids.empty();
+    }
+    if (empty) {
+      topics_.erase(topic);
+    }
+  }
+
+  release_profile(entry);
+  entries_.erase(pos);
+}
+
+size_t
+EndpointMatchIndex::count(const String& topic, bool reader, bool local) const
+{
+  const TopicMap::const_iterator pos = topics_.find(topic);
+  return pos == topics_.end() ? 0 : pos->second.buckets[bucket_index(reader, local)].ids.size();
+}
+
+void
+EndpointMatchIndex::candidates(const DCPS::GUID_t& id, bool local, DCPS::RepoIdSet& result)
+{
+  const EntryMap::const_iterator entry = entries_.find(id);
+  if (entry == entries_.end()) {
+    return;
+  }
+  const TopicMap::const_iterator pos = topics_.find(entry->second.topic);
+  if (pos == topics_.end()) {
+    return;
+  }
+  const bool reader = DCPS::GuidConverter(id).isReader();
+  const Bucket& bucket = pos->second.buckets[bucket_index(!reader, local)];
+  const OPENDDS_VECTOR(String)& names = entry->second.names;
+
+  for (size_t i = 0; i < names.size(); ++i) {
+    const DCPS::PartitionPattern name(names[i].c_str());
+    if (name.wildcard()) {
+      // Wildcards never match each other.
+      for (NameMap::const_iterator it = bucket.exact.begin(); it != bucket.exact.end(); ++it) {
+        if (name.matches(it->first.c_str())) {
+          result.insert(it->second.begin(), it->second.end());
+        }
+      }
+    } else {
+      const NameMap::const_iterator it = bucket.exact.find(names[i]);
+      if (it != bucket.exact.end()) {
+        result.insert(it->second.begin(), it->second.end());
+      }
+      for (WildcardMap::const_iterator it = bucket.wildcards.begin(); it != bucket.wildcards.end(); ++it) {
+        if (it->second.pattern.matches(names[i].c_str())) {
+          result.insert(it->second.ids.begin(), it->second.ids.end());
+        }
+      }
+    }
+  }
+
+  // The rest won't match, but DCPS::compatibleQOS() reports incompatible
+  // QoS regardless of the partitions.  Every endpoint of a group has the
+  // same verdict, so one of them decides for all.
+  for (GroupMap::const_iterator it = bucket.groups.begin(); it != bucket.groups.end(); ++it) {
+    const EntryMap::const_iterator other = entries_.find(*it->second.begin());
+    if (other == entries_.end()) {
+      continue;
+    }
+    const Entry& writer = reader ? other->second : entry->second;
+    const Entry& reader_entry = reader ? entry->second : other->second;
+    if (!common_transport(writer.transports, reader_entry.transports) ||
+        !verdict(writer, reader_entry).compatible) {
+      result.insert(it->second.begin(), it->second.end());
+    }
+  }
+}
+
+bool
+EndpointMatchIndex::compatible(const DCPS::GUID_t& writer,
+                               const DCPS::GUID_t& reader,
+                               DCPS::IncompatibleQosStatus& writer_status,
+                               DCPS::IncompatibleQosStatus& reader_status,
+                               const DCPS::TransportLocatorSeq& pub_tls,
+                               const DCPS::TransportLocatorSeq& sub_tls,
+                               const DDS::DataWriterQos& writer_qos,
+                               const DDS::DataReaderQos& reader_qos,
+                               const DDS::PublisherQos& pub_qos,
+                               const DDS::SubscriberQos& sub_qos)
+{
+  const EntryMap::iterator wpos = entries_.find(writer);
+  const EntryMap::iterator rpos = entries_.find(reader);
+  if (wpos == entries_.end() || rpos == entries_.end()) {
+    return DCPS::compatibleQOS(&writer_status, &reader_status, pub_tls, sub_tls,
+                               &writer_qos, &reader_qos, &pub_qos, &sub_qos);
+  }
+
+  // The locators of a discovered endpoint can change without a new QoS, so
+  // transports are always checked, and remembered for candidates().
+  set_transports(writer, wpos->second, pub_tls);
+  set_transports(reader, rpos->second, sub_tls);
+  if (!DCPS::compatibleTransports(pub_tls, sub_tls)) {
+    DCPS::increment_incompatibility_count(&writer_status, OpenDDS::TRANSPORTTYPE_QOS_POLICY_ID);
+    DCPS::increment_incompatibility_count(&reader_status, OpenDDS::TRANSPORTTYPE_QOS_POLICY_ID);
+    return false;
+  }
+
+  const Verdict& v = verdict(wpos->second, rpos->second);
+  replay(v.status, writer_status);
+  replay(v.status, reader_status);
+  // Partitions that don't match aren't counted as incompatible.
+  return v.compatible && DCPS::matching_partitions(pub_qos.partition, sub_qos.partition);
+}
+
+const EndpointMatchIndex::Verdict&
+EndpointMatchIndex::verdict(const Entry& writer, const Entry& reader)
+{
+  const Profile& wp = writer.profile->second;
+  const Profile& rp = reader.profile->second;
+  const ProfilePair key(wp.id, rp.id);
+  VerdictMap::iterator verdict = verdicts_.find(key);
+  if (verdict != verdicts_.end()) {
+    ++verdict_hits_;
+    return verdict->second;
+  }
+
+  ++verdict_misses_;
+  if (verdicts_.size() >= MAX_VERDICTS) {
+    verdicts_.clear();
+  }
+
+  Verdict v;
+  v.status.total_count = 0;
+  v.status.count_since_last_send = 0;
+  v.status.last_policy_id = 0;
+  // Same order and short circuits as DCPS::compatibleQOS().
+  v.compatible = DCPS::compatibleQOS(&wp.writer_qos, &rp.reader_qos, &v.status)
+    && DCPS::compatibleQOS(&wp.publisher_qos, &rp.subscriber_qos, &v.status);
+  return verdicts_.insert(std::make_pair(key, v)).first->second;
+}
+
+EndpointMatchIndex::Bucket*
+EndpointMatchIndex::find_bucket(const Entry& entry)
+{
+  const TopicMap::iterator topic = topics_.find(entry.topic);
+  return topic == topics_.end() ? 0 : &topic->second.buckets[entry.bucket];
+}
+
+void
+EndpointMatchIndex::set_transports(const DCPS::GUID_t& id, Entry& entry,
+                                   const DCPS::TransportLocatorSeq& locators)
+{
+  OPENDDS_VECTOR(String) transports;
+  transport_types(locators, transports);
+  if (transports == entry.transports) {
+    return;
+  }
+
+  // Move the endpoint to the group for its new transports.
+  Bucket* const bucket = find_bucket(entry);
+  if (bucket) {
+    const GroupMap::iterator group = bucket->groups.find(group_key(entry));
+    if (group != bucket->groups.end()) {
+      group->second.erase(id);
+      if (group->second.empty()) {
+        bucket->groups.erase(group);
+      }
+    }
+  }
+  entry.transports.swap(transports);
+  if (bucket) {
+    bucket->groups[group_key(entry)].insert(id);
+  }
+}
+
+void
+EndpointMatchIndex::release_profile(Entry& entry)
+{
+  if (entry.profile) {
+    if (--entry.profile->second.refs == 0) {
+      const String key = entry.profile->first;
+      profiles_.erase(key);
+    }
+    entry.profile = 0;
+  }
+}
+
+} // namespace RTPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,196 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+#ifndef OPENDDS_DCPS_RTPS_ENDPOINT_MATCH_INDEX_H
+#define OPENDDS_DCPS_RTPS_ENDPOINT_MATCH_INDEX_H
+
+#include "rtps_export.h"
+
+#include <dds/Versioned_Namespace.h>
+
+#include <dds/DCPS/GuidUtils.h>
+#include <dds/DCPS/PartitionMatcher.h>
+#include <dds/DCPS/PoolAllocator.h>
+
+#include <dds/DdsDcpsCoreC.h>
+#include <dds/DdsDcpsInfoUtilsC.h>
+#include <dds/DdsDcpsInfrastructureC.h>
+
+#ifndef ACE_LACKS_PRAGMA_ONCE
+#  pragma once
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace RTPS {
+
+/**
+ * Index of the endpoints known to Sedp, used by match_endpoints() to only
+ * consider endpoints that can match instead of every endpoint on the
+ * topic.
+ *
+ * Endpoints are bucketed by topic, kind, locality, and partition name.
+ * Wildcard partition names are kept apart and matched against the names
+ * being looked up, so candidates() returns a superset of the endpoints
+ * whose partitions match; the caller still decides each match.
+ *
+ * Partitions that don't match are not incompatible QoS, but the other
+ * policies are still checked and reported for those pairs.  To keep that
+ * cheap, the policies that decide QoS compatibility are interned into a
+ * profile when an endpoint is inserted, and the verdict for each pair of
+ * profiles is cached.  The endpoints of a bucket are also grouped by
+ * profile and transport types, so those in other partitions are checked
+ * once per group instead of once per endpoint.  Endpoints announced with
+ * the same QoS, the common case, then share one evaluation.
+ */
+class OpenDDS_Rtps_Export EndpointMatchIndex {
+public:
+  EndpointMatchIndex();
+
+  /// Add an endpoint or replace what is known about it.
+  void insert(const DCPS::GUID_t& id, const String& topic, bool local,
+              const DDS::DataWriterQos& qos, const DDS::PublisherQos& publisher_qos,
+              const DCPS::TransportLocatorSeq& locators);
+  void insert(const DCPS::GUID_t& id, const String& topic, bool local,
+              const DDS::DataReaderQos& qos, const DDS::SubscriberQos& subscriber_qos,
+              const DCPS::TransportLocatorSeq& locators);
+  void insert(const DCPS::GUID_t& id, const String& topic, bool local,
+              const DDS::PublicationBuiltinTopicData& data,
+              const DCPS::TransportLocatorSeq& locators);
+  void insert(const DCPS::GUID_t& id, const String& topic, bool local,
+              const DDS::SubscriptionBuiltinTopicData& data,
+              const DCPS::TransportLocatorSeq& locators);
+
+  void remove(const DCPS::GUID_t& id);
+
+  /// Number of indexed endpoints of "topic" with the given kind and locality.
+  size_t count(const String& topic, bool reader, bool local) const;
+
+  /// Add to "result" the endpoints with the given locality that the
+  /// indexed endpoint "id" has to be matched against: those of the
+  /// opposite kind on its topic whose partitions may match, and those whose
+  /// partitions don't but whose QoS or transports are incompatible, so that
+  /// the incompatibility is still reported.
+  void candidates(const DCPS::GUID_t& id, bool local, DCPS::RepoIdSet& result);
+
+  /// Same result and status updates as DCPS::compatibleQOS().  The verdict
+  /// is cached if both endpoints are indexed.
+  bool compatible(const DCPS::GUID_t& writer,
+                  const DCPS::GUID_t& reader,
+                  DCPS::IncompatibleQosStatus& writer_status,
+                  DCPS::IncompatibleQosStatus& reader_status,
+                  const DCPS::TransportLocatorSeq& pub_tls,
+                  const DCPS::TransportLocatorSeq& sub_tls,
+                  const DDS::DataWriterQos& writer_qos,
+                  const DDS::DataReaderQos& reader_qos,
+                  const DDS::PublisherQos& pub_qos,
+                  const DDS::SubscriberQos& sub_qos);
+
+  size_t verdict_hits() const { return verdict_hits_; }
+  size_t verdict_misses() const { return verdict_misses_; }
+
+  /// Bound on the number of cached verdicts.
+  static const size_t MAX_VERDICTS = 4096;
+
+private:
+  typedef OPENDDS_MAP(String, DCPS::RepoIdSet) NameMap;
+
+  /// Endpoints with a wildcard partition name, which is compiled once.
+  struct Wildcard {
+    explicit Wildcard(const String& name) : pattern(name.c_str()) {}
+    DCPS::PartitionPattern pattern;
+    DCPS::RepoIdSet ids;
+  };
+  typedef OPENDDS_MAP(String, Wildcard) WildcardMap;
+
+  /// Endpoints with the same profile id and transport types, which have the
+  /// same QoS and transport compatibility with any other endpoint.
+  typedef std::pair<unsigned int, OPENDDS_VECTOR(String)> GroupKey;
+  typedef OPENDDS_MAP(GroupKey, DCPS::RepoIdSet) GroupMap;
+
+  /// Endpoints of one kind and locality on a topic.
+  struct Bucket {
+    DCPS::RepoIdSet ids;
+    NameMap exact;
+    WildcardMap wildcards;
+    GroupMap groups;
+  };
+
+  static const size_t BUCKETS = 4;
+
+  struct Topic {
+    Bucket buckets[BUCKETS];
+  };
+  typedef OPENDDS_MAP(String, Topic) TopicMap;
+
+  /// The policies compared by DCPS::compatibleQOS(), except for the
+  /// partitions, shared by the endpoints that have the same ones.  Only the
+  /// members for the kind of endpoint are used.
+  struct Profile {
+    Profile() : id(0), refs(0) {}
+    unsigned int id;
+    size_t refs;
+    DDS::DataWriterQos writer_qos;
+    DDS::PublisherQos publisher_qos;
+    DDS::DataReaderQos reader_qos;
+    DDS::SubscriberQos subscriber_qos;
+  };
+  typedef OPENDDS_MAP(String, Profile) ProfileMap;
+
+  struct Entry {
+    Entry() : bucket(0), profile(0) {}
+    String topic;
+    size_t bucket;
+    OPENDDS_VECTOR(String) names;
+    OPENDDS_VECTOR(String) transports;
+    ProfileMap::value_type* profile;
+  };
+  typedef OPENDDS_MAP_CMP(DCPS::GUID_t, Entry, DCPS::GUID_tKeyLessThan) EntryMap;
+
+  struct Verdict {
+    bool compatible;
+    DCPS::IncompatibleQosStatus status;
+  };
+  typedef std::pair<unsigned int, unsigned int> ProfilePair;
+  typedef OPENDDS_MAP(ProfilePair, Verdict) VerdictMap;
+
+  static size_t bucket_index(bool reader, bool local)
+  {
+    return (reader ? 1 : 0) + (local ? 2 : 0);
+  }
+
+  template <typename EntityQos, typename GroupQos>
+  void insert_i(const DCPS::GUID_t& id, const String& topic, bool local,
+                const EntityQos& qos, const GroupQos& group,
+                const DDS::PartitionQosPolicy& partition,
+                const DCPS::TransportLocatorSeq& locators);
+
+  static GroupKey group_key(const Entry& entry)
+  {
+    return GroupKey(entry.profile->second.id, entry.transports);
+  }
+
+  Bucket* find_bucket(const Entry& entry);
+  void set_transports(const DCPS::GUID_t& id, Entry& entry,
+                      const DCPS::TransportLocatorSeq& locators);
+
+  const Verdict& verdict(const Entry& writer, const Entry& reader);
+  void release_profile(Entry& entry);
+
+  TopicMap topics_;
+  EntryMap entries_;
+  ProfileMap profiles_;
+  unsigned int next_profile_;
+  VerdictMap verdicts_;
+  size_t verdict_hits_;
+  size_t verdict_misses_;
+};
+
+} // namespace RTPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_DCPS_RTPS_ENDPOINT_MATCH_INDEX_H
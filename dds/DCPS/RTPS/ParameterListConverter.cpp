@@ -274,6 +274,118 @@ namespace {
     }
   }
 
+  void set_defaults(DCPS::DiscoveredWriterData& writer_data)
+  {
+    writer_data.ddsPublicationData.topic_name = "";
+    writer_data.ddsPublicationData.type_name  = "";
+    writer_data.ddsPublicationData.durability =
+      TheServiceParticipant->initial_DurabilityQosPolicy();
+    writer_data.ddsPublicationData.durability_service =
+      TheServiceParticipant->initial_DurabilityServiceQosPolicy();
+    writer_data.ddsPublicationData.deadline =
+      TheServiceParticipant->initial_DeadlineQosPolicy();
+    writer_data.ddsPublicationData.latency_budget =
+      TheServiceParticipant->initial_LatencyBudgetQosPolicy();
+    writer_data.ddsPublicationData.liveliness =
+      TheServiceParticipant->initial_LivelinessQosPolicy();
+    writer_data.ddsPublicationData.reliability =
+      TheServiceParticipant->initial_DataWriterQos().reliability;
+    writer_data.ddsPublicationData.lifespan =
+      TheServiceParticipant->initial_LifespanQosPolicy();
+    writer_data.ddsPublicationData.user_data =
+      TheServiceParticipant->initial_UserDataQosPolicy();
+    writer_data.ddsPublicationData.ownership =
+      TheServiceParticipant->initial_OwnershipQosPolicy();
+#ifdef OPENDDS_NO_OWNERSHIP_KIND_EXCLUSIVE
+    writer_data.ddsPublicationData.ownership_strength.value = 0;
+#else
+    writer_data.ddsPublicationData.ownership_strength =
+      TheServiceParticipant->initial_OwnershipStrengthQosPolicy();
+#endif
+    writer_data.ddsPublicationData.destination_order =
+      TheServiceParticipant->initial_DestinationOrderQosPolicy();
+    writer_data.ddsPublicationData.presentation =
+      TheServiceParticipant->initial_PresentationQosPolicy();
+    writer_data.ddsPublicationData.partition =
+      TheServiceParticipant->initial_PartitionQosPolicy();
+    writer_data.ddsPublicationData.topic_data =
+      TheServiceParticipant->initial_TopicDataQosPolicy();
+    writer_data.ddsPublicationData.group_data =
+      TheServiceParticipant->initial_GroupDataQosPolicy();
+    writer_data.ddsPublicationData.representation.value.length(1);
+    writer_data.ddsPublicationData.representation.value[0] = DDS::XCDR_DATA_REPRESENTATION;
+  }
+
+  void set_defaults(DCPS::DiscoveredReaderData& reader_data)
+  {
+    reader_data.ddsSubscriptionData.topic_name = "";
+    reader_data.ddsSubscriptionData.type_name  = "";
+    reader_data.ddsSubscriptionData.durability =
+      TheServiceParticipant->initial_DurabilityQosPolicy();
+    reader_data.ddsSubscriptionData.deadline =
+      TheServiceParticipant->initial_DeadlineQosPolicy();
+    reader_data.ddsSubscriptionData.latency_budget =
+      TheServiceParticipant->initial_LatencyBudgetQosPolicy();
+    reader_data.ddsSubscriptionData.liveliness =
+      TheServiceParticipant->initial_LivelinessQosPolicy();
+    reader_data.ddsSubscriptionData.reliability =
+      TheServiceParticipant->initial_DataReaderQos().reliability;
+    reader_data.ddsSubscriptionData.ownership =
+      TheServiceParticipant->initial_OwnershipQosPolicy();
+    reader_data.ddsSubscriptionData.destination_order =
+      TheServiceParticipant->initial_DestinationOrderQosPolicy();
+    reader_data.ddsSubscriptionData.user_data =
+      TheServiceParticipant->initial_UserDataQosPolicy();
+    reader_data.ddsSubscriptionData.time_based_filter =
+      TheServiceParticipant->initial_TimeBasedFilterQosPolicy();
+    reader_data.ddsSubscriptionData.presentation =
+      TheServiceParticipant->initial_PresentationQosPolicy();
+    reader_data.ddsSubscriptionData.partition =
+      TheServiceParticipant->initial_PartitionQosPolicy();
+    reader_data.ddsSubscriptionData.topic_data =
+      TheServiceParticipant->initial_TopicDataQosPolicy();
+    reader_data.ddsSubscriptionData.group_data =
+      TheServiceParticipant->initial_GroupDataQosPolicy();
+    reader_data.ddsSubscriptionData.representation.value.length(1);
+    reader_data.ddsSubscriptionData.representation.value[0] = DDS::XCDR_DATA_REPRESENTATION;
+    reader_data.ddsSubscriptionData.type_consistency =
+      TheServiceParticipant->initial_TypeConsistencyEnforcementQosPolicy();
+    reader_data.readerProxy.expectsInlineQos = false;
+    reader_data.contentFilterProperty.contentFilteredTopicName = "";
+    reader_data.contentFilterProperty.relatedTopicName = "";
+    reader_data.contentFilterProperty.filterClassName = "";
+    reader_data.contentFilterProperty.filterExpression = "";
+    reader_data.contentFilterProperty.expressionParameters.length(0);
+  }
+
+  void set_writer_reliability(DDS::ReliabilityQosPolicy& reliability,
+                              const ReliabilityQosPolicyRtps& rtps)
+  {
+    reliability.max_blocking_time = rtps.max_blocking_time;
+    // Interoperability note:
+    // Spec creators for RTPS have reliability indexed at 1
+    if (rtps.kind.value == RTPS::BEST_EFFORT) {
+      reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+    } else { // default to RELIABLE for writers
+      reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+    }
+    normalize(reliability.max_blocking_time);
+  }
+
+  void set_reader_reliability(DDS::ReliabilityQosPolicy& reliability,
+                              const ReliabilityQosPolicyRtps& rtps)
+  {
+    reliability.max_blocking_time = rtps.max_blocking_time;
+    // Interoperability note:
+    // Spec creators for RTPS have reliability indexed at 1
+    const CORBA::Short OLD_RELIABLE_VALUE = 3;
+    if (rtps.kind.value == RTPS::RELIABLE || rtps.kind.value == OLD_RELIABLE_VALUE) {
+      reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+    } else { // default to BEST_EFFORT for readers
+      reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+    }
+  }
+
 #if OPENDDS_CONFIG_SECURITY
   OpenDDS::Security::DiscoveredParticipantDataKind find_data_kind(const ParameterList& param_list)
   {
@@ -323,6 +435,35 @@ namespace {
 
     return OpenDDS::Security::DPDK_ORIGINAL;
   }
+
+  void add_ice_general(ICE::AgentInfoMap& ai_map, const IceGeneral_t& ice_general)
+  {
+    ICE::AgentInfo& agent_info = ai_map[OPENDDS_STRING(ice_general.key.in())];
+    agent_info.type = static_cast<ICE::AgentType>(ice_general.agent_type);
+    agent_info.username = ice_general.username;
+    agent_info.password = ice_general.password;
+  }
+
+  bool add_ice_candidate(ICE::AgentInfoMap& ai_map, const IceCandidate_t& ice_candidate)
+  {
+    ICE::Candidate candidate;
+    // https://tools.ietf.org/html/rfc8445
+
+    // IPv4-mapped IPv6 addresses SHOULD NOT be included in the
+    // address candidates unless the application using ICE does not
+    // support IPv4 (i.e., it is an IPv6-only application
+    // [RFC4038]).
+    //
+    // Change this if we ever do an IPV6-only build.
+    if (locator_to_address(candidate.address, ice_candidate.locator, false /* do not map ipv4 to ipv6 */) != 0) {
+      return false;
+    }
+    candidate.foundation = ice_candidate.foundation;
+    candidate.priority = ice_candidate.priority;
+    candidate.type = static_cast<ICE::CandidateType>(ice_candidate.type);
+    ai_map[OPENDDS_STRING(ice_candidate.key.in())].candidates.push_back(candidate);
+    return true;
+  }
 #endif
 
 };
@@ -786,6 +927,463 @@ bool from_param_list(const ParameterList& param_list,
 }
 #endif
 
+namespace {
+
+#if OPENDDS_CONFIG_SECURITY
+  typedef ICE::AgentInfoMap* AgentInfoMapPtr;
+#else
+  typedef void* AgentInfoMapPtr;
+#endif
+
+  // PID_TOPIC_NAME and PID_TYPE_NAME are string<256>
+  const ACE_CDR::ULong NAME_BOUND = 256;
+
+  // Reads the value of a parameter that has already been deserialized into
+  // a ParameterList.
+  class ParameterReader {
+  public:
+    explicit ParameterReader(const Parameter& param)
+      : param_(param)
+    {}
+
+    template <typename T>
+    bool read_name(T& name) { name = param_.string_data(); return true; }
+
+    bool read(DDS::DurabilityQosPolicy& v) { v = param_.durability(); return true; }
+    bool read(DDS::DurabilityServiceQosPolicy& v) { v = param_.durability_service(); return true; }
+    bool read(DDS::DeadlineQosPolicy& v) { v = param_.deadline(); return true; }
+    bool read(DDS::LatencyBudgetQosPolicy& v) { v = param_.latency_budget(); return true; }
+    bool read(DDS::LivelinessQosPolicy& v) { v = param_.liveliness(); return true; }
+    bool read(ReliabilityQosPolicyRtps& v) { v = param_.reliability(); return true; }
+    bool read(DDS::LifespanQosPolicy& v) { v = param_.lifespan(); return true; }
+    bool read(DDS::UserDataQosPolicy& v) { v = param_.user_data(); return true; }
+    bool read(DDS::OwnershipQosPolicy& v) { v = param_.ownership(); return true; }
+    bool read(DDS::OwnershipStrengthQosPolicy& v) { v = param_.ownership_strength(); return true; }
+    bool read(DDS::DestinationOrderQosPolicy& v) { v = param_.destination_order(); return true; }
+    bool read(DDS::TimeBasedFilterQosPolicy& v) { v = param_.time_based_filter(); return true; }
+    bool read(DDS::PresentationQosPolicy& v) { v = param_.presentation(); return true; }
+    bool read(DDS::PartitionQosPolicy& v) { v = param_.partition(); return true; }
+    bool read(DDS::TopicDataQosPolicy& v) { v = param_.topic_data(); return true; }
+    bool read(DDS::GroupDataQosPolicy& v) { v = param_.group_data(); return true; }
+    bool read(DDS::DataRepresentationQosPolicy& v) { v = param_.representation(); return true; }
+    bool read(DDS::TypeConsistencyEnforcementQosPolicy& v) { v = param_.type_consistency(); return true; }
+    bool read(DCPS::GUID_t& v) { v = param_.guid(); return true; }
+    bool read(DCPS::Locator_t& v) { v = param_.locator(); return true; }
+    bool read(DCPS::TransportLocator& v) { v = param_.opendds_locator(); return true; }
+    bool read(DCPS::ContentFilterProperty_t& v) { v = param_.content_filter_property(); return true; }
+#if OPENDDS_CONFIG_SECURITY
+    bool read(IceGeneral_t& v) { v = param_.ice_general(); return true; }
+    bool read(IceCandidate_t& v) { v = param_.ice_candidate(); return true; }
+#endif
+
+    bool read_type_info(XTypes::TypeInformation& type_info)
+    {
+      extract_type_info_param(param_, type_info);
+      return true;
+    }
+
+  private:
+    const Parameter& param_;
+  };
+
+  // Reads the value of a parameter straight from the serialized
+  // ParameterList.  The caller skips whatever part of it is not read.
+  class StreamReader {
+  public:
+    StreamReader(DCPS::Serializer& ser, ACE_CDR::UShort size)
+      : ser_(ser)
+      , size_(size)
+    {}
+
+    template <typename T>
+    bool read_name(T& name) { return ser_ >> ACE_InputCDR::to_string(name.out(), NAME_BOUND); }
+
+    template <typename T>
+    bool read(T& v) { return ser_ >> v; }
+
+    bool read_type_info(XTypes::TypeInformation& type_info)
+    {
+      // Deserialize from a duplicate of the parameter's message block instead
+      // of copying the parameter into an OctetSeq first.
+      const DCPS::Message_Block_Ptr param(ser_.trim(size_));
+      if (!param) {
+        return false;
+      }
+      DCPS::Serializer type_ser(param.get(), XTypes::get_typeobject_encoding());
+      if (!(type_ser >> type_info)) {
+        ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) ERROR: ParameterListConverter::read_type_info ")
+                   ACE_TEXT("deserialization of type information failed.\n")));
+        type_info.minimal.typeid_with_size.type_id = XTypes::TypeIdentifier();
+        type_info.complete.typeid_with_size.type_id = XTypes::TypeIdentifier();
+      }
+      return true;
+    }
+
+  private:
+    DCPS::Serializer& ser_;
+    const ACE_CDR::UShort size_;
+  };
+
+  template <typename Reader>
+  bool read_representation(Reader& reader, DDS::DataRepresentationQosPolicy& representation)
+  {
+    DDS::DataRepresentationQosPolicy value;
+    if (!reader.read(value)) {
+      return false;
+    }
+    if (value.value.length() != 0) {
+      representation = value;
+    }
+    return true;
+  }
+
+  template <typename Reader>
+  bool read_locator(Reader& reader, DCPS::LocatorSeq& rtps_udp_locators)
+  {
+    return reader.read(rtps_udp_locators[DCPS::grow(rtps_udp_locators) - 1]);
+  }
+
+  template <typename Reader>
+  bool read_opendds_locator(Reader& reader,
+                            DCPS::TransportLocatorSeq& all_locators,
+                            DCPS::LocatorSeq& rtps_udp_locators)
+  {
+    // Append the rtps_udp_locators, if any, first, to preserve order
+    append_locators_if_present(all_locators, rtps_udp_locators);
+    rtps_udp_locators.length(0);
+    return reader.read(all_locators[DCPS::grow(all_locators) - 1]);
+  }
+
+  template <typename Reader>
+  bool read_ice_param(Reader& reader, ACE_CDR::UShort pid, AgentInfoMapPtr ai_map)
+  {
+#if OPENDDS_CONFIG_SECURITY
+    if (!ai_map) {
+      return true;
+    }
+    if (pid == PID_OPENDDS_ICE_GENERAL) {
+      IceGeneral_t ice_general;
+      if (!reader.read(ice_general)) {
+        return false;
+      }
+      add_ice_general(*ai_map, ice_general);
+      return true;
+    }
+    IceCandidate_t ice_candidate;
+    return reader.read(ice_candidate) && add_ice_candidate(*ai_map, ice_candidate);
+#else
+    ACE_UNUSED_ARG(reader);
+    ACE_UNUSED_ARG(pid);
+    ACE_UNUSED_ARG(ai_map);
+    return true;
+#endif
+  }
+
+  DCPS::TransportLocatorSeq& all_locators(DCPS::DiscoveredWriterData& writer_data)
+  {
+    return writer_data.writerProxy.allLocators;
+  }
+
+  DCPS::TransportLocatorSeq& all_locators(DCPS::DiscoveredReaderData& reader_data)
+  {
+    return reader_data.readerProxy.allLocators;
+  }
+
+  // Reads one parameter into writer_data.  Both the ParameterList and the
+  // streaming decoders go through here.  Returns false if the parameter
+  // can't be read or if it is an unknown parameter that can't be ignored.
+  template <typename Reader>
+  bool read_param(Reader& reader,
+                  ACE_CDR::UShort pid,
+                  DCPS::DiscoveredWriterData& writer_data,
+                  DCPS::LocatorSeq& rtps_udp_locators,
+                  bool use_xtypes,
+                  XTypes::TypeInformation& type_info,
+                  AgentInfoMapPtr ai_map)
+  {
+    DDS::PublicationBuiltinTopicData& pub = writer_data.ddsPublicationData;
+
+    bool ok = true;
+    switch (pid) {
+    case PID_TOPIC_NAME:
+      ok = reader.read_name(pub.topic_name);
+      break;
+    case PID_TYPE_NAME:
+      ok = reader.read_name(pub.type_name);
+      break;
+    case PID_DURABILITY:
+      ok = reader.read(pub.durability);
+      break;
+    case PID_DURABILITY_SERVICE:
+      ok = reader.read(pub.durability_service);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(pub.durability_service.service_cleanup_delay);
+      break;
+    case PID_DEADLINE:
+      ok = reader.read(pub.deadline);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(pub.deadline.period);
+      break;
+    case PID_LATENCY_BUDGET:
+      ok = reader.read(pub.latency_budget);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(pub.latency_budget.duration);
+      break;
+    case PID_LIVELINESS:
+      ok = reader.read(pub.liveliness);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(pub.liveliness.lease_duration);
+      break;
+    case PID_RELIABILITY: {
+      ReliabilityQosPolicyRtps reliability;
+      ok = reader.read(reliability);
+      set_writer_reliability(pub.reliability, reliability);
+      break;
+    }
+    case PID_LIFESPAN:
+      ok = reader.read(pub.lifespan);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(pub.lifespan.duration);
+      break;
+    case PID_USER_DATA:
+      ok = reader.read(pub.user_data);
+      break;
+    case PID_OWNERSHIP:
+      ok = reader.read(pub.ownership);
+      break;
+    case PID_OWNERSHIP_STRENGTH:
+      ok = reader.read(pub.ownership_strength);
+      break;
+    case PID_DESTINATION_ORDER:
+      ok = reader.read(pub.destination_order);
+      break;
+    case PID_PRESENTATION:
+      ok = reader.read(pub.presentation);
+      break;
+    case PID_PARTITION:
+      ok = reader.read(pub.partition);
+      break;
+    case PID_TOPIC_DATA:
+      ok = reader.read(pub.topic_data);
+      break;
+    case PID_GROUP_DATA:
+      ok = reader.read(pub.group_data);
+      break;
+    case PID_DATA_REPRESENTATION:
+      ok = read_representation(reader, pub.representation);
+      break;
+    case PID_ENDPOINT_GUID:
+      ok = reader.read(writer_data.writerProxy.remoteWriterGuid);
+      break;
+    case PID_UNICAST_LOCATOR:
+    case PID_MULTICAST_LOCATOR:
+      ok = read_locator(reader, rtps_udp_locators);
+      break;
+    case PID_OPENDDS_LOCATOR:
+      ok = read_opendds_locator(reader, writer_data.writerProxy.allLocators, rtps_udp_locators);
+      break;
+    case PID_SENTINEL:
+    case PID_PAD:
+      // ignore
+      break;
+    case PID_XTYPES_TYPE_INFORMATION:
+      if (use_xtypes) {
+        ok = reader.read_type_info(type_info);
+      }
+      break;
+    case PID_OPENDDS_ICE_GENERAL:
+    case PID_OPENDDS_ICE_CANDIDATE:
+      ok = read_ice_param(reader, pid, ai_map);
+      break;
+    default:
+      if (pid & PIDMASK_INCOMPATIBLE) {
+        return false;
+      }
+    }
+    return ok;
+  }
+
+  // Reader counterpart of read_param(DiscoveredWriterData)
+  template <typename Reader>
+  bool read_param(Reader& reader,
+                  ACE_CDR::UShort pid,
+                  DCPS::DiscoveredReaderData& reader_data,
+                  DCPS::LocatorSeq& rtps_udp_locators,
+                  bool use_xtypes,
+                  XTypes::TypeInformation& type_info,
+                  AgentInfoMapPtr ai_map)
+  {
+    DDS::SubscriptionBuiltinTopicData& sub = reader_data.ddsSubscriptionData;
+
+    bool ok = true;
+    switch (pid) {
+    case PID_TOPIC_NAME:
+      ok = reader.read_name(sub.topic_name);
+      break;
+    case PID_TYPE_NAME:
+      ok = reader.read_name(sub.type_name);
+      break;
+    case PID_DURABILITY:
+      ok = reader.read(sub.durability);
+      break;
+    case PID_DEADLINE:
+      ok = reader.read(sub.deadline);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(sub.deadline.period);
+      break;
+    case PID_LATENCY_BUDGET:
+      ok = reader.read(sub.latency_budget);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(sub.latency_budget.duration);
+      break;
+    case PID_LIVELINESS:
+      ok = reader.read(sub.liveliness);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(sub.liveliness.lease_duration);
+      break;
+    case PID_RELIABILITY: {
+      ReliabilityQosPolicyRtps reliability;
+      ok = reader.read(reliability);
+      set_reader_reliability(sub.reliability, reliability);
+      break;
+    }
+    case PID_USER_DATA:
+      ok = reader.read(sub.user_data);
+      break;
+    case PID_OWNERSHIP:
+      ok = reader.read(sub.ownership);
+      break;
+    case PID_DESTINATION_ORDER:
+      ok = reader.read(sub.destination_order);
+      break;
+    case PID_TIME_BASED_FILTER:
+      ok = reader.read(sub.time_based_filter);
+      // Interoperability note: calling normalize() shouldn't be required
+      normalize(sub.time_based_filter.minimum_separation);
+      break;
+    case PID_PRESENTATION:
+      ok = reader.read(sub.presentation);
+      break;
+    case PID_PARTITION:
+      ok = reader.read(sub.partition);
+      break;
+    case PID_TOPIC_DATA:
+      ok = reader.read(sub.topic_data);
+      break;
+    case PID_GROUP_DATA:
+      ok = reader.read(sub.group_data);
+      break;
+    case PID_DATA_REPRESENTATION:
+      ok = read_representation(reader, sub.representation);
+      break;
+    case PID_XTYPES_TYPE_CONSISTENCY:
+      ok = reader.read(sub.type_consistency);
+      break;
+    case PID_ENDPOINT_GUID:
+      ok = reader.read(reader_data.readerProxy.remoteReaderGuid);
+      break;
+    case PID_UNICAST_LOCATOR:
+    case PID_MULTICAST_LOCATOR:
+      ok = read_locator(reader, rtps_udp_locators);
+      break;
+    case PID_CONTENT_FILTER_PROPERTY:
+      ok = reader.read(reader_data.contentFilterProperty);
+      break;
+    case PID_OPENDDS_LOCATOR:
+      ok = read_opendds_locator(reader, reader_data.readerProxy.allLocators, rtps_udp_locators);
+      break;
+    case PID_OPENDDS_ASSOCIATED_WRITER: {
+      DCPS::GUIDSeq& writers = reader_data.readerProxy.associatedWriters;
+      ok = reader.read(writers[DCPS::grow(writers) - 1]);
+      break;
+    }
+    case PID_SENTINEL:
+    case PID_PAD:
+      // ignore
+      break;
+    case PID_XTYPES_TYPE_INFORMATION:
+      if (use_xtypes) {
+        ok = reader.read_type_info(type_info);
+      }
+      break;
+    case PID_OPENDDS_ICE_GENERAL:
+    case PID_OPENDDS_ICE_CANDIDATE:
+      ok = read_ice_param(reader, pid, ai_map);
+      break;
+    default:
+      if (pid & PIDMASK_INCOMPATIBLE) {
+        return false;
+      }
+    }
+    return ok;
+  }
+
+  template <typename EndpointData>
+  bool read_endpoint_data(const ParameterList& param_list,
+                          EndpointData& data,
+                          bool use_xtypes,
+                          XTypes::TypeInformation& type_info)
+  {
+    // Collect the rtps_udp locators before appending them to allLocators
+    DCPS::LocatorSeq rtps_udp_locators;
+
+    set_defaults(data);
+
+    const CORBA::ULong length = param_list.length();
+    for (CORBA::ULong i = 0; i < length; ++i) {
+      const Parameter& param = param_list[i];
+      ParameterReader reader(param);
+      if (!read_param(reader, param._d(), data, rtps_udp_locators, use_xtypes, type_info, 0)) {
+        return false;
+      }
+    }
+    // Append additional rtps_udp_locators, if any
+    append_locators_if_present(all_locators(data), rtps_udp_locators);
+    return true;
+  }
+
+  bool read_parameter_header(DCPS::Serializer& ser, ACE_CDR::UShort& pid, ACE_CDR::UShort& size)
+  {
+    if (!(ser >> pid) || !(ser >> size)) {
+      return false;
+    }
+    return pid == PID_SENTINEL || size <= ser.length();
+  }
+
+  // Equivalent to deserializing a ParameterList and passing it to
+  // read_endpoint_data, but each parameter is read straight into data
+  // and parameters that are not needed are skipped over.
+  template <typename EndpointData>
+  bool read_endpoint_data(DCPS::Serializer& ser,
+                          EndpointData& data,
+                          bool use_xtypes,
+                          XTypes::TypeInformation& type_info,
+                          AgentInfoMapPtr ai_map)
+  {
+    // Collect the rtps_udp locators before appending them to allLocators
+    DCPS::LocatorSeq rtps_udp_locators;
+
+    set_defaults(data);
+
+    ACE_CDR::UShort pid, size;
+    while (read_parameter_header(ser, pid, size)) {
+      if (pid == PID_SENTINEL) {
+        // Append additional rtps_udp_locators, if any
+        append_locators_if_present(all_locators(data), rtps_udp_locators);
+        return true;
+      }
+
+      // Skips whatever part of the parameter is not read
+      const DCPS::Serializer::ScopedAlignmentContext sac(ser, size);
+      StreamReader reader(ser, size);
+      if (!read_param(reader, pid, data, rtps_udp_locators, use_xtypes, type_info, ai_map)) {
+        return false;
+      }
+    }
+    return false;
+  }
+
+}
 // OpenDDS::DCPS::DiscoveredWriterData
 
 void add_DataRepresentationQos(ParameterList& param_list, const DDS::DataRepresentationIdSeq& ids)
@@ -967,167 +1565,7 @@ bool from_param_list(const ParameterList& param_list,
                      bool use_xtypes,
                      XTypes::TypeInformation& type_info)
 {
-  // Collect the rtps_udp locators before appending them to allLocators
-  DCPS::LocatorSeq rtps_udp_locators;
-
-  // Start by setting defaults
-  writer_data.ddsPublicationData.topic_name = "";
-  writer_data.ddsPublicationData.type_name  = "";
-  writer_data.ddsPublicationData.durability =
-    TheServiceParticipant->initial_DurabilityQosPolicy();
-  writer_data.ddsPublicationData.durability_service =
-    TheServiceParticipant->initial_DurabilityServiceQosPolicy();
-  writer_data.ddsPublicationData.deadline =
-    TheServiceParticipant->initial_DeadlineQosPolicy();
-  writer_data.ddsPublicationData.latency_budget =
-    TheServiceParticipant->initial_LatencyBudgetQosPolicy();
-  writer_data.ddsPublicationData.liveliness =
-    TheServiceParticipant->initial_LivelinessQosPolicy();
-  writer_data.ddsPublicationData.reliability =
-    TheServiceParticipant->initial_DataWriterQos().reliability;
-  writer_data.ddsPublicationData.lifespan =
-    TheServiceParticipant->initial_LifespanQosPolicy();
-  writer_data.ddsPublicationData.user_data =
-    TheServiceParticipant->initial_UserDataQosPolicy();
-  writer_data.ddsPublicationData.ownership =
-    TheServiceParticipant->initial_OwnershipQosPolicy();
-#ifdef OPENDDS_NO_OWNERSHIP_KIND_EXCLUSIVE
-  writer_data.ddsPublicationData.ownership_strength.value = 0;
-#else
-  writer_data.ddsPublicationData.ownership_strength =
-    TheServiceParticipant->initial_OwnershipStrengthQosPolicy();
-#endif
-  writer_data.ddsPublicationData.destination_order =
-    TheServiceParticipant->initial_DestinationOrderQosPolicy();
-  writer_data.ddsPublicationData.presentation =
-    TheServiceParticipant->initial_PresentationQosPolicy();
-  writer_data.ddsPublicationData.partition =
-    TheServiceParticipant->initial_PartitionQosPolicy();
-  writer_data.ddsPublicationData.topic_data =
-    TheServiceParticipant->initial_TopicDataQosPolicy();
-  writer_data.ddsPublicationData.group_data =
-    TheServiceParticipant->initial_GroupDataQosPolicy();
-  writer_data.ddsPublicationData.representation.value.length(1);
-  writer_data.ddsPublicationData.representation.value[0] = DDS::XCDR_DATA_REPRESENTATION;
-
-  const CORBA::ULong length = param_list.length();
-  for (CORBA::ULong i = 0; i < length; ++i) {
-    const Parameter& param = param_list[i];
-    switch (param._d()) {
-      case PID_TOPIC_NAME:
-        writer_data.ddsPublicationData.topic_name = param.string_data();
-        break;
-      case PID_TYPE_NAME:
-        writer_data.ddsPublicationData.type_name = param.string_data();
-        break;
-      case PID_DURABILITY:
-        writer_data.ddsPublicationData.durability = param.durability();
-        break;
-      case PID_DURABILITY_SERVICE:
-        writer_data.ddsPublicationData.durability_service =
-          param.durability_service();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(writer_data.ddsPublicationData.durability_service.service_cleanup_delay);
-        break;
-      case PID_DEADLINE:
-        writer_data.ddsPublicationData.deadline = param.deadline();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(writer_data.ddsPublicationData.deadline.period);
-        break;
-      case PID_LATENCY_BUDGET:
-        writer_data.ddsPublicationData.latency_budget = param.latency_budget();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(writer_data.ddsPublicationData.latency_budget.duration);
-        break;
-      case PID_LIVELINESS:
-        writer_data.ddsPublicationData.liveliness = param.liveliness();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(writer_data.ddsPublicationData.liveliness.lease_duration);
-        break;
-      case PID_RELIABILITY:
-        writer_data.ddsPublicationData.reliability.max_blocking_time = param.reliability().max_blocking_time;
-        // Interoperability note:
-        // Spec creators for RTPS have reliability indexed at 1
-        {
-          if (param.reliability().kind.value == RTPS::BEST_EFFORT) {
-            writer_data.ddsPublicationData.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
-          } else { // default to RELIABLE for writers
-            writer_data.ddsPublicationData.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
-          }
-        }
-        normalize(writer_data.ddsPublicationData.reliability.max_blocking_time);
-        break;
-      case PID_LIFESPAN:
-        writer_data.ddsPublicationData.lifespan = param.lifespan();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(writer_data.ddsPublicationData.lifespan.duration);
-        break;
-      case PID_USER_DATA:
-        writer_data.ddsPublicationData.user_data = param.user_data();
-        break;
-      case PID_OWNERSHIP:
-        writer_data.ddsPublicationData.ownership = param.ownership();
-        break;
-      case PID_OWNERSHIP_STRENGTH:
-        writer_data.ddsPublicationData.ownership_strength = param.ownership_strength();
-        break;
-      case PID_DESTINATION_ORDER:
-        writer_data.ddsPublicationData.destination_order = param.destination_order();
-        break;
-      case PID_PRESENTATION:
-        writer_data.ddsPublicationData.presentation = param.presentation();
-        break;
-      case PID_PARTITION:
-        writer_data.ddsPublicationData.partition = param.partition();
-        break;
-      case PID_TOPIC_DATA:
-        writer_data.ddsPublicationData.topic_data = param.topic_data();
-        break;
-      case PID_GROUP_DATA:
-        writer_data.ddsPublicationData.group_data = param.group_data();
-        break;
-      case PID_DATA_REPRESENTATION:
-        if (param.representation().value.length() != 0) {
-          writer_data.ddsPublicationData.representation = param.representation();
-        }
-        break;
-      case PID_ENDPOINT_GUID:
-        writer_data.writerProxy.remoteWriterGuid = param.guid();
-        break;
-      case PID_UNICAST_LOCATOR:
-        DCPS::push_back(rtps_udp_locators, param.locator());
-        break;
-      case PID_MULTICAST_LOCATOR:
-        DCPS::push_back(rtps_udp_locators, param.locator());
-        break;
-      case PID_OPENDDS_LOCATOR:
-        // Append the rtps_udp_locators, if any, first, to preserve order
-        append_locators_if_present(writer_data.writerProxy.allLocators,
-                                   rtps_udp_locators);
-        rtps_udp_locators.length(0);
-        DCPS::push_back(writer_data.writerProxy.allLocators,
-                       param.opendds_locator());
-        break;
-      case PID_SENTINEL:
-      case PID_PAD:
-        // ignore
-        break;
-      case PID_XTYPES_TYPE_INFORMATION:
-        if (use_xtypes) {
-          extract_type_info_param(param, type_info);
-        }
-        break;
-      default:
-        if (param._d() & PIDMASK_INCOMPATIBLE) {
-          return false;
-        }
-    }
-  }
-  // Append additional rtps_udp_locators, if any
-  append_locators_if_present(writer_data.writerProxy.allLocators,
-                             rtps_udp_locators);
-  rtps_udp_locators.length(0);
-  return true;
+  return read_endpoint_data(param_list, writer_data, use_xtypes, type_info);
 }
 
 // OpenDDS::DCPS::DiscoveredReaderData
@@ -1311,170 +1749,45 @@ bool from_param_list(const ParameterList& param_list,
                      bool use_xtypes,
                      XTypes::TypeInformation& type_info)
 {
-  // Collect the rtps_udp locators before appending them to allLocators
+  return read_endpoint_data(param_list, reader_data, use_xtypes, type_info);
+}
 
-  DCPS::LocatorSeq rtps_udp_locators;
-  // Start by setting defaults
-  reader_data.ddsSubscriptionData.topic_name = "";
-  reader_data.ddsSubscriptionData.type_name  = "";
-  reader_data.ddsSubscriptionData.durability =
-    TheServiceParticipant->initial_DurabilityQosPolicy();
-  reader_data.ddsSubscriptionData.deadline =
-    TheServiceParticipant->initial_DeadlineQosPolicy();
-  reader_data.ddsSubscriptionData.latency_budget =
-    TheServiceParticipant->initial_LatencyBudgetQosPolicy();
-  reader_data.ddsSubscriptionData.liveliness =
-    TheServiceParticipant->initial_LivelinessQosPolicy();
-  reader_data.ddsSubscriptionData.reliability =
-    TheServiceParticipant->initial_DataReaderQos().reliability;
-  reader_data.ddsSubscriptionData.ownership =
-    TheServiceParticipant->initial_OwnershipQosPolicy();
-  reader_data.ddsSubscriptionData.destination_order =
-    TheServiceParticipant->initial_DestinationOrderQosPolicy();
-  reader_data.ddsSubscriptionData.user_data =
-    TheServiceParticipant->initial_UserDataQosPolicy();
-  reader_data.ddsSubscriptionData.time_based_filter =
-    TheServiceParticipant->initial_TimeBasedFilterQosPolicy();
-  reader_data.ddsSubscriptionData.presentation =
-    TheServiceParticipant->initial_PresentationQosPolicy();
-  reader_data.ddsSubscriptionData.partition =
-    TheServiceParticipant->initial_PartitionQosPolicy();
-  reader_data.ddsSubscriptionData.topic_data =
-    TheServiceParticipant->initial_TopicDataQosPolicy();
-  reader_data.ddsSubscriptionData.group_data =
-    TheServiceParticipant->initial_GroupDataQosPolicy();
-  reader_data.ddsSubscriptionData.representation.value.length(1);
-  reader_data.ddsSubscriptionData.representation.value[0] = DDS::XCDR_DATA_REPRESENTATION;
-  reader_data.ddsSubscriptionData.type_consistency =
-    TheServiceParticipant->initial_TypeConsistencyEnforcementQosPolicy();
-  reader_data.readerProxy.expectsInlineQos = false;
-  reader_data.contentFilterProperty.contentFilteredTopicName = "";
-  reader_data.contentFilterProperty.relatedTopicName = "";
-  reader_data.contentFilterProperty.filterClassName = "";
-  reader_data.contentFilterProperty.filterExpression = "";
-  reader_data.contentFilterProperty.expressionParameters.length(0);
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredWriterData& writer_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info)
+{
+  return read_endpoint_data(ser, writer_data, use_xtypes, type_info, 0);
+}
 
-  const CORBA::ULong length = param_list.length();
-  for (CORBA::ULong i = 0; i < length; ++i) {
-    const Parameter& param = param_list[i];
-    switch (param._d()) {
-      case PID_TOPIC_NAME:
-        reader_data.ddsSubscriptionData.topic_name = param.string_data();
-        break;
-      case PID_TYPE_NAME:
-        reader_data.ddsSubscriptionData.type_name = param.string_data();
-        break;
-      case PID_DURABILITY:
-        reader_data.ddsSubscriptionData.durability = param.durability();
-        break;
-      case PID_DEADLINE:
-        reader_data.ddsSubscriptionData.deadline = param.deadline();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(reader_data.ddsSubscriptionData.deadline.period);
-        break;
-      case PID_LATENCY_BUDGET:
-        reader_data.ddsSubscriptionData.latency_budget = param.latency_budget();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(reader_data.ddsSubscriptionData.latency_budget.duration);
-        break;
-      case PID_LIVELINESS:
-        reader_data.ddsSubscriptionData.liveliness = param.liveliness();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(reader_data.ddsSubscriptionData.liveliness.lease_duration);
-        break;
-      case PID_RELIABILITY:
-        reader_data.ddsSubscriptionData.reliability.max_blocking_time = param.reliability().max_blocking_time;
-        // Interoperability note:
-        // Spec creators for RTPS have reliability indexed at 1
-        {
-          const CORBA::Short rtpsKind = param.reliability().kind.value;
-          const CORBA::Short OLD_RELIABLE_VALUE = 3;
-          if (rtpsKind == RTPS::RELIABLE || rtpsKind == OLD_RELIABLE_VALUE) {
-            reader_data.ddsSubscriptionData.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
-          } else { // default to BEST_EFFORT for readers
-            reader_data.ddsSubscriptionData.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
-          }
-        }
-        break;
-      case PID_USER_DATA:
-        reader_data.ddsSubscriptionData.user_data = param.user_data();
-        break;
-      case PID_OWNERSHIP:
-        reader_data.ddsSubscriptionData.ownership = param.ownership();
-        break;
-      case PID_DESTINATION_ORDER:
-        reader_data.ddsSubscriptionData.destination_order = param.destination_order();
-        break;
-      case PID_TIME_BASED_FILTER:
-        reader_data.ddsSubscriptionData.time_based_filter = param.time_based_filter();
-        // Interoperability note: calling normalize() shouldn't be required
-        normalize(reader_data.ddsSubscriptionData.time_based_filter.minimum_separation);
-        break;
-      case PID_PRESENTATION:
-        reader_data.ddsSubscriptionData.presentation = param.presentation();
-        break;
-      case PID_PARTITION:
-        reader_data.ddsSubscriptionData.partition = param.partition();
-        break;
-      case PID_TOPIC_DATA:
-        reader_data.ddsSubscriptionData.topic_data = param.topic_data();
-        break;
-      case PID_GROUP_DATA:
-        reader_data.ddsSubscriptionData.group_data = param.group_data();
-        break;
-      case PID_DATA_REPRESENTATION:
-        if (param.representation().value.length() != 0) {
-          reader_data.ddsSubscriptionData.representation = param.representation();
-        }
-        break;
-      case PID_XTYPES_TYPE_CONSISTENCY:
-        reader_data.ddsSubscriptionData.type_consistency = param.type_consistency();
-        break;
-      case PID_ENDPOINT_GUID:
-        reader_data.readerProxy.remoteReaderGuid = param.guid();
-        break;
-      case PID_UNICAST_LOCATOR:
-        DCPS::push_back(rtps_udp_locators, param.locator());
-        break;
-      case PID_MULTICAST_LOCATOR:
-        DCPS::push_back(rtps_udp_locators, param.locator());
-        break;
-      case PID_CONTENT_FILTER_PROPERTY:
-        reader_data.contentFilterProperty = param.content_filter_property();
-        break;
-      case PID_OPENDDS_LOCATOR:
-        // Append the rtps_udp_locators, if any, first, to preserve order
-        append_locators_if_present(reader_data.readerProxy.allLocators,
-                                   rtps_udp_locators);
-        rtps_udp_locators.length(0);
-        DCPS::push_back(reader_data.readerProxy.allLocators,
-                       param.opendds_locator());
-        break;
-      case PID_OPENDDS_ASSOCIATED_WRITER:
-        DCPS::push_back(reader_data.readerProxy.associatedWriters, param.guid());
-        break;
-      case PID_SENTINEL:
-      case PID_PAD:
-        // ignore
-        break;
-      case PID_XTYPES_TYPE_INFORMATION:
-        if (use_xtypes) {
-          extract_type_info_param(param, type_info);
-        }
-        break;
-      default:
-        if (param._d() & PIDMASK_INCOMPATIBLE) {
-          return false;
-        }
-    }
-  }
-  // Append additional rtps_udp_locators, if any
-  append_locators_if_present(reader_data.readerProxy.allLocators,
-                             rtps_udp_locators);
-  rtps_udp_locators.length(0);
-  return true;
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredReaderData& reader_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info)
+{
+  return read_endpoint_data(ser, reader_data, use_xtypes, type_info, 0);
 }
 
+#if OPENDDS_CONFIG_SECURITY
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredWriterData& writer_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info,
+                     ICE::AgentInfoMap& ai_map)
+{
+  return read_endpoint_data(ser, writer_data, use_xtypes, type_info, &ai_map);
+}
+
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredReaderData& reader_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info,
+                     ICE::AgentInfoMap& ai_map)
+{
+  return read_endpoint_data(ser, reader_data, use_xtypes, type_info, &ai_map);
+}
+#endif
+
 #if OPENDDS_CONFIG_SECURITY
 bool to_param_list(const DDS::Security::EndpointSecurityInfo& info,
                    ParameterList& param_list)
@@ -1630,34 +1943,14 @@ bool from_param_list(const ParameterList& param_list,
   for (CORBA::ULong idx = 0, count = param_list.length(); idx != count; ++idx) {
     const Parameter& parameter = param_list[idx];
     switch (parameter._d()) {
-    case PID_OPENDDS_ICE_GENERAL: {
-      const IceGeneral_t& ice_general = parameter.ice_general();
-      ICE::AgentInfo& agent_info = ai_map[OPENDDS_STRING(ice_general.key.in())];
-      agent_info.type = static_cast<ICE::AgentType>(ice_general.agent_type);
-      agent_info.username = ice_general.username;
-      agent_info.password = ice_general.password;
+    case PID_OPENDDS_ICE_GENERAL:
+      add_ice_general(ai_map, parameter.ice_general());
       break;
-    }
-    case PID_OPENDDS_ICE_CANDIDATE: {
-      const IceCandidate_t& ice_candidate = parameter.ice_candidate();
-      ICE::Candidate candidate;
-      // https://tools.ietf.org/html/rfc8445
-
-      // IPv4-mapped IPv6 addresses SHOULD NOT be included in the
-      // address candidates unless the application using ICE does not
-      // support IPv4 (i.e., it is an IPv6-only application
-      // [RFC4038]).
-      //
-      // Change this if we ever do an IPV6-only build.
-      if (locator_to_address(candidate.address, ice_candidate.locator, false /* do not map ipv4 to ipv6 */) != 0) {
+    case PID_OPENDDS_ICE_CANDIDATE:
+      if (!add_ice_candidate(ai_map, parameter.ice_candidate())) {
         return false;
       }
-      candidate.foundation = ice_candidate.foundation;
-      candidate.priority = ice_candidate.priority;
-      candidate.type = static_cast<ICE::CandidateType>(ice_candidate.type);
-      ai_map[OPENDDS_STRING(ice_candidate.key.in())].candidates.push_back(candidate);
       break;
-    }
     default:
       // Do nothing.
       break;
@@ -20,6 +20,7 @@
 
 #include "dds/DCPS/XTypes/TypeObject.h"
 #include "dds/DCPS/BuiltInTopicUtils.h"
+#include "dds/DCPS/Serializer.h"
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -172,6 +173,43 @@ bool from_param_list(const ParameterList& param_list,
                      bool use_xtypes,
                      XTypes::TypeInformation& type_info);
 
+// Serialized ParameterList of DiscoveredWriterData or DiscoveredReaderData
+
+// Same as deserializing a ParameterList and passing it to from_param_list,
+// but reads each parameter straight from ser and skips parameters that are
+// not used.  ser must be positioned at the first parameter and is left after
+// the sentinel.
+
+OpenDDS_Rtps_Export
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredWriterData& writer_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info);
+
+OpenDDS_Rtps_Export
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredReaderData& reader_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info);
+
+#if OPENDDS_CONFIG_SECURITY
+// Also collects the ICE agent info, see from_param_list(const ParameterList&, ICE::AgentInfoMap&)
+
+OpenDDS_Rtps_Export
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredWriterData& writer_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info,
+                     ICE::AgentInfoMap& ai_map);
+
+OpenDDS_Rtps_Export
+bool from_param_list(DCPS::Serializer& ser,
+                     DCPS::DiscoveredReaderData& reader_data,
+                     bool use_xtypes,
+                     XTypes::TypeInformation& type_info,
+                     ICE::AgentInfoMap& ai_map);
+#endif
+
 #if OPENDDS_CONFIG_SECURITY
 // DDS::Security::EndpointSecurityInfo
 
@@ -0,0 +1,61 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "ParticipantWorkers.h"
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace RTPS {
+
+ParticipantWorkers::ParticipantWorkers(size_t count)
+{
+  start(count);
+}
+
+ParticipantWorkers::~ParticipantWorkers()
+{
+  shutdown(true);
+}
+
+void
+ParticipantWorkers::start(size_t count)
+{
+  while (workers_.size() < count) {
+    workers_.push_back(DCPS::make_rch<DCPS::ServiceEventDispatcher>(1));
+  }
+}
+
+size_t
+ParticipantWorkers::index(const DCPS::GuidPrefix_t& prefix) const
+{
+  size_t hash = 0;
+  for (size_t i = 0; i < sizeof prefix; ++i) {
+    hash = hash * 31 + prefix[i];
+  }
+  return workers_.empty() ? 0 : hash % workers_.size();
+}
+
+bool
+ParticipantWorkers::dispatch(const DCPS::GuidPrefix_t& prefix, const DCPS::EventBase_rch& event)
+{
+  if (workers_.empty()) {
+    return false;
+  }
+  return workers_[index(prefix)]->dispatch(event);
+}
+
+void
+ParticipantWorkers::shutdown(bool immediate)
+{
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i]->shutdown(immediate);
+  }
+}
+
+} // namespace RTPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
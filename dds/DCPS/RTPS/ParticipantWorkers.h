@@ -0,0 +1,62 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+#ifndef OPENDDS_DCPS_RTPS_PARTICIPANT_WORKERS_H
+#define OPENDDS_DCPS_RTPS_PARTICIPANT_WORKERS_H
+
+#include "rtps_export.h"
+
+#include <dds/DCPS/PoolAllocator.h>
+#include <dds/DCPS/ServiceEventDispatcher.h>
+
+#include <dds/DdsDcpsGuidC.h>
+
+#ifndef ACE_LACKS_PRAGMA_ONCE
+#  pragma once
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace RTPS {
+
+/**
+ * A pool of single-threaded event dispatchers where the events for a
+ * remote participant, identified by its GUID prefix, always go to the same
+ * dispatcher.  Events for one participant therefore run one at a time and
+ * in the order they were dispatched, while different participants are
+ * processed in parallel.
+ */
+class OpenDDS_Rtps_Export ParticipantWorkers {
+public:
+  explicit ParticipantWorkers(size_t count = 0);
+  ~ParticipantWorkers();
+
+  /// Add workers until there are count of them.  Not thread safe with the
+  /// other member functions.
+  void start(size_t count);
+
+  size_t size() const { return workers_.size(); }
+
+  /// The worker used for the participant with "prefix".
+  size_t index(const DCPS::GuidPrefix_t& prefix) const;
+
+  /// Queue "event" on the worker for "prefix".  Returns false if there are
+  /// no workers or they have been shut down.
+  bool dispatch(const DCPS::GuidPrefix_t& prefix, const DCPS::EventBase_rch& event);
+
+  /// Stop the workers, either dropping the queued events (immediate) or
+  /// running them first, and wait for them to finish.
+  void shutdown(bool immediate);
+
+private:
+  OPENDDS_VECTOR(DCPS::ServiceEventDispatcher_rch) workers_;
+};
+
+} // namespace RTPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_DCPS_RTPS_PARTICIPANT_WORKERS_H
@@ -272,8 +272,54 @@ RtpsDiscovery::get_crypto_handle(DDS::DomainId_t domain,
   return DDS::HANDLE_NIL;
 }
 
+void
+RtpsDiscovery::get_handshake_latency(DDS::DomainId_t domain,
+                                     const DCPS::GUID_t& local_participant,
+                                     DCPS::HistogramSnapshot& snapshot) const
+{
+  ParticipantHandle p = get_part(domain, local_participant);
+  if (p) {
+    p->get_handshake_latency(snapshot);
+  }
+}
+
+void
+RtpsDiscovery::get_handshake_crypto_latency(DDS::DomainId_t domain,
+                                            const DCPS::GUID_t& local_participant,
+                                            DCPS::HistogramSnapshot& snapshot) const
+{
+  ParticipantHandle p = get_part(domain, local_participant);
+  if (p) {
+    p->get_handshake_crypto_latency(snapshot);
+  }
+}
+
 #endif
 
+size_t
+RtpsDiscovery::get_unchanged_spdp_announcements(DDS::DomainId_t domain,
+                                                const DCPS::GUID_t& local_participant) const
+{
+  ParticipantHandle p = get_part(domain, local_participant);
+  if (p) {
+    return p->unchanged_announcements();
+  }
+
+  return 0;
+}
+
+size_t
+RtpsDiscovery::get_unchanged_sedp_announcements(DDS::DomainId_t domain,
+                                                const DCPS::GUID_t& local_participant) const
+{
+  ParticipantHandle p = get_part(domain, local_participant);
+  if (p) {
+    return p->endpoint_manager().unchanged_announcements();
+  }
+
+  return 0;
+}
+
 RtpsDiscovery::StaticInitializer::StaticInitializer()
 {
   TheServiceParticipant->register_discovery_type("rtps_discovery", new Config);
@@ -184,8 +184,31 @@ public:
   DDS::Security::ParticipantCryptoHandle get_crypto_handle(DDS::DomainId_t domain,
                                                            const DCPS::GUID_t& local_participant,
                                                            const DCPS::GUID_t& remote_participant = GUID_UNKNOWN) const;
+
+  /// Microseconds from the start of authentication until a remote
+  /// participant was authenticated by "local_participant".
+  void get_handshake_latency(DDS::DomainId_t domain,
+                             const DCPS::GUID_t& local_participant,
+                             DCPS::HistogramSnapshot& snapshot) const;
+
+  /// Microseconds spent in each handshake call to the authentication plugin
+  /// by "local_participant".
+  void get_handshake_crypto_latency(DDS::DomainId_t domain,
+                                    const DCPS::GUID_t& local_participant,
+                                    DCPS::HistogramSnapshot& snapshot) const;
 #endif
 
+  /// Number of SPDP announcements received by "local_participant" that
+  /// were skipped because they hadn't changed since the last one.
+  size_t get_unchanged_spdp_announcements(DDS::DomainId_t domain,
+                                          const DCPS::GUID_t& local_participant) const;
+
+  /// Number of SEDP publication and subscription announcements received by
+  /// "local_participant" that were skipped because they hadn't changed
+  /// since the last one.
+  size_t get_unchanged_sedp_announcements(DDS::DomainId_t domain,
+                                          const DCPS::GUID_t& local_participant) const;
+
   u_short get_spdp_port(DDS::DomainId_t domain,
                         const DCPS::GUID_t& local_participant) const;
   u_short get_sedp_port(DDS::DomainId_t domain,
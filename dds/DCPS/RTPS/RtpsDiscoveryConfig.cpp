@@ -712,6 +712,20 @@ RtpsDiscoveryConfig::auth_resend_period(const DCPS::TimeDuration& x)
                                              DCPS::ConfigStoreImpl::Format_FractionalSeconds);
 }
 
+size_t
+RtpsDiscoveryConfig::auth_worker_threads() const
+{
+  return TheServiceParticipant->config_store()->get_uint32(config_key("AUTH_WORKER_THREADS").c_str(),
+                                                           0);
+}
+
+void
+RtpsDiscoveryConfig::auth_worker_threads(size_t n)
+{
+  TheServiceParticipant->config_store()->set_uint32(config_key("AUTH_WORKER_THREADS").c_str(),
+                                                    static_cast<DDS::UInt32>(n));
+}
+
 u_short
 RtpsDiscoveryConfig::max_spdp_sequence_msg_reset_check() const
 {
@@ -1127,6 +1141,20 @@ RtpsDiscoveryConfig::sedp_receive_preallocated_data_blocks(size_t n)
                                                     static_cast<DDS::UInt32>(n));
 }
 
+size_t
+RtpsDiscoveryConfig::sedp_worker_threads() const
+{
+  return TheServiceParticipant->config_store()->get_uint32(config_key("SEDP_WORKER_THREADS").c_str(),
+                                                           0);
+}
+
+void
+RtpsDiscoveryConfig::sedp_worker_threads(size_t n)
+{
+  TheServiceParticipant->config_store()->set_uint32(config_key("SEDP_WORKER_THREADS").c_str(),
+                                                    static_cast<DDS::UInt32>(n));
+}
+
 bool
 RtpsDiscoveryConfig::check_source_ip() const
 {
@@ -1155,6 +1183,34 @@ RtpsDiscoveryConfig::spdp_user_tag(ACE_CDR::ULong tag)
                                                     tag);
 }
 
+String
+RtpsDiscoveryConfig::discovery_cache() const
+{
+  return TheServiceParticipant->config_store()->get(config_key("DISCOVERY_CACHE").c_str(), "");
+}
+
+void
+RtpsDiscoveryConfig::discovery_cache(const String& path)
+{
+  TheServiceParticipant->config_store()->set(config_key("DISCOVERY_CACHE").c_str(), path);
+}
+
+DCPS::TimeDuration
+RtpsDiscoveryConfig::discovery_cache_period() const
+{
+  return TheServiceParticipant->config_store()->get(config_key("DISCOVERY_CACHE_PERIOD").c_str(),
+                                                    TimeDuration(60),
+                                                    DCPS::ConfigStoreImpl::Format_IntegerSeconds);
+}
+
+void
+RtpsDiscoveryConfig::discovery_cache_period(const DCPS::TimeDuration& period)
+{
+  TheServiceParticipant->config_store()->set(config_key("DISCOVERY_CACHE_PERIOD").c_str(),
+                                             period,
+                                             DCPS::ConfigStoreImpl::Format_IntegerSeconds);
+}
+
 } // namespace DCPS
 } // namespace OpenDDS
 
@@ -167,6 +167,9 @@ public:
   DCPS::TimeDuration auth_resend_period() const;
   void auth_resend_period(const DCPS::TimeDuration& x);
 
+  size_t auth_worker_threads() const;
+  void auth_worker_threads(size_t n);
+
   u_short max_spdp_sequence_msg_reset_check() const;
   void max_spdp_sequence_msg_reset_check(u_short reset_value);
 
@@ -243,12 +246,21 @@ public:
   size_t sedp_receive_preallocated_data_blocks() const;
   void sedp_receive_preallocated_data_blocks(size_t n);
 
+  size_t sedp_worker_threads() const;
+  void sedp_worker_threads(size_t n);
+
   bool check_source_ip() const;
   void check_source_ip(bool flag);
 
   ACE_CDR::ULong spdp_user_tag() const;
   void spdp_user_tag(ACE_CDR::ULong tag);
 
+  String discovery_cache() const;
+  void discovery_cache(const String& path);
+
+  DCPS::TimeDuration discovery_cache_period() const;
+  void discovery_cache_period(const DCPS::TimeDuration& period);
+
 private:
   const String config_prefix_;
 };
@@ -282,6 +282,20 @@ using DCPS::NetworkAddress;
 namespace {
   const Encoding sedp_encoding(Encoding::KIND_XCDR1, DCPS::ENDIAN_LITTLE);
   const Encoding type_lookup_encoding(Encoding::KIND_XCDR2, DCPS::ENDIAN_NATIVE);
+
+  /// The transports a discovered endpoint is matched with.  Without its own
+  /// locators it uses the participant's, see
+  /// populate_transport_locator_sequence().
+  DCPS::TransportLocatorSeq discovered_transports(const DCPS::TransportLocatorSeq& locators)
+  {
+    if (locators.length()) {
+      return locators;
+    }
+    DCPS::TransportLocatorSeq rtps(1);
+    rtps.length(1);
+    rtps[0].transport_type = "rtps_udp";
+    return rtps;
+  }
 }
 
 RtpsDiscoveryCore::RtpsDiscoveryCore(RcHandle<RtpsDiscoveryConfig> config,
@@ -313,6 +327,7 @@ Sedp::Sedp(const GUID_t& participant_id, Spdp& owner, ACE_Thread_Mutex& lock)
   , type_lookup_service_sequence_number_(0)
   , use_xtypes_(true)
   , use_xtypes_complete_(false)
+  , unchanged_announcements_(0)
   , local_participant_automatic_liveliness_sn_(DCPS::SequenceNumber::SEQUENCENUMBER_UNKNOWN())
   , local_participant_manual_liveliness_sn_(DCPS::SequenceNumber::SEQUENCENUMBER_UNKNOWN())
 #if OPENDDS_CONFIG_SECURITY
@@ -532,6 +547,8 @@ Sedp::init(const GUID_t& guid,
   event_dispatcher_ = transport_inst_->event_dispatcher(domainId, 0);
   type_lookup_init(reactor_task_->interceptor());
 
+  discovery_workers_.start(disco.config()->sedp_worker_threads());
+
   // Configure and enable each reader/writer
   const bool reliable = true;
   const bool durable = true;
@@ -2060,6 +2077,9 @@ Sedp::shutdown()
   type_lookup_request_secure_reader_->shutting_down();
   type_lookup_reply_secure_reader_->shutting_down();
 #endif
+
+  // Drop what hasn't been processed and wait for the workers to finish.
+  discovery_workers_.shutdown(true);
   publications_writer_->shutting_down();
   subscriptions_writer_->shutting_down();
   participant_message_writer_->shutting_down();
@@ -2381,6 +2401,13 @@ Sedp::data_received(DCPS::MessageId message_id,
                                  , dpub.have_ice_agent_info_, dpub.ice_agent_info_
 #endif
                                  );
+
+  if (message_id == DCPS::SAMPLE_DATA) {
+    const DiscoveredPublicationIter iter = discovered_publications_.find(guid);
+    if (iter != discovered_publications_.end()) {
+      iter->second.digest_ = dpub.digest_;
+    }
+  }
 }
 
 #if OPENDDS_CONFIG_SECURITY
@@ -2717,6 +2744,46 @@ Sedp::data_received(DCPS::MessageId message_id,
                                  , dsub.have_ice_agent_info_, dsub.ice_agent_info_
 #endif
                                  );
+
+  if (message_id == DCPS::SAMPLE_DATA) {
+    const DiscoveredSubscriptionIter iter = discovered_subscriptions_.find(guid);
+    if (iter != discovered_subscriptions_.end()) {
+      iter->second.digest_ = dsub.digest_;
+    }
+  }
+}
+
+bool
+Sedp::unchanged_announcement(const GUID_t& guid, const AnnouncementDigest& digest)
+{
+  if (!spdp_.initialized() || spdp_.shutting_down()) { return false; }
+
+  ACE_GUARD_RETURN(ACE_Thread_Mutex, g, lock_, false);
+
+  if (ignoring(guid) || ignoring(make_part_guid(guid))) {
+    return false;
+  }
+
+  bool unchanged = false;
+  if (DCPS::GuidConverter(guid).isWriter()) {
+    const DiscoveredPublicationIter iter = discovered_publications_.find(guid);
+    unchanged = iter != discovered_publications_.end() && iter->second.digest_ == digest;
+  } else {
+    const DiscoveredSubscriptionIter iter = discovered_subscriptions_.find(guid);
+    unchanged = iter != discovered_subscriptions_.end() && iter->second.digest_ == digest;
+  }
+
+  if (unchanged) {
+    ++unchanged_announcements_;
+  }
+  return unchanged;
+}
+
+size_t
+Sedp::unchanged_announcements() const
+{
+  ACE_GUARD_RETURN(ACE_Thread_Mutex, g, lock_, 0);
+  return unchanged_announcements_;
 }
 
 #if OPENDDS_CONFIG_SECURITY
@@ -4145,6 +4212,27 @@ Sedp::DiscoveryReader::~DiscoveryReader()
 {
 }
 
+void
+Sedp::DiscoveryReader::data_received(const DCPS::ReceivedDataSample& sample)
+{
+  if (!sedp_.dispatch_to_worker(rchandle_from(this), sample)) {
+    Reader::data_received(sample);
+  }
+}
+
+void
+Sedp::DiscoveryReaderEvent::handle_event()
+{
+  reader_->Reader::data_received(sample_);
+}
+
+bool
+Sedp::dispatch_to_worker(const DiscoveryReader_rch& reader, const DCPS::ReceivedDataSample& sample)
+{
+  return discovery_workers_.dispatch(sample.header_.publication_id_.guidPrefix,
+                                     DCPS::make_rch<DiscoveryReaderEvent>(reader, sample));
+}
+
 Sedp::LivelinessReader::~LivelinessReader()
 {
 }
@@ -4161,13 +4249,40 @@ Sedp::Reader::assoc(const DCPS::AssociationData& publication)
 
 // Implementing TransportReceiveListener
 
+static bool key_fields_only(
+  const DCPS::ReceivedDataSample& sample,
+  DCPS::Extensibility extensibility)
+{
+  return sample.header_.key_fields_only_ && extensibility == DCPS::FINAL;
+}
+
+// Find PID_ENDPOINT_GUID without deserializing the rest of the ParameterList.
+static bool peek_endpoint_guid(const Serializer& ser, GUID_t& guid)
+{
+  DCPS::Message_Block_Ptr data(ser.trim(ser.length()));
+  if (!data) {
+    return false;
+  }
+  Serializer peek(data.get(), ser.encoding());
+  ACE_CDR::UShort pid, length;
+  while ((peek >> pid) && (peek >> length) && pid != PID_SENTINEL) {
+    if (pid == PID_ENDPOINT_GUID) {
+      return peek >> guid;
+    }
+    if (!peek.skip(length)) {
+      return false;
+    }
+  }
+  return false;
+}
+
 static bool decode_parameter_list(
   const DCPS::ReceivedDataSample& sample,
   Serializer& ser,
   DCPS::Extensibility extensibility,
   ParameterList& data)
 {
-  if (sample.header_.key_fields_only_ && extensibility == DCPS::FINAL) {
+  if (key_fields_only(sample, extensibility)) {
     GUID_t guid;
     if (!(ser >> guid)) return false;
     data.length(1);
@@ -4347,33 +4462,41 @@ Sedp::DiscoveryReader::data_received_i(const DCPS::ReceivedDataSample& sample,
   const DCPS::MessageId id = static_cast<DCPS::MessageId>(sample.header_.message_id_);
 
   if (entity_id == ENTITYID_SEDP_BUILTIN_PUBLICATIONS_WRITER) {
-    ParameterList data;
-    if (!decode_parameter_list(sample, ser, extensibility, data)) {
-      if (log_level >= LogLevel::Warning) {
-        ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Sedp::DiscoveryReader::data_received_i: "
-                   "failed to deserialize data\n"));
+    DiscoveredPublication wdata;
+#if OPENDDS_CONFIG_SECURITY
+    ICE::AgentInfoMap ai_map;
+#endif
+    bool decoded;
+    if (key_fields_only(sample, extensibility)) {
+      decoded = ParameterListConverter::from_param_list(ParameterList(), wdata.writer_data_, sedp_.use_xtypes_, wdata.type_info_) &&
+        (ser >> wdata.writer_data_.writerProxy.remoteWriterGuid);
+    } else {
+      if (id == DCPS::SAMPLE_DATA && ser.current()) {
+        // Resent announcements are usually unchanged and can be dropped
+        // before they are deserialized.
+        wdata.digest_ = AnnouncementDigest(*ser.current(), ser.length());
+        GUID_t guid;
+        if (peek_endpoint_guid(ser, guid) && sedp_.unchanged_announcement(guid, wdata.digest_)) {
+          return;
+        }
       }
-      return;
+      // Decode the parameters straight from the sample instead of building
+      // a ParameterList first.
+#if OPENDDS_CONFIG_SECURITY
+      decoded = ParameterListConverter::from_param_list(ser, wdata.writer_data_, sedp_.use_xtypes_, wdata.type_info_, ai_map);
+#else
+      decoded = ParameterListConverter::from_param_list(ser, wdata.writer_data_, sedp_.use_xtypes_, wdata.type_info_);
+#endif
     }
-
-    DiscoveredPublication wdata;
-    if (!ParameterListConverter::from_param_list(data, wdata.writer_data_, sedp_.use_xtypes_, wdata.type_info_)) {
+    if (!decoded) {
       if (log_level >= LogLevel::Warning) {
         ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Sedp::DiscoveryReader::data_received_i: "
-                   "failed to convert from ParameterList to DiscoveredWriterData\n"));
+                   "failed to deserialize DiscoveredWriterData\n"));
       }
       return;
     }
 #if OPENDDS_CONFIG_SECURITY
     wdata.have_ice_agent_info_ = false;
-    ICE::AgentInfoMap ai_map;
-    if (!ParameterListConverter::from_param_list(data, ai_map)) {
-      if (log_level >= LogLevel::Warning) {
-        ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Sedp::DiscoveryReader::data_received_i: "
-                   "failed to convert from ParameterList to ICE Agent info\n"));
-      }
-      return;
-    }
     const ICE::AgentInfoMap::const_iterator pos = ai_map.find("DATA");
     if (pos != ai_map.end()) {
       wdata.have_ice_agent_info_ = true;
@@ -4436,33 +4559,41 @@ Sedp::DiscoveryReader::data_received_i(const DCPS::ReceivedDataSample& sample,
     sedp_.data_received(id, wdata_secure);
 #endif
   } else if (entity_id == ENTITYID_SEDP_BUILTIN_SUBSCRIPTIONS_WRITER) {
-    ParameterList data;
-    if (!decode_parameter_list(sample, ser, extensibility, data)) {
-      if (log_level >= LogLevel::Warning) {
-        ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Sedp::DiscoveryReader::data_received_i: "
-                   "failed to deserialize SUBSCRIPTIONS_WRITER data\n"));
+    DiscoveredSubscription rdata;
+#if OPENDDS_CONFIG_SECURITY
+    ICE::AgentInfoMap ai_map;
+#endif
+    bool decoded;
+    if (key_fields_only(sample, extensibility)) {
+      decoded = ParameterListConverter::from_param_list(ParameterList(), rdata.reader_data_, sedp_.use_xtypes_, rdata.type_info_) &&
+        (ser >> rdata.reader_data_.readerProxy.remoteReaderGuid);
+    } else {
+      if (id == DCPS::SAMPLE_DATA && ser.current()) {
+        // Resent announcements are usually unchanged and can be dropped
+        // before they are deserialized.
+        rdata.digest_ = AnnouncementDigest(*ser.current(), ser.length());
+        GUID_t guid;
+        if (peek_endpoint_guid(ser, guid) && sedp_.unchanged_announcement(guid, rdata.digest_)) {
+          return;
+        }
       }
-      return;
+      // Decode the parameters straight from the sample instead of building
+      // a ParameterList first.
+#if OPENDDS_CONFIG_SECURITY
+      decoded = ParameterListConverter::from_param_list(ser, rdata.reader_data_, sedp_.use_xtypes_, rdata.type_info_, ai_map);
+#else
+      decoded = ParameterListConverter::from_param_list(ser, rdata.reader_data_, sedp_.use_xtypes_, rdata.type_info_);
+#endif
     }
-
-    DiscoveredSubscription rdata;
-    if (!ParameterListConverter::from_param_list(data, rdata.reader_data_, sedp_.use_xtypes_, rdata.type_info_)) {
+    if (!decoded) {
       if (log_level >= LogLevel::Warning) {
         ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Sedp::DiscoveryReader::data_received_i: "
-                   "failed to convert from ParameterList to DiscoveredReaderData\n"));
+                   "failed to deserialize DiscoveredReaderData\n"));
       }
       return;
     }
 #if OPENDDS_CONFIG_SECURITY
     rdata.have_ice_agent_info_ = false;
-    ICE::AgentInfoMap ai_map;
-    if (!ParameterListConverter::from_param_list(data, ai_map)) {
-      if (log_level >= LogLevel::Warning) {
-        ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Sedp::DiscoveryReader::data_received_i: "
-                   "failed to convert from ParameterList to ICE Agent info\n"));
-      }
-      return;
-    }
     const ICE::AgentInfoMap::const_iterator pos = ai_map.find("DATA");
     if (pos != ai_map.end()) {
       rdata.have_ice_agent_info_ = true;
@@ -6777,12 +6908,17 @@ void Sedp::match_endpoints(GUID_t repoId, const DCPS::TopicDetails& td, bool rem
   // Copy the endpoint set - lock can be released in match()
   RepoIdSet local_endpoints;
   RepoIdSet discovered_endpoints;
-  if (reader) {
-    local_endpoints = td.local_publications();
-    discovered_endpoints = td.discovered_publications();
+  if (!remove) {
+    match_candidates(repoId, td, local_endpoints, discovered_endpoints);
   } else {
-    local_endpoints = td.local_subscriptions();
-    discovered_endpoints = td.discovered_subscriptions();
+    match_index_.remove(repoId);
+    if (reader) {
+      local_endpoints = td.local_publications();
+      discovered_endpoints = td.discovered_publications();
+    } else {
+      local_endpoints = td.local_subscriptions();
+      discovered_endpoints = td.discovered_subscriptions();
+    }
   }
 
   const bool is_remote = !equal_guid_prefixes(repoId, participant_id_);
@@ -6821,6 +6957,84 @@ void Sedp::match_endpoints(GUID_t repoId, const DCPS::TopicDetails& td, bool rem
   }
 }
 
+void Sedp::match_candidates(const GUID_t& repoId, const DCPS::TopicDetails& td,
+                            RepoIdSet& local_endpoints, RepoIdSet& discovered_endpoints)
+{
+  const bool reader = DCPS::GuidConverter(repoId).isReader();
+  const bool is_remote = !equal_guid_prefixes(repoId, participant_id_);
+  const RepoIdSet& all_local = reader ? td.local_publications() : td.local_subscriptions();
+  const RepoIdSet& all_discovered = reader ? td.discovered_publications() : td.discovered_subscriptions();
+
+  String topic_name;
+  const RepoIdSet* matched = 0;
+  if (reader) {
+    const LocalSubscriptionIter lsi = local_subscriptions_.find(repoId);
+    const DiscoveredSubscriptionIter dsi = discovered_subscriptions_.find(repoId);
+    if (lsi != local_subscriptions_.end()) {
+      const TopicNameMap::const_iterator tn = topic_names_.find(lsi->second.topic_id_);
+      topic_name = tn == topic_names_.end() ? String() : tn->second;
+      match_index_.insert(repoId, topic_name, true,
+                          lsi->second.qos_, lsi->second.subscriber_qos_, lsi->second.trans_info_);
+      matched = &lsi->second.matched_endpoints_;
+    } else if (dsi != discovered_subscriptions_.end()) {
+      topic_name = dsi->second.get_topic_name();
+      match_index_.insert(repoId, topic_name, false,
+                          dsi->second.reader_data_.ddsSubscriptionData,
+                          discovered_transports(dsi->second.reader_data_.readerProxy.allLocators));
+      matched = &dsi->second.matched_endpoints_;
+    }
+  } else {
+    const LocalPublicationIter lpi = local_publications_.find(repoId);
+    const DiscoveredPublicationIter dpi = discovered_publications_.find(repoId);
+    if (lpi != local_publications_.end()) {
+      const TopicNameMap::const_iterator tn = topic_names_.find(lpi->second.topic_id_);
+      topic_name = tn == topic_names_.end() ? String() : tn->second;
+      match_index_.insert(repoId, topic_name, true,
+                          lpi->second.qos_, lpi->second.publisher_qos_, lpi->second.trans_info_);
+      matched = &lpi->second.matched_endpoints_;
+    } else if (dpi != discovered_publications_.end()) {
+      topic_name = dpi->second.get_topic_name();
+      match_index_.insert(repoId, topic_name, false,
+                          dpi->second.writer_data_.ddsPublicationData,
+                          discovered_transports(dpi->second.writer_data_.writerProxy.allLocators));
+      matched = &dpi->second.matched_endpoints_;
+    }
+  }
+
+  if (!matched) {
+    local_endpoints = all_local;
+    if (!is_remote) {
+      discovered_endpoints = all_discovered;
+    }
+    return;
+  }
+
+  // Only narrow down the endpoints when the index knows all of them,
+  // otherwise fall back to considering every endpoint on the topic.
+  if (match_index_.count(topic_name, !reader, true) == all_local.size()) {
+    match_index_.candidates(repoId, true, local_endpoints);
+  } else {
+    local_endpoints = all_local;
+  }
+  if (!is_remote) {
+    if (match_index_.count(topic_name, !reader, false) == all_discovered.size()) {
+      match_index_.candidates(repoId, false, discovered_endpoints);
+    } else {
+      discovered_endpoints = all_discovered;
+    }
+  }
+
+  // Existing matches are always reconsidered so that they are broken if
+  // the partitions no longer match.
+  for (RepoIdSet::const_iterator iter = matched->begin(); iter != matched->end(); ++iter) {
+    if (all_local.count(*iter)) {
+      local_endpoints.insert(*iter);
+    } else if (!is_remote && all_discovered.count(*iter)) {
+      discovered_endpoints.insert(*iter);
+    }
+  }
+}
+
 void Sedp::cleanup_writer_association(DCPS::DataWriterCallbacks_wrch callbacks,
                                       const GUID_t& writer,
                                       const GUID_t& reader)
@@ -7409,8 +7623,8 @@ void Sedp::match_continue(const GUID_t& writer, const GUID_t& reader)
   DCPS::IncompatibleQosStatus writerStatus = {0, 0, 0, DDS::QosPolicyCountSeq()};
   DCPS::IncompatibleQosStatus readerStatus = {0, 0, 0, DDS::QosPolicyCountSeq()};
 
-  if (compatibleQOS(&writerStatus, &readerStatus, *wTls, *rTls,
-      dwQos, drQos, pubQos, subQos)) {
+  if (match_index_.compatible(writer, reader, writerStatus, readerStatus, *wTls, *rTls,
+                              *dwQos, *drQos, *pubQos, *subQos)) {
 
     bool call_writer = false, call_reader = false;
 
@@ -10,9 +10,11 @@
 
 #include "AssociationRecord.h"
 #include "DiscoveredEntities.h"
+#include "EndpointMatchIndex.h"
 #include "LocalEntities.h"
 #include "MessageTypes.h"
 #include "MessageUtils.h"
+#include "ParticipantWorkers.h"
 #include "TypeLookupTypeSupportImpl.h"
 #if OPENDDS_CONFIG_SECURITY
 #  include "ParameterListConverter.h"
@@ -445,6 +447,10 @@ public:
     return ignored_topics_.count(topic_name);
   }
 
+  /// Number of SEDP announcements that matched the last one applied for
+  /// their endpoint and were dropped without being deserialized.
+  size_t unchanged_announcements() const;
+
   DCPS::TopicStatus assert_topic(
     GUID_t& topicId, const char* topicName,
     const char* dataTypeName, const DDS::TopicQos& qos,
@@ -894,6 +900,10 @@ private:
 
     virtual ~DiscoveryReader();
 
+    /// Hands the sample to a discovery worker, if there are any, otherwise
+    /// processes it on the calling thread.
+    void data_received(const DCPS::ReceivedDataSample& sample);
+
   private:
     virtual void data_received_i(const DCPS::ReceivedDataSample& sample,
       const DCPS::EntityId_t& entity_id,
@@ -903,6 +913,24 @@ private:
 
   typedef DCPS::RcHandle<DiscoveryReader> DiscoveryReader_rch;
 
+  class DiscoveryReaderEvent : public DCPS::EventBase {
+  public:
+    DiscoveryReaderEvent(const DiscoveryReader_rch& reader, const DCPS::ReceivedDataSample& sample)
+      : reader_(reader)
+      , sample_(sample)
+    {}
+
+  private:
+    virtual void handle_event();
+
+    const DiscoveryReader_rch reader_;
+    const DCPS::ReceivedDataSample sample_;
+  };
+
+  /// Queue the sample on the worker for its remote participant.  Returns
+  /// false if there are no workers or they have been shut down.
+  bool dispatch_to_worker(const DiscoveryReader_rch& reader, const DCPS::ReceivedDataSample& sample);
+
   class LivelinessReader : public Reader {
   public:
     LivelinessReader(const DCPS::GUID_t& sub_id, Sedp& sedp)
@@ -1021,6 +1049,10 @@ private:
   DCPS::ReactorTask_rch reactor_task_;
   DCPS::JobQueue_rch job_queue_;
   DCPS::EventDispatcher_rch event_dispatcher_;
+  /// Publications and subscriptions are decoded by these workers when
+  /// SedpWorkerThreads is set.  A remote participant always maps to the same
+  /// single-threaded worker, so its announcements stay in order.
+  ParticipantWorkers discovery_workers_;
 
   void populate_discovered_writer_msg(
       DCPS::DiscoveredWriterData& dwd,
@@ -1047,6 +1079,10 @@ private:
   void data_received(DCPS::MessageId message_id,
                      const DiscoveredPublication& wdata);
 
+  /// Returns true if the endpoint has already been discovered and digest
+  /// matches its last applied announcement.
+  bool unchanged_announcement(const GUID_t& guid, const AnnouncementDigest& digest);
+
 #if OPENDDS_CONFIG_SECURITY
   void data_received(DCPS::MessageId message_id,
                      const ParameterListConverter::DiscoveredPublication_SecurityWrapper& wrapper);
@@ -1300,6 +1336,11 @@ protected:
   void match_endpoints(GUID_t repoId, const DCPS::TopicDetails& td,
                        bool remove = false);
 
+  /// Index repoId and collect the endpoints of td that match_endpoints()
+  /// has to consider for it.
+  void match_candidates(const GUID_t& repoId, const DCPS::TopicDetails& td,
+                        RepoIdSet& local_endpoints, RepoIdSet& discovered_endpoints);
+
   void remove_assoc(const GUID_t& remove_from, const GUID_t& removing);
 
   struct MatchingData {
@@ -1485,6 +1526,7 @@ protected:
   DiscoveredSubscriptionMap discovered_subscriptions_;
   DCPS::TopicDetailsMap topics_;
   TopicNameMap topic_names_;
+  EndpointMatchIndex match_index_;
   OPENDDS_SET(String) ignored_topics_;
   OPENDDS_SET_CMP(GUID_t, GUID_tKeyLessThan) relay_only_readers_;
   XTypes::TypeLookupService_rch type_lookup_service_;
@@ -1495,6 +1537,7 @@ protected:
   DCPS::SequenceNumber type_lookup_service_sequence_number_;
   const bool use_xtypes_;
   const bool use_xtypes_complete_;
+  size_t unchanged_announcements_;
 
   // These are the last sequence numbers sent for the various "liveliness" instances.
   DCPS::SequenceNumber local_participant_automatic_liveliness_sn_;
@@ -127,6 +127,37 @@ namespace {
     attr.ac_endpoint_properties.length(0);
   }
 
+  /// Times an authentication plugin call and, if unlock is true, releases
+  /// the Spdp lock for its duration.
+  class AuthCall {
+  public:
+    AuthCall(ACE_Thread_Mutex& lock, bool unlock, DCPS::Histogram& latency)
+      : lock_(lock)
+      , unlock_(unlock)
+      , latency_(latency)
+      , start_(MonotonicTimePoint::now())
+    {
+      if (unlock_) {
+        lock_.release();
+      }
+    }
+
+    ~AuthCall()
+    {
+      const ACE_Time_Value elapsed = (MonotonicTimePoint::now() - start_).value();
+      latency_.record(static_cast<ACE_UINT64>(elapsed.sec()) * 1000000 + elapsed.usec());
+      if (unlock_) {
+        lock_.acquire();
+      }
+    }
+
+  private:
+    ACE_Thread_Mutex& lock_;
+    const bool unlock_;
+    DCPS::Histogram& latency_;
+    const MonotonicTimePoint start_;
+  };
+
 #endif
 
   inline bool prop_to_bool(const DDS::Property_t& prop)
@@ -136,13 +167,19 @@ namespace {
   }
 }
 
-void Spdp::init(DDS::DomainId_t /*domain*/,
+void Spdp::init(DDS::DomainId_t domain,
                 DCPS::GUID_t& guid,
                 const DDS::DomainParticipantQos& qos,
                 XTypes::TypeLookupService_rch tls)
 {
   type_lookup_service_ = tls;
 
+  discovery_cache_path_ = config_->discovery_cache();
+  if (!discovery_cache_path_.empty()) {
+    discovery_cache_path_ += "." + DCPS::to_dds_string(domain);
+    load_discovery_cache();
+  }
+
   bool enable_endpoint_announcements = true;
   bool enable_type_lookup_service = config_->use_xtypes();
 
@@ -220,6 +257,74 @@ void Spdp::init(DDS::DomainId_t /*domain*/,
   sedp_->ignore(guid);
 }
 
+void Spdp::load_discovery_cache()
+{
+  DiscoveryCache cache;
+  if (!cache.load(discovery_cache_path_, DCPS::SystemTimePoint::now())) {
+    if (DCPS::DCPS_debug_level) {
+      ACE_DEBUG((LM_DEBUG, "(%P|%t) Spdp::load_discovery_cache: "
+                 "could not load discovery cache %C\n", discovery_cache_path_.c_str()));
+    }
+    return;
+  }
+
+  provisional_participants_.swap(cache.participants);
+  if (type_lookup_service_) {
+    type_lookup_service_->add_type_objects_to_cache(cache.types);
+  }
+
+  if (DCPS::DCPS_debug_level) {
+    ACE_DEBUG((LM_DEBUG, "(%P|%t) Spdp::load_discovery_cache: "
+               "loaded %B participants and %u type objects from %C\n",
+               provisional_participants_.size(), cache.types.length(),
+               discovery_cache_path_.c_str()));
+  }
+}
+
+void Spdp::save_discovery_cache()
+{
+  if (discovery_cache_path_.empty()) {
+    return;
+  }
+
+  DiscoveryCache cache;
+  {
+    ACE_GUARD(ACE_Thread_Mutex, g, lock_);
+    const DCPS::SystemTimePoint now = DCPS::SystemTimePoint::now();
+    const MonotonicTimePoint mono_now = MonotonicTimePoint::now();
+    for (DiscoveredParticipantConstIter it = participants_.begin(); it != participants_.end(); ++it) {
+      if (!it->second.last_recv_address_ || it->second.lease_expiration_ <= mono_now) {
+        continue;
+      }
+      DiscoveryCache::Participant& participant = cache.participants[it->first];
+      participant.address = it->second.last_recv_address_;
+      participant.expires = now + (it->second.lease_expiration_ - mono_now);
+    }
+    for (DiscoveryCache::ParticipantMap::const_iterator it = provisional_participants_.begin();
+         it != provisional_participants_.end(); ++it) {
+      if (it->second.expires > now) {
+        cache.participants.insert(*it);
+      }
+    }
+  }
+
+  if (type_lookup_service_) {
+    type_lookup_service_->get_hashed_type_objects(cache.types);
+  }
+
+  if (!cache.save(discovery_cache_path_, DCPS::SystemTimePoint::now(), guid_)) {
+    if (log_level >= LogLevel::Warning) {
+      ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: Spdp::save_discovery_cache: "
+                 "could not write discovery cache %C\n", discovery_cache_path_.c_str()));
+    }
+  } else if (DCPS::DCPS_debug_level > 4) {
+    ACE_DEBUG((LM_DEBUG, "(%P|%t) Spdp::save_discovery_cache: "
+               "saved %B participants and %u type objects to %C\n",
+               cache.participants.size(), cache.types.length(),
+               discovery_cache_path_.c_str()));
+  }
+}
+
 Spdp::Spdp(DDS::DomainId_t domain,
            GUID_t& guid,
            const DDS::DomainParticipantQos& qos,
@@ -245,6 +350,7 @@ Spdp::Spdp(DDS::DomainId_t domain,
   , max_auth_time_(disco->config()->max_auth_time())
   , secure_participant_user_data_(disco->config()->secure_participant_user_data())
 #endif
+  , unchanged_announcements_(0)
   , domain_(domain)
   , guid_(guid)
   , participant_discovered_at_(MonotonicTimePoint::now().to_monotonic_time())
@@ -268,6 +374,8 @@ Spdp::Spdp(DDS::DomainId_t domain,
   , permissions_handle_(DDS::HANDLE_NIL)
   , crypto_handle_(DDS::HANDLE_NIL)
   , ice_agent_(ICE::Agent::instance())
+  , handshake_latency_(DCPS::make_rch<DCPS::Histogram>())
+  , handshake_crypto_latency_(DCPS::make_rch<DCPS::Histogram>())
   , n_participants_in_authentication_(0)
 #endif
 {
@@ -308,6 +416,7 @@ Spdp::Spdp(DDS::DomainId_t domain,
   , auth_resend_period_(disco->config()->auth_resend_period())
   , max_auth_time_(disco->config()->max_auth_time())
   , secure_participant_user_data_(disco->config()->secure_participant_user_data())
+  , unchanged_announcements_(0)
   , domain_(domain)
   , guid_(guid)
   , participant_discovered_at_(MonotonicTimePoint::now().to_monotonic_time())
@@ -331,12 +440,19 @@ Spdp::Spdp(DDS::DomainId_t domain,
   , permissions_handle_(perm_handle)
   , crypto_handle_(crypto_handle)
   , ice_agent_(ICE::Agent::instance())
+  , handshake_latency_(DCPS::make_rch<DCPS::Histogram>())
+  , handshake_crypto_latency_(DCPS::make_rch<DCPS::Histogram>())
   , n_participants_in_authentication_(0)
 {
   ACE_GUARD(ACE_Thread_Mutex, g, lock_);
 
   init(domain, guid_, qos, tls);
 
+  const size_t auth_workers = config_->auth_worker_threads();
+  for (size_t i = 0; i < auth_workers; ++i) {
+    auth_workers_.push_back(DCPS::make_rch<DCPS::ServiceEventDispatcher>(1));
+  }
+
   DDS::Security::Authentication_var auth = security_config_->get_authentication();
   DDS::Security::AccessControl_var access = security_config_->get_access_control();
 
@@ -396,6 +512,16 @@ Spdp::Spdp(DDS::DomainId_t domain,
 void
 Spdp::shutdown()
 {
+  save_discovery_cache();
+
+#if OPENDDS_CONFIG_SECURITY
+  // Handshakes still queued are dropped.  One in progress takes lock_, so
+  // wait for it before taking lock_ here.
+  for (size_t i = 0; i < auth_workers_.size(); ++i) {
+    auth_workers_[i]->shutdown(true);
+  }
+#endif
+
   {
     ACE_GUARD(ACE_Thread_Mutex, g, lock_);
     shutdown_flag_ = true;
@@ -751,7 +877,8 @@ Spdp::handle_participant_data(DCPS::MessageId id,
                               const DCPS::MonotonicTimePoint& now,
                               const DCPS::SequenceNumber& seq,
                               const DCPS::NetworkAddress& from,
-                              bool from_sedp)
+                              bool from_sedp,
+                              const AnnouncementDigest& digest)
 {
   // Make a (non-const) copy so we can tweak values below
   ParticipantData_t pdata(cpdata);
@@ -862,12 +989,14 @@ Spdp::handle_participant_data(DCPS::MessageId id,
 #endif
     iter = p.first;
     iter->second.discovered_at_ = now;
+    iter->second.spdp_digest_ = digest;
     update_lease_expiration_i(iter, now);
     update_rtps_relay_application_participant_i(iter, p.second);
 
     if (!from_relay && from) {
       iter->second.last_recv_address_ = from;
     }
+    provisional_participants_.erase(guid);
 
     if (DCPS::transport_debug.log_progress) {
       log_progress("participant discovery", guid_, guid, iter->second.discovered_at_.to_monotonic_time());
@@ -969,6 +1098,7 @@ Spdp::handle_participant_data(DCPS::MessageId id,
     // Non-secure updates for authenticated participants are used for liveliness but
     // are otherwise ignored. Non-secure dispose messages are ignored completely.
     if (is_security_enabled() && iter->second.auth_state_ == AUTH_STATE_AUTHENTICATED && !from_sedp) {
+      iter->second.spdp_digest_ = digest;
       update_lease_expiration_i(iter, now);
       if (!from_relay && from) {
         iter->second.last_recv_address_ = from;
@@ -1027,6 +1157,9 @@ Spdp::handle_participant_data(DCPS::MessageId id,
       const DCPS::MonotonicTime_t da = iter->second.pdata_.discoveredAt;
       iter->second.pdata_ = pdata;
       iter->second.pdata_.discoveredAt = da;
+      if (!from_sedp) {
+        iter->second.spdp_digest_ = digest;
+      }
       update_lease_expiration_i(iter, now);
       update_rtps_relay_application_participant_i(iter, false);
       if (!from_relay && from) {
@@ -1082,10 +1215,57 @@ Spdp::validateSequenceNumber(const DCPS::MonotonicTimePoint& now, const DCPS::Se
   return true;
 }
 
+bool
+Spdp::unchanged_announcement(const GUID_t& guid,
+                             const AnnouncementDigest& digest,
+                             const DCPS::SequenceNumber& seq,
+                             const DCPS::NetworkAddress& from)
+{
+  ACE_GUARD_RETURN(ACE_Thread_Mutex, g, lock_, false);
+
+  if (!initialized_flag_ || shutdown_flag_ || sedp_->ignoring(guid)) {
+    return false;
+  }
+
+  const DiscoveredParticipantIter iter = participants_.find(guid);
+  if (iter == participants_.end() || !(iter->second.spdp_digest_ == digest)) {
+    return false;
+  }
+
+  // A sequence number going backwards may mean the participant restarted,
+  // which handle_participant_data has to check.
+  if (seq.getValue() != 0 && iter->second.max_seq_ != DCPS::SequenceNumber::MAX_VALUE &&
+      seq < iter->second.max_seq_) {
+    return false;
+  }
+
+  const bool from_relay = sedp_->core().from_relay(from);
+  if (check_source_ip_ && !from_relay && from != iter->second.last_recv_address_ &&
+      !ip_in_locator_list(from, iter->second.pdata_.participantProxy.metatrafficUnicastLocatorList)) {
+    return false;
+  }
+
+  const MonotonicTimePoint now = MonotonicTimePoint::now();
+  validateSequenceNumber(now, seq, iter);
+  update_lease_expiration_i(iter, now);
+  if (!from_relay && from) {
+    iter->second.last_recv_address_ = from;
+  }
+
+#ifndef DDS_HAS_MINIMUM_BIT
+  enqueue_location_update_i(iter, compute_location_mask(from, from_relay), from, "unchanged participant");
+  process_location_updates_i(iter, "unchanged SPDP");
+#endif
+
+  ++unchanged_announcements_;
+  return true;
+}
+
 void
 Spdp::data_received(const DataSubmessage& data,
                     const ParameterList& plist,
-                    const DCPS::NetworkAddress& from)
+                    const DCPS::NetworkAddress& from,
+                    const AnnouncementDigest& digest)
 {
   ACE_Guard<ACE_Thread_Mutex> guard(lock_);
   if (!initialized_flag_ || shutdown_flag_) {
@@ -1153,7 +1333,7 @@ Spdp::data_received(const DataSubmessage& data,
   guard.release();
 #endif
 
-  handle_participant_data(msg_id, pdata, now, to_opendds_seqnum(data.writerSN), from, false);
+  handle_participant_data(msg_id, pdata, now, to_opendds_seqnum(data.writerSN), from, false, digest);
 }
 
 void
@@ -1332,9 +1512,13 @@ Spdp::send_handshake_request(const DCPS::GUID_t& guid, DiscoveredParticipant& dp
   }
 
   DDS::Security::HandshakeMessageToken hs_mt;
-  if (auth->begin_handshake_request(dp.handshake_handle_, hs_mt, identity_handle_, dp.identity_handle_,
-                                    local_participant, se)
-      != DDS::Security::VALIDATION_PENDING_HANDSHAKE_MESSAGE) {
+  DDS::Security::ValidationResult_t vr;
+  {
+    const AuthCall call(lock_, false, *handshake_crypto_latency_);
+    vr = auth->begin_handshake_request(dp.handshake_handle_, hs_mt, identity_handle_, dp.identity_handle_,
+                                       local_participant, se);
+  }
+  if (vr != DDS::Security::VALIDATION_PENDING_HANDSHAKE_MESSAGE) {
     ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) ERROR: Spdp::send_handshake_request() - ")
                ACE_TEXT("Failed to begin handshake_request. Security Exception[%d.%d]: %C\n"),
                se.code, se.minor_code, se.message.in()));
@@ -1390,7 +1574,8 @@ Spdp::attempt_authentication(const DiscoveredParticipantIter& iter, bool from_di
 
   // Reset.
   purge_handshake_deadlines(iter);
-  dp.handshake_deadline_ = DCPS::MonotonicTimePoint::now() + max_auth_time_;
+  dp.handshake_start_ = DCPS::MonotonicTimePoint::now();
+  dp.handshake_deadline_ = dp.handshake_start_ + max_auth_time_;
   handshake_deadlines_.insert(std::make_pair(dp.handshake_deadline_, guid));
   tport_->handshake_deadline_task_->schedule(max_auth_time_);
 
@@ -1482,8 +1667,71 @@ Spdp::attempt_authentication(const DiscoveredParticipantIter& iter, bool from_di
   }
 }
 
+void
+Spdp::get_handshake_latency(DCPS::HistogramSnapshot& snapshot) const
+{
+  handshake_latency_->snapshot(snapshot);
+}
+
+void
+Spdp::get_handshake_crypto_latency(DCPS::HistogramSnapshot& snapshot) const
+{
+  handshake_crypto_latency_->snapshot(snapshot);
+}
+
+void
+Spdp::HandshakeEvent::handle_event()
+{
+  spdp_->process_handshake_message(msg_, true);
+}
+
 void
 Spdp::handle_handshake_message(const DDS::Security::ParticipantStatelessMessage& msg)
+{
+  if (!auth_workers_.empty()) {
+    const DCPS::GuidPrefix_t& prefix = msg.message_identity.source_guid.guidPrefix;
+    size_t hash = 0;
+    for (size_t i = 0; i < sizeof prefix; ++i) {
+      hash = hash * 31 + prefix[i];
+    }
+    if (auth_workers_[hash % auth_workers_.size()]->dispatch(
+          DCPS::make_rch<HandshakeEvent>(rchandle_from(this), msg))) {
+      return;
+    }
+  }
+
+  process_handshake_message(msg, false);
+}
+
+bool
+Spdp::resume_handshake(const DCPS::GUID_t& guid, const DiscoveredParticipant* dp,
+                       HandshakeState state, CORBA::LongLong sequence_number,
+                       DDS::Security::HandshakeHandle handshake_handle,
+                       DiscoveredParticipantIter& iter)
+{
+  if (!initialized_flag_ || shutdown_flag_) {
+    return false;
+  }
+
+  const DiscoveredParticipantIter found = participants_.find(guid);
+  if (found == participants_.end() || &found->second != dp ||
+      dp->handshake_state_ != state ||
+      dp->handshake_sequence_number_ != sequence_number ||
+      dp->handshake_handle_ != handshake_handle) {
+    if (DCPS::security_debug.auth_debug) {
+      ACE_DEBUG((LM_DEBUG, ACE_TEXT("(%P|%t) {auth_debug} DEBUG: Spdp::resume_handshake() - ")
+                 ACE_TEXT("handshake with %C changed while processing a message, dropping it\n"),
+                 DCPS::LogGuid(guid).c_str()));
+    }
+    return false;
+  }
+
+  iter = found;
+  return true;
+}
+
+void
+Spdp::process_handshake_message(const DDS::Security::ParticipantStatelessMessage& msg, bool on_worker)
 {
   DDS::Security::SecurityException se = {"", 0, 0};
   Security::Authentication_var auth = security_config_->get_authentication();
@@ -1616,9 +1864,23 @@ Spdp::handle_handshake_message(const DDS::Security::ParticipantStatelessMessage&
     if (!local_participant.length()) {
       return; // already logged in local_participant_data_as_octets()
     }
-    const DDS::Security::ValidationResult_t vr =
-      auth->begin_handshake_reply(dp.handshake_handle_, reply.message_data[0], dp.identity_handle_,
-                                  identity_handle_, local_participant, se);
+    const DDS::Security::IdentityHandle remote_identity_handle = dp.identity_handle_;
+    DDS::Security::HandshakeHandle handshake_handle = DDS::HANDLE_NIL;
+    DDS::Security::ValidationResult_t vr;
+    {
+      const AuthCall call(lock_, on_worker, *handshake_crypto_latency_);
+      vr = auth->begin_handshake_reply(handshake_handle, reply.message_data[0], remote_identity_handle,
+                                       identity_handle_, local_participant, se);
+    }
+    if (on_worker &&
+        !resume_handshake(src_participant, &dp, HANDSHAKE_STATE_BEGIN_HANDSHAKE_REPLY,
+                          msg.message_identity.sequence_number, DDS::HANDLE_NIL, iter)) {
+      if (handshake_handle != DDS::HANDLE_NIL) {
+        auth->return_handshake_handle(handshake_handle, se);
+      }
+      return;
+    }
+    dp.handshake_handle_ = handshake_handle;
 
     switch (vr) {
     case DDS::Security::VALIDATION_OK: {
@@ -1704,8 +1966,17 @@ Spdp::handle_handshake_message(const DDS::Security::ParticipantStatelessMessage&
     reply.source_endpoint_guid = GUID_UNKNOWN;
     reply.message_data.length(1);
 
-    DDS::Security::ValidationResult_t vr = auth->process_handshake(reply.message_data[0], msg.message_data[0],
-                                                                   dp.handshake_handle_, se);
+    const DDS::Security::HandshakeHandle handshake_handle = dp.handshake_handle_;
+    DDS::Security::ValidationResult_t vr;
+    {
+      const AuthCall call(lock_, on_worker, *handshake_crypto_latency_);
+      vr = auth->process_handshake(reply.message_data[0], msg.message_data[0], handshake_handle, se);
+    }
+    if (on_worker &&
+        !resume_handshake(src_participant, &dp, HANDSHAKE_STATE_PROCESS_HANDSHAKE,
+                          msg.message_identity.sequence_number, handshake_handle, iter)) {
+      return;
+    }
     switch (vr) {
     case DDS::Security::VALIDATION_FAILED: {
       if (DCPS::security_debug.auth_warn) {
@@ -2504,6 +2775,10 @@ Spdp::SpdpTransport::open(const DCPS::ReactorTask_rch& reactor_task,
   }
 #endif /* DDS_HAS_MINIMUM_BIT */
 
+  if (!outer->discovery_cache_path_.empty()) {
+    discovery_cache_task_ = DCPS::make_rch<SpdpPeriodic>(reactor_task->interceptor(), ref(*this), &SpdpTransport::save_discovery_cache);
+  }
+
   // Connect the listeners last so that the tasks are created.
   DCPS::ConfigListener::job_queue(job_queue);
   config_reader_ = DCPS::make_rch<DCPS::ConfigReader>(DCPS::ConfigStoreImpl::datareader_qos(), rchandle_from(this));
@@ -2587,6 +2862,13 @@ Spdp::SpdpTransport::enable_periodic_tasks()
     local_send_task_->enable(TimeDuration::zero_value);
   }
 
+  if (discovery_cache_task_) {
+    DCPS::RcHandle<Spdp> outer = outer_.lock();
+    if (outer) {
+      discovery_cache_task_->enable(false, outer->config_->discovery_cache_period());
+    }
+  }
+
 #if OPENDDS_CONFIG_SECURITY
   DCPS::RcHandle<Spdp> outer = outer_.lock();
   if (!outer) return;
@@ -2683,6 +2965,9 @@ Spdp::SpdpTransport::close(const DCPS::ReactorTask_rch& reactor_task)
   if (thread_status_task_) {
     thread_status_task_->disable();
   }
+  if (discovery_cache_task_) {
+    discovery_cache_task_->disable();
+  }
 
   ACE_Reactor* reactor = reactor_task->get_reactor();
   const ACE_Reactor_Mask mask =
@@ -2936,6 +3221,22 @@ Spdp::SpdpTransport::send(WriteFlags flags, const DCPS::NetworkAddress& local_ad
     for (iter_t iter = send_addrs_.begin(); iter != send_addrs_.end(); ++iter) {
       send(*iter);
     }
+
+    // Participants from the discovery cache are announced to directly so
+    // they don't have to wait for multicast or their own resend period.
+    const DCPS::SystemTimePoint now = DCPS::SystemTimePoint::now();
+    typedef DiscoveryCache::ParticipantMap::iterator prov_iter_t;
+    for (prov_iter_t iter = outer->provisional_participants_.begin();
+         iter != outer->provisional_participants_.end();) {
+      if (iter->second.expires <= now) {
+        outer->provisional_participants_.erase(iter++);
+        continue;
+      }
+      if (!send_addrs_.count(iter->second.address)) {
+        send(iter->second.address);
+      }
+      ++iter;
+    }
   }
 
   if (((flags & SEND_DIRECT) && !outer->sedp_->core().rtps_relay_only()) &&
@@ -3137,7 +3438,20 @@ Spdp::SpdpTransport::handle_input(ACE_HANDLE h)
         }
 
         ParameterList plist;
+        AnnouncementDigest digest;
         if (data.smHeader.flags & (FLAG_D | FLAG_K_IN_DATA)) {
+          // Periodic announcements are usually the same as the last one, in
+          // which case there is no need to deserialize them.
+          const size_t read = start - buff_.length();
+          const size_t payload_size = !submessageLength ? buff_.length()
+            : static_cast<size_t>(submessageLength + SMHDR_SZ) > read ? submessageLength + SMHDR_SZ - read : 0;
+          digest = AnnouncementDigest(buff_, payload_size);
+          if (!(data.inlineQos.length() && disposed(data.inlineQos)) &&
+              outer->unchanged_announcement(make_id(header.guidPrefix, ENTITYID_PARTICIPANT), digest,
+                                            to_opendds_seqnum(data.writerSN), remote_na)) {
+            break;
+          }
+
           DCPS::EncapsulationHeader encap;
           DCPS::Encoding enc;
           if (!(ser >> encap) || !encap.to_encoding(enc, DCPS::MUTABLE) || enc.kind() != Encoding::KIND_XCDR1) {
@@ -3167,7 +3481,7 @@ Spdp::SpdpTransport::handle_input(ACE_HANDLE h)
 
         DCPS::RcHandle<Spdp> outer = outer_.lock();
         if (outer) {
-          outer->data_received(data, plist, remote_na);
+          outer->data_received(data, plist, remote_na, digest);
         }
         break;
       }
@@ -3811,6 +4125,13 @@ Spdp::has_discovered_participant(const DCPS::GUID_t& guid) const
   return participants_.find(guid) != participants_.end();
 }
 
+size_t
+Spdp::unchanged_announcements() const
+{
+  ACE_GUARD_RETURN(ACE_Thread_Mutex, g, lock_, 0);
+  return unchanged_announcements_;
+}
+
 ACE_CDR::ULong Spdp::get_participant_flags(const DCPS::GUID_t& guid) const
 {
   const DiscoveredParticipantMap::const_iterator iter = participants_.find(guid);
@@ -4402,6 +4723,14 @@ Spdp::SpdpTransport::process_lease_expirations(const DCPS::MonotonicTimePoint& n
   outer->process_lease_expirations(now);
 }
 
+void Spdp::SpdpTransport::save_discovery_cache(const DCPS::MonotonicTimePoint& /*now*/)
+{
+  DCPS::RcHandle<Spdp> outer = outer_.lock();
+  if (!outer) return;
+
+  outer->save_discovery_cache();
+}
+
 void Spdp::SpdpTransport::thread_status_task(const DCPS::MonotonicTimePoint& now)
 {
   ACE_UNUSED_ARG(now);
@@ -4775,6 +5104,12 @@ void Spdp::set_auth_state(DiscoveredParticipant& dp, AuthState new_state)
       new_state != AUTH_STATE_HANDSHAKE) {
     --n_participants_in_authentication_;
   }
+  if (dp.auth_state_ != AUTH_STATE_AUTHENTICATED &&
+      new_state == AUTH_STATE_AUTHENTICATED &&
+      !dp.handshake_start_.is_zero()) {
+    const ACE_Time_Value elapsed = (MonotonicTimePoint::now() - dp.handshake_start_).value();
+    handshake_latency_->record(static_cast<ACE_UINT64>(elapsed.sec()) * 1000000 + elapsed.usec());
+  }
   dp.auth_state_ = new_state;
 }
 #endif
@@ -6,6 +6,7 @@
 #ifndef OPENDDS_DCPS_RTPS_SPDP_H
 #define OPENDDS_DCPS_RTPS_SPDP_H
 
+#include "DiscoveryCache.h"
 #include "Sedp.h"
 #include "rtps_export.h"
 #include "ICE/Ice.h"
@@ -16,6 +17,7 @@
 #include <dds/DCPS/Definitions.h>
 #include <dds/DCPS/Discovery.h>
 #include <dds/DCPS/GuidUtils.h>
+#include <dds/DCPS/Histogram.h>
 #include <dds/DCPS/JobQueue.h>
 #include <dds/DCPS/MultiTask.h>
 #include <dds/DCPS/MulticastManager.h>
@@ -25,6 +27,7 @@
 #include <dds/DCPS/RcEventHandler.h>
 #include <dds/DCPS/RcObject.h>
 #include <dds/DCPS/ReactorTask.h>
+#include <dds/DCPS/ServiceEventDispatcher.h>
 #include <dds/DCPS/SporadicTask.h>
 #include <dds/DCPS/TimeTypes.h>
 
@@ -122,6 +125,7 @@ public:
 
   bool associated() const;
   bool has_discovered_participant(const DCPS::GUID_t& guid) const;
+  size_t unchanged_announcements() const;
   ACE_CDR::ULong get_participant_flags(const DCPS::GUID_t& guid) const;
 
 #if OPENDDS_CONFIG_SECURITY
@@ -134,6 +138,14 @@ public:
   void handle_handshake_message(const DDS::Security::ParticipantStatelessMessage& msg);
   bool handle_participant_crypto_tokens(const DDS::Security::ParticipantVolatileMessageSecure& msg);
   DDS::OctetSeq local_participant_data_as_octets() const;
+
+  /// Microseconds from the start of authentication until a remote
+  /// participant was authenticated.
+  void get_handshake_latency(DCPS::HistogramSnapshot& snapshot) const;
+
+  /// Microseconds spent in each begin_handshake_request,
+  /// begin_handshake_reply, and process_handshake call.
+  void get_handshake_crypto_latency(DCPS::HistogramSnapshot& snapshot) const;
 #endif
 
   void handle_participant_data(DCPS::MessageId id,
@@ -141,7 +153,8 @@ public:
                                const DCPS::MonotonicTimePoint& now,
                                const DCPS::SequenceNumber& seq,
                                const DCPS::NetworkAddress& from,
-                               bool from_sedp);
+                               bool from_sedp,
+                               const AnnouncementDigest& digest = AnnouncementDigest());
 
   bool validateSequenceNumber(const DCPS::MonotonicTimePoint& now, const DCPS::SequenceNumber& seq, DiscoveredParticipantIter& iter);
 
@@ -373,6 +386,9 @@ private:
             const DDS::DomainParticipantQos& qos,
             XTypes::TypeLookupService_rch tls);
 
+  void load_discovery_cache();
+  void save_discovery_cache();
+
   mutable ACE_Thread_Mutex lock_;
   DCPS::RcHandle<DCPS::BitSubscriber> bit_subscriber_;
   DDS::DomainParticipantQos qos_;
@@ -399,6 +415,16 @@ private:
 #endif
   XTypes::TypeLookupService_rch type_lookup_service_;
 
+  /// Participants from the discovery cache that haven't announced themselves
+  /// since this participant started.  SPDP announcements are also sent to
+  /// them until they do or their lease would have expired.
+  DCPS::String discovery_cache_path_;
+  DiscoveryCache::ParticipantMap provisional_participants_;
+
+  /// SPDP announcements whose payload matched the last one applied for their
+  /// participant, so only the lease and location were updated.
+  size_t unchanged_announcements_;
+
   // Participant:
   const DDS::DomainId_t domain_;
   DCPS::GUID_t guid_;
@@ -409,7 +435,14 @@ private:
   DDS::UInt16 ipv6_participant_port_id_;
 #endif
 
-  void data_received(const DataSubmessage& data, const ParameterList& plist, const DCPS::NetworkAddress& from);
+  void data_received(const DataSubmessage& data, const ParameterList& plist, const DCPS::NetworkAddress& from,
+                     const AnnouncementDigest& digest);
+
+  /// If the participant has already been discovered and digest matches its
+  /// last applied announcement, renew its lease and return true.  Otherwise
+  /// the announcement has to be deserialized and passed to data_received.
+  bool unchanged_announcement(const DCPS::GUID_t& guid, const AnnouncementDigest& digest,
+                              const DCPS::SequenceNumber& seq, const DCPS::NetworkAddress& from);
 
   void match_unauthenticated(const DiscoveredParticipantIter& dp_iter);
 
@@ -548,6 +581,8 @@ private:
     DCPS::RcHandle<SpdpSporadic> lease_expiration_task_;
     void thread_status_task(const DCPS::MonotonicTimePoint& now);
     DCPS::RcHandle<SpdpPeriodic> thread_status_task_;
+    void save_discovery_cache(const DCPS::MonotonicTimePoint& now);
+    DCPS::RcHandle<SpdpPeriodic> discovery_cache_task_;
     DCPS::RcHandle<DCPS::InternalDataReader<DCPS::NetworkInterfaceAddress> > network_interface_address_reader_;
 #if OPENDDS_CONFIG_SECURITY
     void process_handshake_deadlines(const DCPS::MonotonicTimePoint& now);
@@ -662,6 +697,41 @@ private:
   void purge_handshake_resends(DiscoveredParticipantIter iter);
   TimeQueue handshake_resends_;
 
+  class HandshakeEvent : public DCPS::EventBase {
+  public:
+    HandshakeEvent(const DCPS::RcHandle<Spdp>& spdp,
+                   const DDS::Security::ParticipantStatelessMessage& msg)
+      : spdp_(spdp)
+      , msg_(msg)
+    {}
+
+  private:
+    virtual void handle_event();
+
+    const DCPS::RcHandle<Spdp> spdp_;
+    const DDS::Security::ParticipantStatelessMessage msg_;
+  };
+
+  /// Handshake messages are handed to one of these, picked by the remote
+  /// GUID prefix, when AuthWorkerThreads is set.
+  OPENDDS_VECTOR(DCPS::ServiceEventDispatcher_rch) auth_workers_;
+
+  /// If on_worker is true, lock_ is released while the authentication
+  /// plugin is called.
+  void process_handshake_message(const DDS::Security::ParticipantStatelessMessage& msg,
+                                 bool on_worker);
+
+  /// After lock_ was released for an authentication plugin call, check that
+  /// dp is still the participant's entry and that its handshake didn't move
+  /// on or restart in the meantime.  If so, iter is set to dp's entry.
+  bool resume_handshake(const DCPS::GUID_t& guid, const DiscoveredParticipant* dp,
+                        HandshakeState state, CORBA::LongLong sequence_number,
+                        DDS::Security::HandshakeHandle handshake_handle,
+                        DiscoveredParticipantIter& iter);
+
+  DCPS::RcHandle<DCPS::Histogram> handshake_latency_;
+  DCPS::RcHandle<DCPS::Histogram> handshake_crypto_latency_;
+
   size_t n_participants_in_authentication_;
   void set_auth_state(DiscoveredParticipant& dp, AuthState state);
 #endif
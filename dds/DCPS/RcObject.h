@@ -50,7 +50,11 @@ namespace DCPS {
     }
 
     RcObject* lock();
+#ifdef ACE_HAS_CPP11
+    void expire();
+#else
     bool check_expire(Atomic<long>& count);
+#endif
 
   private:
     mutable ACE_SYNCH_MUTEX mx_;
@@ -58,12 +62,27 @@ namespace DCPS {
     long ref_count_;
   };
 
+  /**
+   * Most objects are never the target of a WeakRcHandle, so when atomic
+   * compare-and-swap is available their WeakObject is created by the first
+   * call to _get_weak_object() instead of by the constructor.  Releasing a
+   * reference is then a single atomic decrement, and WeakObject::lock()
+   * refuses to revive an object whose count has reached zero.
+   */
   class OpenDDS_Dcps_Export RcObject : public PoolAllocationBase {
   public:
 
     virtual ~RcObject()
     {
+#ifdef ACE_HAS_CPP11
+      WeakObject* const weak_object = weak_object_;
+      if (weak_object) {
+        weak_object->expire();
+        weak_object->_remove_ref();
+      }
+#else
       weak_object_->_remove_ref();
+#endif
     }
 
     virtual void _add_ref()
@@ -73,9 +92,15 @@ namespace DCPS {
 
     virtual void _remove_ref()
     {
+#ifdef ACE_HAS_CPP11
+      if (--ref_count_ == 0) {
+        delete this;
+      }
+#else
       if (weak_object_->check_expire(ref_count_)) {
         delete this;
       }
+#endif
     }
 
     long ref_count() const
@@ -85,24 +110,78 @@ namespace DCPS {
 
     WeakObject* _get_weak_object() const
     {
+#ifdef ACE_HAS_CPP11
+      WeakObject* weak_object = weak_object_;
+      if (!weak_object) {
+        WeakObject* const created = new WeakObject(const_cast<RcObject*>(this));
+        if (weak_object_.compare_exchange_strong(weak_object, created)) {
+          weak_object = created;
+        } else {
+          // Another thread published one first, weak_object now points to it.
+          delete created;
+        }
+      }
+      weak_object->_add_ref();
+      return weak_object;
+#else
       weak_object_->_add_ref();
       return weak_object_;
+#endif
     }
 
   protected:
     RcObject()
       : ref_count_(1)
+#ifdef ACE_HAS_CPP11
+      , weak_object_(0)
+#else
       , weak_object_(new WeakObject(this))
+#endif
     {}
 
   private:
+    friend class WeakObject;
+
+#ifdef ACE_HAS_CPP11
+    /// Add a reference unless the count has already reached zero.
+    bool add_ref_if_referenced()
+    {
+      long count = ref_count_;
+      while (count != 0) {
+        if (ref_count_.compare_exchange_weak(count, count + 1)) {
+          return true;
+        }
+      }
+      return false;
+    }
+#endif
+
     Atomic<long> ref_count_;
+#ifdef ACE_HAS_CPP11
+    mutable Atomic<WeakObject*> weak_object_;
+#else
     WeakObject* weak_object_;
+#endif
 
     RcObject(const RcObject&);
     RcObject& operator=(const RcObject&);
   };
 
+#ifdef ACE_HAS_CPP11
+  inline RcObject* WeakObject::lock()
+  {
+    // ptr_ is cleared by ~RcObject, so it can be read here even after the
+    // count reached zero.
+    ACE_Guard<ACE_SYNCH_MUTEX> guard(mx_);
+    return ptr_ && ptr_->add_ref_if_referenced() ? ptr_ : 0;
+  }
+
+  inline void WeakObject::expire()
+  {
+    ACE_Guard<ACE_SYNCH_MUTEX> guard(mx_);
+    ptr_ = 0;
+  }
+#else
   inline RcObject* WeakObject::lock()
   {
     ACE_Guard<ACE_SYNCH_MUTEX> guard(mx_);
@@ -122,6 +201,7 @@ namespace DCPS {
     }
     return false;
   }
+#endif
 
   template <typename T>
   class WeakRcHandle
@@ -8,7 +8,6 @@
 #include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
 
 #include "ace/Log_Msg.h"
-#include "ace/Reverse_Lock_T.h"
 #include "ace/Synch.h"
 
 #include "ReactorInterceptor.h"
@@ -26,7 +25,7 @@ ReactorInterceptor::Command::Command()
 ReactorInterceptor::ReactorInterceptor(ACE_Reactor* reactor,
                                        ACE_thread_t owner)
   : owner_(owner)
-  , state_(RS_NONE)
+  , processing_(false)
 {
   RcEventHandler::reactor(reactor);
 }
@@ -39,38 +38,35 @@ ReactorInterceptor::CommandPtr ReactorInterceptor::execute_or_enqueue(CommandPtr
 {
   OPENDDS_ASSERT(command);
 
-  ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
-
   // Only allow immediate execution if running on the reactor thread, otherwise we risk deadlock
   // when calling into the reactor object.
   const bool is_owner = ACE_OS::thr_equal(owner_, ACE_Thread::self());
 
-  // If state is set to processing, the conents of command_queue_ have been swapped out
-  // so immediate execution may run jobs out of the expected order.
-  const bool is_not_processing = state_ != RS_PROCESSING;
-
-  // If the command_queue_ is not empty, allowing execution will potentially run unexpected code
-  // which is problematic since we may be holding locks used by the unexpected code.
-  const bool is_empty = command_queue_.empty();
+  // If commands taken from the queue are executing, immediate execution may run jobs out of the
+  // expected order.
+  const bool is_not_processing = !processing_;
+
+  // Always push to the queue.  If the queue was not empty, allowing execution will potentially
+  // run unexpected code which is problematic since we may be holding locks used by the
+  // unexpected code.  Only the command that finds the queue empty needs to notify.
+  const bool is_empty = command_queue_.push(command);
+
+  // Once the reactor is shut down nothing handles the notification, so the calling thread executes
+  // everything queued so far, in order, including commands queued by other threads.
+  if (reactor_is_shut_down()) {
+    ACE_Guard<ACE_Recursive_Thread_Mutex> guard(shut_down_mutex_);
+    process_command_queue();
+    return command;
+  }
 
   // If all three of these conditions are met, it should be safe to execute
   const bool is_safe_to_execute = is_owner && is_not_processing && is_empty;
 
-  // Even if it's not normally safe to execute, allow immediate execution if the reactor is shut down
-  const bool immediate = is_safe_to_execute || reactor_is_shut_down();
-
-  // Always set reactor and push to the queue
-  ACE_Reactor* local_reactor = ACE_Event_Handler::reactor();
-  command->set_reactor(local_reactor);
-  command_queue_.push_back(command);
-
   // But depending on whether we're running it immediately or not, we either process or notify
-  if (immediate) {
-    process_command_queue_i(guard);
-  } else if (state_ == RS_NONE) {
-    state_ = RS_NOTIFIED;
-    guard.release();
-    local_reactor->notify(this);
+  if (is_safe_to_execute) {
+    process_command_queue();
+  } else if (is_empty) {
+    reactor()->notify(this);
   }
   return command;
 }
@@ -79,32 +75,26 @@ int ReactorInterceptor::handle_exception(ACE_HANDLE /*fd*/)
 {
   ThreadStatusManager::Event ev(TheServiceParticipant->get_thread_status_manager());
 
-  ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
-  process_command_queue_i(guard);
+  process_command_queue();
   return 0;
 }
 
-void ReactorInterceptor::process_command_queue_i(ACE_Guard<ACE_Thread_Mutex>& guard)
+void ReactorInterceptor::process_command_queue()
 {
-  Queue cq;
-  ACE_Reverse_Lock<ACE_Thread_Mutex> rev_lock(mutex_);
-
-  state_ = RS_PROCESSING;
-  if (!command_queue_.empty()) {
-    cq.swap(command_queue_);
-    ACE_Guard<ACE_Reverse_Lock<ACE_Thread_Mutex> > rev_guard(rev_lock);
-    for (Queue::const_iterator pos = cq.begin(), limit = cq.end(); pos != limit; ++pos) {
-      (*pos)->execute();
-    }
+  // Commands pushed while these execute find the queue empty and notify again.
+  Queue::Batch cq;
+  if (!command_queue_.take_all(cq)) {
+    return;
   }
-  if (!command_queue_.empty()) {
-    state_ = RS_NOTIFIED;
-    ACE_Reactor* const reactor = ACE_Event_Handler::reactor();
-    guard.release();
-    reactor->notify(this);
-  } else {
-    state_ = RS_NONE;
+
+  ACE_Reactor* const local_reactor = reactor();
+  const bool was_processing = processing_;
+  processing_ = true;
+  for (Queue::Batch::const_iterator pos = cq.begin(), limit = cq.end(); pos != limit; ++pos) {
+    (*pos)->set_reactor(local_reactor);
+    (*pos)->execute();
   }
+  processing_ = was_processing;
 }
 
 void ReactorInterceptor::reactor(ACE_Reactor *reactor)
@@ -8,6 +8,8 @@
 #ifndef OPENDDS_DCPS_REACTORINTERCEPTOR_H
 #define OPENDDS_DCPS_REACTORINTERCEPTOR_H
 
+#include "AtomicBool.h"
+#include "MpscQueue.h"
 #include "PoolAllocator.h"
 #include "PoolAllocationBase.h"
 #include "RcEventHandler.h"
@@ -17,6 +19,7 @@
 #include "ConditionVariable.h"
 
 #include <ace/Reactor.h>
+#include <ace/Recursive_Thread_Mutex.h>
 #include <ace/Thread.h>
 #include <ace/Thread_Mutex.h>
 
@@ -57,24 +60,26 @@ public:
 
 protected:
 
-  enum ReactorState {
-    RS_NONE,
-    RS_NOTIFIED,
-    RS_PROCESSING
-  };
-
   ReactorInterceptor(ACE_Reactor* reactor,
                      ACE_thread_t owner);
 
   virtual ~ReactorInterceptor();
   int handle_exception(ACE_HANDLE /*fd*/);
-  void process_command_queue_i(ACE_Guard<ACE_Thread_Mutex>& guard);
+  /// Execute the queued commands.  Called on the owner thread, or with shut_down_mutex_ held once
+  /// the reactor is shut down.
+  void process_command_queue();
 
   ACE_thread_t owner_;
+  /// Only guards the reactor pointer for reactor(), which may be called from any thread.  Commands
+  /// are queued without a lock.
   mutable ACE_Thread_Mutex mutex_;
-  typedef OPENDDS_VECTOR(CommandPtr) Queue;
+  /// Keeps threads that execute the queue after the reactor is shut down from executing commands
+  /// at the same time.  Recursive since a command may queue another.
+  ACE_Recursive_Thread_Mutex shut_down_mutex_;
+  typedef MpscQueue<CommandPtr> Queue;
   Queue command_queue_;
-  ReactorState state_;
+  /// Set while commands taken from command_queue_ are executing.
+  AtomicBool processing_;
 };
 
 typedef RcHandle<ReactorInterceptor> ReactorInterceptor_rch;
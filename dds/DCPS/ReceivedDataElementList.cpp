@@ -54,8 +54,12 @@ void OpenDDS::DCPS::ReceivedDataElement::operator delete(void* memory, ACE_New_A
   operator delete(memory);
 }
 
-OpenDDS::DCPS::ReceivedDataElementList::ReceivedDataElementList(const DataReaderImpl_rch& reader, const InstanceState_rch& instance_state)
-  : reader_(reader), head_(0), tail_(0), size_(0)
+OpenDDS::DCPS::ReceivedDataElementList::ReceivedDataElementList(const DataReaderImpl_rch& reader,
+                                                                const InstanceState_rch& instance_state,
+                                                                const ReceivedSampleCounts_rch& sample_counts)
+  : reader_(reader), head_(0), tail_(0), size_(0), valid_data_size_(0)
+  , sample_counts_(sample_counts)
+  , timestamp_indexed_(false)
   , read_sample_count_(0), not_read_sample_count_(0), sample_states_(0)
   , instance_state_(instance_state)
 {
@@ -70,39 +74,74 @@ OpenDDS::DCPS::ReceivedDataElementList::~ReceivedDataElementList()
 void
 OpenDDS::DCPS::ReceivedDataElementList::add_by_timestamp(ReceivedDataElement *data_sample)
 {
-  data_sample->previous_data_sample_ = 0;
-  data_sample->next_data_sample_ = 0;
+  if (!timestamp_indexed_) {
+    timestamp_indexed_ = true;
+    for (ReceivedDataElement* it = head_; it != 0; it = it->next_data_sample_) {
+      index_by_timestamp(it, timestamp_index_.end());
+    }
+  }
 
-  for (ReceivedDataElement* it = head_; it != 0; it = it->next_data_sample_) {
-    if (data_sample->source_timestamp_ < it->source_timestamp_) {
-      data_sample->previous_data_sample_ = it->previous_data_sample_;
-      data_sample->next_data_sample_ = it;
-
-      // Are we replacing the head?
-      if (it->previous_data_sample_ == 0) {
-        head_ = data_sample;
-      } else {
-        it->previous_data_sample_->next_data_sample_ = data_sample;
-      }
-      it->previous_data_sample_ = data_sample;
+  // Samples usually arrive in order.
+  if (!tail_ || !(data_sample->source_timestamp_ < tail_->source_timestamp_)) {
+    add(data_sample);
+    return;
+  }
+
+  const TimestampIndex::iterator pos = timestamp_index_.upper_bound(data_sample->source_timestamp_);
+  OPENDDS_ASSERT(pos != timestamp_index_.end());
+
+  // Samples with the same timestamp may not be indexed in list order, so
+  // back up to the first one that is later than data_sample.
+  ReceivedDataElement* it = pos->second;
+  while (it->previous_data_sample_ &&
+         data_sample->source_timestamp_ < it->previous_data_sample_->source_timestamp_) {
+    it = it->previous_data_sample_;
+  }
+
+  data_sample->previous_data_sample_ = it->previous_data_sample_;
+  data_sample->next_data_sample_ = it;
 
-      ++size_;
+  // Are we replacing the head?
+  if (it->previous_data_sample_ == 0) {
+    head_ = data_sample;
+  } else {
+    it->previous_data_sample_->next_data_sample_ = data_sample;
+  }
+  it->previous_data_sample_ = data_sample;
+
+  increment_size(data_sample);
 #ifndef OPENDDS_NO_OBJECT_MODEL_PROFILE
-      if (!data_sample->coherent_change_)
+  if (!data_sample->coherent_change_)
 #endif
-      {
-        if (data_sample->sample_state_ == DDS::NOT_READ_SAMPLE_STATE) {
-          increment_not_read_count();
-        } else {
-          increment_read_count();
-        }
-      }
+  {
+    if (data_sample->sample_state_ == DDS::NOT_READ_SAMPLE_STATE) {
+      increment_not_read_count();
+    } else {
+      increment_read_count();
+    }
+  }
+
+  index_by_timestamp(data_sample, pos);
+}
+
+void
+OpenDDS::DCPS::ReceivedDataElementList::index_by_timestamp(ReceivedDataElement* data_sample,
+                                                           TimestampIndex::iterator hint)
+{
+  timestamp_index_.insert(hint, std::make_pair(data_sample->source_timestamp_, data_sample));
+}
 
+void
+OpenDDS::DCPS::ReceivedDataElementList::unindex_by_timestamp(ReceivedDataElement* data_sample)
+{
+  std::pair<TimestampIndex::iterator, TimestampIndex::iterator> range =
+    timestamp_index_.equal_range(data_sample->source_timestamp_);
+  for (; range.first != range.second; ++range.first) {
+    if (range.first->second == data_sample) {
+      timestamp_index_.erase(range.first);
       return;
     }
   }
-
-  add(data_sample);
 }
 
 void
@@ -149,7 +188,10 @@ OpenDDS::DCPS::ReceivedDataElementList::remove(ReceivedDataElement* item)
 
   bool released = false;
 
-  size_--;
+  decrement_size(item);
+  if (timestamp_indexed_) {
+    unindex_by_timestamp(item);
+  }
 #ifndef OPENDDS_NO_OBJECT_MODEL_PROFILE
   if (!item->coherent_change_)
 #endif
@@ -14,6 +14,7 @@
 #include "Definitions.h"
 #include "GuidUtils.h"
 #include "InstanceState.h"
+#include "PoolAllocator.h"
 #include "Time_Helper.h"
 #include "unique_ptr.h"
 
@@ -187,9 +188,25 @@ public:
   virtual void operator()(ReceivedDataElement* data_sample) = 0;
 };
 
+/**
+ * Number of samples held by all the instances of a DataReader, kept up to
+ * date by the ReceivedDataElementList of each instance so that
+ * RESOURCE_LIMITS can be enforced without visiting every instance.
+ */
+struct ReceivedSampleCounts : public virtual RcObject {
+  ReceivedSampleCounts() : total(0), valid_data(0) {}
+
+  Atomic<size_t> total;
+  /// Samples that aren't just a dispose or unregister.
+  Atomic<size_t> valid_data;
+};
+typedef RcHandle<ReceivedSampleCounts> ReceivedSampleCounts_rch;
+
 class OpenDDS_Dcps_Export ReceivedDataElementList {
 public:
-  explicit ReceivedDataElementList(const DataReaderImpl_rch& reader, const InstanceState_rch& instance_state = InstanceState_rch());
+  explicit ReceivedDataElementList(const DataReaderImpl_rch& reader,
+                                   const InstanceState_rch& instance_state = InstanceState_rch(),
+                                   const ReceivedSampleCounts_rch& sample_counts = ReceivedSampleCounts_rch());
 
   ~ReceivedDataElementList();
 
@@ -197,6 +214,9 @@ public:
 
   // adds a data sample to the end of the list
   void add(ReceivedDataElement* data_sample);
+
+  // adds a data sample after the samples with the same or an earlier
+  // source timestamp
   void add_by_timestamp(ReceivedDataElement* data_sample);
 
   // returns true if the instance was released
@@ -211,6 +231,7 @@ public:
   ReceivedDataElement* remove_tail();
 
   size_t size() const { return size_; }
+  size_t valid_data_size() const { return valid_data_size_; }
 
   bool has_zero_copies() const;
   bool matches(CORBA::ULong sample_states) const;
@@ -233,10 +254,35 @@ private:
   /// Number of elements in the list.
   size_t size_;
 
+  /// Number of elements in the list with valid data.
+  size_t valid_data_size_;
+
+  /// Shared with the other instances of the reader.
+  ReceivedSampleCounts_rch sample_counts_;
+
+  struct TimeLess {
+    bool operator()(const DDS::Time_t& x, const DDS::Time_t& y) const
+    {
+      return x < y;
+    }
+  };
+  typedef OPENDDS_MULTIMAP_CMP(DDS::Time_t, ReceivedDataElement*, TimeLess) TimestampIndex;
+
+  /// Elements by source timestamp, only kept once add_by_timestamp() has
+  /// been used so samples that arrive out of order can be placed without
+  /// walking the list.
+  bool timestamp_indexed_;
+  TimestampIndex timestamp_index_;
+
+  void index_by_timestamp(ReceivedDataElement* data_sample, TimestampIndex::iterator hint);
+  void unindex_by_timestamp(ReceivedDataElement* data_sample);
+
   CORBA::ULong read_sample_count_;
   CORBA::ULong not_read_sample_count_;
   CORBA::ULong sample_states_;
 
+  void increment_size(const ReceivedDataElement* item);
+  void decrement_size(const ReceivedDataElement* item);
   void increment_read_count();
   void decrement_read_count();
   void increment_not_read_count();
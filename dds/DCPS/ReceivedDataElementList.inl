@@ -8,6 +8,38 @@
 #include "ReceivedDataElementList.h"
 #include "InstanceState.h"
 
+ACE_INLINE
+void
+OpenDDS::DCPS::ReceivedDataElementList::increment_size(const ReceivedDataElement* item)
+{
+  ++size_;
+  if (sample_counts_) {
+    ++sample_counts_->total;
+  }
+  if (item->valid_data_) {
+    ++valid_data_size_;
+    if (sample_counts_) {
+      ++sample_counts_->valid_data;
+    }
+  }
+}
+
+ACE_INLINE
+void
+OpenDDS::DCPS::ReceivedDataElementList::decrement_size(const ReceivedDataElement* item)
+{
+  --size_;
+  if (sample_counts_) {
+    --sample_counts_->total;
+  }
+  if (item->valid_data_) {
+    --valid_data_size_;
+    if (sample_counts_) {
+      --sample_counts_->valid_data;
+    }
+  }
+}
+
 ACE_INLINE
 void
 OpenDDS::DCPS::ReceivedDataElementList::add(ReceivedDataElement *data_sample)
@@ -20,7 +52,7 @@ OpenDDS::DCPS::ReceivedDataElementList::add(ReceivedDataElement *data_sample)
   data_sample->previous_data_sample_ = 0;
   data_sample->next_data_sample_ = 0;
 
-  ++size_;
+  increment_size(data_sample);
 
 #ifndef OPENDDS_NO_OBJECT_MODEL_PROFILE
   if (!data_sample->coherent_change_)
@@ -44,6 +76,10 @@ OpenDDS::DCPS::ReceivedDataElementList::add(ReceivedDataElement *data_sample)
     tail_ = data_sample;
   }
 
+  if (timestamp_indexed_) {
+    index_by_timestamp(data_sample, timestamp_index_.end());
+  }
+
   if (instance_state_) {
     instance_state_->empty(false);
   }
@@ -0,0 +1,130 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_SAMPLE_ARENA_H
+#define OPENDDS_DCPS_SAMPLE_ARENA_H
+
+#include "PoolAllocator.h"
+
+#include <ace/Guard_T.h>
+#include <ace/Thread_Mutex.h>
+
+#ifdef ACE_HAS_CPP11
+#  include <type_traits>
+#  include <utility>
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/**
+ * Bodies of released samples kept so that their sequence and string buffers
+ * can be used again by the next sample deserialized into.
+ *
+ * A released sample is moved into the arena and a new sample takes the most
+ * recently released body, so deserializing a sample no larger than an
+ * earlier one doesn't have to allocate.  This only works if T can be moved
+ * without copying, which is the case for the C++11 IDL mapping.  For other
+ * types, or without C++11, every sample starts out empty as before and is
+ * counted as a fallback.
+ */
+template <typename T>
+class SampleArena {
+public:
+  struct Statistics {
+    Statistics()
+      : reused(0)
+      , fallback(0)
+      , retained(0)
+      , discarded(0)
+    {}
+
+    /// Samples that started with a released sample's body.
+    size_t reused;
+    /// Samples that started out empty.
+    size_t fallback;
+    /// Released samples kept in the arena.
+    size_t retained;
+    /// Released samples that were destroyed because the arena was full or T
+    /// can't be moved.
+    size_t discarded;
+  };
+
+  /// Keep at most "capacity" released samples.
+  explicit SampleArena(size_t capacity)
+    : capacity_(capacity)
+  {}
+
+  /// Move the body of a released sample into "sample", which must not have a
+  /// value yet.  The caller has to overwrite every member.  Returns false if
+  /// there was nothing to reuse.
+  bool reuse(T& sample)
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+#ifdef ACE_HAS_CPP11
+    if (movable && !bodies_.empty()) {
+      sample = std::move(bodies_.back());
+      bodies_.pop_back();
+      ++stats_.reused;
+      return true;
+    }
+#else
+    ACE_UNUSED_ARG(sample);
+#endif
+    ++stats_.fallback;
+    return false;
+  }
+
+  /// Keep the body of "sample", which is about to be destroyed.
+  void recycle(T& sample)
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+#ifdef ACE_HAS_CPP11
+    if (movable && bodies_.size() < capacity_) {
+      bodies_.push_back(std::move(sample));
+      ++stats_.retained;
+      return;
+    }
+#else
+    ACE_UNUSED_ARG(sample);
+#endif
+    ++stats_.discarded;
+  }
+
+  size_t size() const
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+    return bodies_.size();
+  }
+
+  Statistics statistics() const
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+    return stats_;
+  }
+
+private:
+  SampleArena(const SampleArena&);
+  SampleArena& operator=(const SampleArena&);
+
+#ifdef ACE_HAS_CPP11
+  static const bool movable =
+    std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value;
+#endif
+
+  const size_t capacity_;
+  mutable ACE_Thread_Mutex mutex_;
+  OPENDDS_VECTOR(T) bodies_;
+  Statistics stats_;
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_DCPS_SAMPLE_ARENA_H
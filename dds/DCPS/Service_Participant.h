@@ -122,6 +122,9 @@ const String COMMON_DCPS_PERSISTENT_DATA_DIR_default = "OpenDDS-durable-data-dir
 const char COMMON_DCPS_PUBLISHER_CONTENT_FILTER[] = "COMMON_DCPS_PUBLISHER_CONTENT_FILTER";
 const bool COMMON_DCPS_PUBLISHER_CONTENT_FILTER_default = true;
 
+const char COMMON_DCPS_STATIC_DISCOVERY_TABLE[] = "COMMON_DCPS_STATIC_DISCOVERY_TABLE";
+const String COMMON_DCPS_STATIC_DISCOVERY_TABLE_default = "";
+
 const char COMMON_DCPS_THREAD_STATUS_INTERVAL[] = "COMMON_DCPS_THREAD_STATUS_INTERVAL";
 
 const char COMMON_DCPS_TRANSPORT_DEBUG_LEVEL[] = "COMMON_DCPS_TRANSPORT_DEBUG_LEVEL";
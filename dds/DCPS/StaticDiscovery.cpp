@@ -9,6 +9,7 @@
 #include "Marked_Default_Qos.h"
 #include "Qos_Helper.h"
 #include "Registered_Data_Types.h"
+#include "Serializer.h"
 #include "SubscriberImpl.h"
 #include "debug.h"
 
@@ -16,9 +17,16 @@
 
 #include "XTypes/TypeAssignability.h"
 
+#include <dds/DdsDcpsGuidTypeSupportImpl.h>
+#include <dds/DdsDcpsInfoUtilsTypeSupportImpl.h>
 #include <dds/OpenDDSConfigWrapper.h>
+#include <dds/Version.h>
+
+#include <ace/OS_NS_stdio.h>
 
 #include <ctype.h>
+#include <fstream>
+#include <iterator>
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -77,6 +85,223 @@ void EndpointRegistry::match()
   }
 }
 
+namespace {
+  void string_serialized_size(const Encoding& encoding, size_t& size, const String& value)
+  {
+    primitive_serialized_size_ulong(encoding, size);
+    size += value.size() + 1;
+  }
+
+  bool read_table(Serializer& ser, const MD5Result& config, EndpointRegistry& registry)
+  {
+    // The table is written in the byte order of the machine that made it.
+    ACE_CDR::Octet endianness;
+    if (!(ser >> ACE_InputCDR::to_octet(endianness)) ||
+        (endianness != ENDIAN_BIG && endianness != ENDIAN_LITTLE)) {
+      return false;
+    }
+    ser.endianness(static_cast<Endianness>(endianness));
+
+    ACE_CDR::ULong magic, version, count;
+    MD5Result digest;
+    if (!(ser >> magic) || magic != EndpointRegistry::TABLE_MAGIC ||
+        !(ser >> version) || version != EndpointRegistry::TABLE_VERSION ||
+        !ser.read_octet_array(digest, sizeof digest) ||
+        std::memcmp(digest, config, sizeof digest) != 0 ||
+        !(ser >> count)) {
+      return false;
+    }
+
+    for (ACE_CDR::ULong i = 0; i < count; ++i) {
+      String key;
+      EndpointRegistry::Topic topic;
+      if (!(ser >> key) || !(ser >> topic.name) || !(ser >> topic.type_name)) {
+        return false;
+      }
+      registry.topic_map[key] = topic;
+    }
+
+    if (!(ser >> count)) {
+      return false;
+    }
+    OPENDDS_VECTOR(EndpointRegistry::ReaderMapType::iterator) readers;
+    for (ACE_CDR::ULong i = 0; i < count; ++i) {
+      GUID_t id;
+      String topic_name, trans_cfg;
+      DDS::DataReaderQos qos;
+      DDS::SubscriberQos subscriber_qos;
+      TransportLocatorSeq trans_info;
+      if (!(ser >> id) || !(ser >> topic_name) || !(ser >> trans_cfg) ||
+          !(ser >> qos) || !(ser >> subscriber_qos) || !(ser >> trans_info)) {
+        return false;
+      }
+      const std::pair<EndpointRegistry::ReaderMapType::iterator, bool> result =
+        registry.reader_map.insert(std::make_pair(id,
+          EndpointRegistry::Reader(topic_name, qos, subscriber_qos, trans_cfg, trans_info)));
+      if (!result.second) {
+        return false;
+      }
+      readers.push_back(result.first);
+    }
+
+    if (!(ser >> count)) {
+      return false;
+    }
+    for (ACE_CDR::ULong i = 0; i < count; ++i) {
+      GUID_t id;
+      String topic_name, trans_cfg;
+      DDS::DataWriterQos qos;
+      DDS::PublisherQos publisher_qos;
+      TransportLocatorSeq trans_info;
+      ACE_CDR::ULong matches;
+      if (!(ser >> id) || !(ser >> topic_name) || !(ser >> trans_cfg) ||
+          !(ser >> qos) || !(ser >> publisher_qos) || !(ser >> trans_info) ||
+          !(ser >> matches)) {
+        return false;
+      }
+      const std::pair<EndpointRegistry::WriterMapType::iterator, bool> result =
+        registry.writer_map.insert(std::make_pair(id,
+          EndpointRegistry::Writer(topic_name, qos, publisher_qos, trans_cfg, trans_info)));
+      if (!result.second) {
+        return false;
+      }
+      EndpointRegistry::Writer& writer = result.first->second;
+
+      // Same as match(), but only for the pairs it found compatible.
+      for (ACE_CDR::ULong m = 0; m < matches; ++m) {
+        ACE_CDR::ULong index;
+        if (!(ser >> index) || index >= readers.size()) {
+          return false;
+        }
+        const GUID_t& readerid = readers[index]->first;
+        EndpointRegistry::Reader& reader = readers[index]->second;
+        switch (reader.qos.reliability.kind) {
+        case DDS::BEST_EFFORT_RELIABILITY_QOS:
+          writer.best_effort_readers.insert(readerid);
+          reader.best_effort_writers.insert(id);
+          break;
+        case DDS::RELIABLE_RELIABILITY_QOS:
+          writer.reliable_readers.insert(readerid);
+          reader.reliable_writers.insert(id);
+          break;
+        }
+      }
+    }
+    return true;
+  }
+}
+
+const ACE_CDR::ULong EndpointRegistry::TABLE_MAGIC;
+const ACE_CDR::ULong EndpointRegistry::TABLE_VERSION;
+
+bool EndpointRegistry::load_table(const String& path, const MD5Result& config)
+{
+  topic_map.clear();
+  reader_map.clear();
+  writer_map.clear();
+
+  std::ifstream file(path.c_str(), std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  const String contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  ACE_Message_Block buffer(contents.size());
+  buffer.copy(contents.data(), contents.size());
+
+  Serializer ser(&buffer, Encoding(Encoding::KIND_XCDR2));
+  if (!read_table(ser, config, *this)) {
+    topic_map.clear();
+    reader_map.clear();
+    writer_map.clear();
+    return false;
+  }
+  return true;
+}
+
+bool EndpointRegistry::save_table(const String& path, const MD5Result& config) const
+{
+  const Encoding encoding(Encoding::KIND_XCDR2);
+
+  // Matches are saved as indexes into the readers, which are written first.
+  typedef OPENDDS_MAP_CMP(GUID_t, ACE_CDR::ULong, GUID_tKeyLessThan) IndexMap;
+  IndexMap reader_index;
+
+  size_t size = 0;
+  primitive_serialized_size_octet(encoding, size);
+  primitive_serialized_size_ulong(encoding, size, 2);
+  primitive_serialized_size_octet(encoding, size, sizeof(MD5Result));
+  primitive_serialized_size_ulong(encoding, size);
+  for (TopicMapType::const_iterator it = topic_map.begin(); it != topic_map.end(); ++it) {
+    string_serialized_size(encoding, size, it->first);
+    string_serialized_size(encoding, size, it->second.name);
+    string_serialized_size(encoding, size, it->second.type_name);
+  }
+  primitive_serialized_size_ulong(encoding, size);
+  for (ReaderMapType::const_iterator it = reader_map.begin(); it != reader_map.end(); ++it) {
+    const ACE_CDR::ULong index = static_cast<ACE_CDR::ULong>(reader_index.size());
+    reader_index[it->first] = index;
+    serialized_size(encoding, size, it->first);
+    string_serialized_size(encoding, size, it->second.topic_name);
+    string_serialized_size(encoding, size, it->second.trans_cfg);
+    serialized_size(encoding, size, it->second.qos);
+    serialized_size(encoding, size, it->second.subscriber_qos);
+    serialized_size(encoding, size, it->second.trans_info);
+  }
+  primitive_serialized_size_ulong(encoding, size);
+  for (WriterMapType::const_iterator it = writer_map.begin(); it != writer_map.end(); ++it) {
+    serialized_size(encoding, size, it->first);
+    string_serialized_size(encoding, size, it->second.topic_name);
+    string_serialized_size(encoding, size, it->second.trans_cfg);
+    serialized_size(encoding, size, it->second.qos);
+    serialized_size(encoding, size, it->second.publisher_qos);
+    serialized_size(encoding, size, it->second.trans_info);
+    primitive_serialized_size_ulong(encoding, size,
+      1 + it->second.best_effort_readers.size() + it->second.reliable_readers.size());
+  }
+
+  ACE_Message_Block buffer(size);
+  Serializer ser(&buffer, encoding);
+  bool ok = (ser << ACE_OutputCDR::from_octet(static_cast<ACE_CDR::Octet>(ENDIAN_NATIVE))) &&
+    (ser << TABLE_MAGIC) && (ser << TABLE_VERSION) &&
+    ser.write_octet_array(config, sizeof(MD5Result)) &&
+    (ser << static_cast<ACE_CDR::ULong>(topic_map.size()));
+  for (TopicMapType::const_iterator it = topic_map.begin(); ok && it != topic_map.end(); ++it) {
+    ok = (ser << it->first) && (ser << it->second.name) && (ser << it->second.type_name);
+  }
+  ok = ok && (ser << static_cast<ACE_CDR::ULong>(reader_map.size()));
+  for (ReaderMapType::const_iterator it = reader_map.begin(); ok && it != reader_map.end(); ++it) {
+    ok = (ser << it->first) && (ser << it->second.topic_name) && (ser << it->second.trans_cfg) &&
+      (ser << it->second.qos) && (ser << it->second.subscriber_qos) && (ser << it->second.trans_info);
+  }
+  ok = ok && (ser << static_cast<ACE_CDR::ULong>(writer_map.size()));
+  for (WriterMapType::const_iterator it = writer_map.begin(); ok && it != writer_map.end(); ++it) {
+    const Writer& writer = it->second;
+    ok = (ser << it->first) && (ser << writer.topic_name) && (ser << writer.trans_cfg) &&
+      (ser << writer.qos) && (ser << writer.publisher_qos) && (ser << writer.trans_info) &&
+      (ser << static_cast<ACE_CDR::ULong>(writer.best_effort_readers.size() + writer.reliable_readers.size()));
+    for (RepoIdSetType::const_iterator r = writer.best_effort_readers.begin();
+         ok && r != writer.best_effort_readers.end(); ++r) {
+      ok = ser << reader_index[*r];
+    }
+    for (RepoIdSetType::const_iterator r = writer.reliable_readers.begin();
+         ok && r != writer.reliable_readers.end(); ++r) {
+      ok = ser << reader_index[*r];
+    }
+  }
+  if (!ok) {
+    return false;
+  }
+
+  const String temp = path + ".tmp";
+  {
+    std::ofstream file(temp.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file.write(buffer.rd_ptr(), buffer.length()) || !file.flush()) {
+      return false;
+    }
+  }
+  return ACE_OS::rename(temp.c_str(), path.c_str()) == 0;
+}
+
 StaticEndpointManager::StaticEndpointManager(const GUID_t& participant_id,
                                              ACE_Thread_Mutex& lock,
                                              const EndpointRegistry& registry,
@@ -1722,6 +1947,29 @@ namespace {
 int
 StaticDiscovery::load_configuration()
 {
+  const String table = TheServiceParticipant->config_store()->get(COMMON_DCPS_STATIC_DISCOVERY_TABLE,
+                                                                  COMMON_DCPS_STATIC_DISCOVERY_TABLE_default);
+  if (!table.empty()) {
+    MD5Result digest;
+    config_digest(digest);
+    if (registry.load_table(table, digest)) {
+      if (log_level >= LogLevel::Info) {
+        ACE_DEBUG((LM_INFO,
+                   "(%P|%t) INFO: StaticDiscovery::load_configuration: "
+                   "loaded %B writers and %B readers from %C\n",
+                   registry.writer_map.size(), registry.reader_map.size(), table.c_str()));
+      }
+      return 0;
+    }
+    if (log_level >= LogLevel::Warning) {
+      ACE_ERROR((LM_WARNING,
+                 "(%P|%t) WARNING: StaticDiscovery::load_configuration: "
+                 "%C is missing or was made from a different configuration, "
+                 "parsing the configuration instead\n",
+                 table.c_str()));
+    }
+  }
+
   if (parse_topics() ||
       parse_datawriterqos() ||
       parse_datareaderqos() ||
@@ -1736,6 +1984,45 @@ StaticDiscovery::load_configuration()
   return 0;
 }
 
+void
+StaticDiscovery::config_digest(MD5Result& result) const
+{
+  // Everything parse_endpoints() reads, including the transport configuration
+  // that the locators come from.
+  static const char* const sections[] = {
+    "TOPIC", "DATAWRITERQOS", "DATAREADERQOS", "PUBLISHERQOS", "SUBSCRIBERQOS",
+    "ENDPOINT", "DOMAIN", "CONFIG", "TRANSPORT"
+  };
+
+  // The [common] keys that change the locators.
+  static const char* const common_keys[] = {
+    COMMON_DCPS_GLOBAL_TRANSPORT_CONFIG, COMMON_DCPS_DEFAULT_ADDRESS
+  };
+
+  RcHandle<ConfigStoreImpl> config_store = TheServiceParticipant->config_store();
+  String text = OPENDDS_VERSION;
+  text += '\n';
+  for (size_t i = 0; i < sizeof common_keys / sizeof common_keys[0]; ++i) {
+    text += common_keys[i];
+    text += '=';
+    text += config_store->get(common_keys[i], String());
+    text += '\n';
+  }
+  for (size_t i = 0; i < sizeof sections / sizeof sections[0]; ++i) {
+    const ConfigStoreImpl::StringMap values = config_store->get_section_values(sections[i]);
+    for (ConfigStoreImpl::StringMap::const_iterator pos = values.begin(), limit = values.end();
+         pos != limit; ++pos) {
+      text += sections[i];
+      text += '_';
+      text += pos->first;
+      text += '=';
+      text += pos->second;
+      text += '\n';
+    }
+  }
+  MD5Hash(result, text.data(), text.size());
+}
+
 int
 StaticDiscovery::parse_topics()
 {
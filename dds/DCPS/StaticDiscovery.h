@@ -9,6 +9,7 @@
 #include "BuiltInTopicDataReaderImpls.h"
 #include "DCPS_Utils.h"
 #include "GuidUtils.h"
+#include "Hash.h"
 #include "Marked_Default_Qos.h"
 #include "PoolAllocator.h"
 #include "SporadicTask.h"
@@ -120,6 +121,19 @@ public:
 
   void match();
 
+  /// Replace the topics, endpoints, and matches with those written by
+  /// save_table() if "path" holds a table made from the configuration
+  /// summarized by "config".  Otherwise return false, leaving the registry
+  /// empty.
+  bool load_table(const String& path, const MD5Result& config);
+
+  /// Write the topics, endpoints, and the result of match() to "path" so a
+  /// process with the same configuration can skip parsing and matching.
+  bool save_table(const String& path, const MD5Result& config) const;
+
+  static const ACE_CDR::ULong TABLE_MAGIC = 0x4f445354; // "ODST"
+  static const ACE_CDR::ULong TABLE_VERSION = 2;
+
   static EntityId_t build_id(const unsigned char* entity_key /* length of 3 */,
                              const unsigned char entity_kind);
 
@@ -869,6 +883,10 @@ public:
 
   int load_configuration();
 
+  /// Digest of the configuration sections static discovery depends on, which
+  /// identifies the configuration a match table was made from.
+  void config_digest(MD5Result& result) const;
+
   virtual GUID_t generate_participant_guid();
 
   virtual AddDomainStatus add_domain_participant(DDS::DomainId_t domain,
@@ -20,7 +20,7 @@ SubscriptionInstance::SubscriptionInstance(const DataReaderImpl_rch& reader,
                                            DDS::InstanceHandle_t handle,
                                            bool owns_handle)
   : instance_state_(make_rch<InstanceState>(ref(reader), ref(lock), handle))
-  , rcvd_samples_(reader, instance_state_)
+  , rcvd_samples_(reader, instance_state_, reader->sample_counts())
   , read_sample_count_(0)
   , not_read_sample_count_(0)
   , sample_states_(0)
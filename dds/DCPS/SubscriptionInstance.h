@@ -12,6 +12,7 @@
 #include "ReceivedDataElementList.h"
 #include "ReceivedDataStrategy.h"
 #include "InstanceState.h"
+#include "IntrusiveList.h"
 #include "RcObject.h"
 
 #include "dds/DdsDcpsInfrastructureC.h"
@@ -72,6 +73,9 @@ public:
 
   MonotonicTimePoint deadline_;
 
+  /// Position in the DataReaderImpl's deadline queue.
+  IntrusiveListLinks<SubscriptionInstance> deadline_links_;
+
   MonotonicTimePoint last_accepted_;
 };
 
@@ -1602,6 +1602,15 @@ WriteDataContainer::log_send_state_lists(OPENDDS_STRING description)
              instances_.size()));
 }
 
+namespace {
+  struct DeadlineLess {
+    bool operator()(const PublicationInstance& a, const PublicationInstance& b) const
+    {
+      return a.deadline_ < b.deadline_;
+    }
+  };
+}
+
 void
 WriteDataContainer::set_deadline_period(const TimeDuration& deadline_period)
 {
@@ -1613,37 +1622,36 @@ WriteDataContainer::set_deadline_period(const TimeDuration& deadline_period)
   // Reset the deadline timer if the period has changed.
   if (deadline_period_ != deadline_period) {
     if (deadline_period_ == TimeDuration::max_value) {
-      OPENDDS_ASSERT(deadline_map_.empty());
+      OPENDDS_ASSERT(deadline_queue_.empty());
 
       for (PublicationInstanceMapType::iterator iter = instances_.begin();
            iter != instances_.end();
            ++iter) {
         iter->second->deadline_ = deadline;
-        deadline_map_.insert(std::make_pair(deadline, iter->second));
+        deadline_queue_.push_back(iter->second);
       }
 
-      if (!deadline_map_.empty()) {
+      if (!deadline_queue_.empty()) {
         deadline_task_->schedule(deadline_period);
       }
     } else if (deadline_period == TimeDuration::max_value) {
-      if (!deadline_map_.empty()) {
+      if (!deadline_queue_.empty()) {
         deadline_task_->cancel();
       }
 
-      deadline_map_.clear();
+      deadline_queue_.clear();
     } else {
-      DeadlineMapType new_map;
+      deadline_queue_.clear();
       for (PublicationInstanceMapType::iterator iter = instances_.begin();
            iter != instances_.end();
            ++iter) {
         iter->second->deadline_ = deadline;
-        new_map.insert(std::make_pair(iter->second->deadline_, iter->second));
+        deadline_queue_.push_back(iter->second);
       }
-      std::swap(new_map, deadline_map_);
 
-      if (!deadline_map_.empty()) {
+      if (!deadline_queue_.empty()) {
         deadline_task_->cancel();
-        deadline_task_->schedule(deadline_map_.begin()->first - MonotonicTimePoint::now());
+        deadline_task_->schedule(deadline_queue_.front()->deadline_ - MonotonicTimePoint::now());
       }
     }
 
@@ -1659,17 +1667,15 @@ WriteDataContainer::process_deadlines(const MonotonicTimePoint& now)
   // Lock ourselves.
   ACE_GUARD (ACE_Recursive_Thread_Mutex, wdc_guard, lock_);
 
-  if (deadline_map_.empty()) {
+  if (deadline_queue_.empty()) {
     return;
   }
 
   bool notify = false;
 
-  for (DeadlineMapType::iterator pos = deadline_map_.begin(), limit = deadline_map_.end();
-       pos != limit && pos->first < now; pos = deadline_map_.begin()) {
+  while (!deadline_queue_.empty() && deadline_queue_.front()->deadline_ < now) {
 
-    PublicationInstance_rch instance = pos->second;
-    deadline_map_.erase(pos);
+    PublicationInstance_rch instance = deadline_queue_.pop_front();
 
     ++deadline_status_.total_count;
     deadline_status_.total_count_change = deadline_status_.total_count - deadline_last_total_count_;
@@ -1697,15 +1703,17 @@ WriteDataContainer::process_deadlines(const MonotonicTimePoint& now)
       deadline_last_total_count_ = deadline_status_.total_count;
     }
 
+    // Unless the timer is late this is after every other deadline, so the
+    // search from the back stops right away.
     instance->deadline_ += deadline_period_;
-    deadline_map_.insert(std::make_pair(instance->deadline_, instance));
+    deadline_queue_.insert_sorted(instance, DeadlineLess());
   }
 
   if (notify) {
     writer_->notify_status_condition();
   }
 
-  deadline_task_->schedule(deadline_map_.begin()->first - now);
+  deadline_task_->schedule(deadline_queue_.front()->deadline_ - now);
 }
 
 void
@@ -1717,17 +1725,10 @@ WriteDataContainer::extend_deadline(const PublicationInstance_rch& instance)
     return;
   }
 
-  std::pair<DeadlineMapType::iterator, DeadlineMapType::iterator> r = deadline_map_.equal_range(instance->deadline_);
-  while (r.first != r.second && r.first->second != instance) {
-    ++r.first;
-  }
-  if (r.first != r.second) {
-    // The instance was in the map.
-    deadline_map_.erase(r.first);
-  }
+  deadline_queue_.remove(instance.in());
   instance->deadline_ = MonotonicTimePoint::now() + deadline_period_;
-  bool schedule = deadline_map_.empty();
-  deadline_map_.insert(std::make_pair(instance->deadline_, instance));
+  bool schedule = deadline_queue_.empty();
+  deadline_queue_.insert_sorted(instance, DeadlineLess());
   if (schedule) {
     deadline_task_->schedule(deadline_period_);
   }
@@ -1742,13 +1743,8 @@ WriteDataContainer::cancel_deadline(const PublicationInstance_rch& instance)
     return;
   }
 
-  std::pair<DeadlineMapType::iterator, DeadlineMapType::iterator> r = deadline_map_.equal_range(instance->deadline_);
-  while (r.first != r.second && r.first->second != instance) {
-    ++r.first;
-  }
-  if (r.first != r.second) {
-    deadline_map_.erase(r.first);
-    if (deadline_map_.empty()) {
+  if (deadline_queue_.remove(instance.in())) {
+    if (deadline_queue_.empty()) {
       deadline_task_->cancel();
     }
   }
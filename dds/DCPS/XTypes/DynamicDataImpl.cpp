@@ -681,71 +681,71 @@ bool DynamicDataImpl::insert_single(DDS::MemberId id, const ACE_OutputCDR::from_
 {
   // The same member might be already written to complex_map_.
   // Make sure there is only one entry for each member.
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 
 bool DynamicDataImpl::insert_single(DDS::MemberId id, const ACE_OutputCDR::from_uint8& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 
 bool DynamicDataImpl::insert_single(DDS::MemberId id, const ACE_OutputCDR::from_char& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 
 bool DynamicDataImpl::insert_single(DDS::MemberId id, const ACE_OutputCDR::from_octet& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 
 bool DynamicDataImpl::insert_single(DDS::MemberId id, const ACE_OutputCDR::from_boolean& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 
 #ifdef DDS_HAS_WCHAR
 bool DynamicDataImpl::insert_single(DDS::MemberId id, const ACE_OutputCDR::from_wchar& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 #endif
 
 template<typename SingleType>
 bool DynamicDataImpl::insert_single(DDS::MemberId id, const SingleType& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.single_map_.erase(id);
-  }
-  return container_.single_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.single_map_);
+  container_.single_map_.set(id, value);
+  return true;
 }
 
 bool DynamicDataImpl::insert_complex(DDS::MemberId id, const DDS::DynamicData_var& value)
 {
   if (container_.single_map_.erase(id) == 0) {
-    if (container_.sequence_map_.erase(id) == 0) {
-      container_.complex_map_.erase(id);
-    }
+    container_.sequence_map_.erase(id);
   }
-  return container_.complex_map_.insert(std::make_pair(id, value)).second;
+  container_.reserve_members(container_.complex_map_);
+  container_.complex_map_.set(id, value);
+  return true;
 }
 
 // Set a member with the given ID in a struct. The member must have type MemberTypeKind or
@@ -896,6 +896,11 @@ DynamicDataImpl::SingleValue::SingleValue(const CORBA::WChar* wstr)
 #endif
 
 DynamicDataImpl::SingleValue::~SingleValue()
+{
+  destroy();
+}
+
+void DynamicDataImpl::SingleValue::destroy()
 {
 #define SINGLE_VALUE_DESTRUCT(T) static_cast<ACE_OutputCDR::T*>(active_)->~T(); break
   switch (kind_) {
@@ -1042,12 +1047,19 @@ DynamicDataImpl::SingleValue::SingleValue(const SingleValue& other)
 
 DynamicDataImpl::SingleValue& DynamicDataImpl::SingleValue::operator=(const SingleValue& other)
 {
-  kind_ = other.kind_;
-  active_ = 0;
-  copy(other);
+  if (this != &other) {
+    destroy();
+    kind_ = other.kind_;
+    active_ = 0;
+    copy(other);
+  }
   return *this;
 }
 
+DynamicDataImpl::SequenceValue::SequenceValue()
+  : elem_kind_(TK_NONE), active_(0)
+{}
+
 DynamicDataImpl::SequenceValue::SequenceValue(const DDS::Int32Seq& int32_seq)
   : elem_kind_(TK_INT32), active_(new(int32_seq_) DDS::Int32Seq(int32_seq))
 {}
@@ -1120,6 +1132,22 @@ DynamicDataImpl::SequenceValue::SequenceValue(const DDS::WstringSeq& wstr_seq)
 
 DynamicDataImpl::SequenceValue::SequenceValue(const SequenceValue& rhs)
   : elem_kind_(rhs.elem_kind_), active_(0)
+{
+  copy(rhs);
+}
+
+DynamicDataImpl::SequenceValue& DynamicDataImpl::SequenceValue::operator=(const SequenceValue& rhs)
+{
+  if (this != &rhs) {
+    destroy();
+    elem_kind_ = rhs.elem_kind_;
+    active_ = 0;
+    copy(rhs);
+  }
+  return *this;
+}
+
+void DynamicDataImpl::SequenceValue::copy(const SequenceValue& rhs)
 {
 #define SEQUENCE_VALUE_PLACEMENT_NEW(T, N)  active_ = new(N) DDS::T(reinterpret_cast<const DDS::T&>(rhs.N)); break;
   switch (elem_kind_) {
@@ -1164,6 +1192,11 @@ DynamicDataImpl::SequenceValue::SequenceValue(const SequenceValue& rhs)
 }
 
 DynamicDataImpl::SequenceValue::~SequenceValue()
+{
+  destroy();
+}
+
+void DynamicDataImpl::SequenceValue::destroy()
 {
 #define SEQUENCE_VALUE_DESTRUCT(T) static_cast<DDS::T*>(active_)->~T(); break
   switch (elem_kind_) {
@@ -2263,10 +2296,10 @@ DDS::ReturnCode_t DynamicDataImpl::set_complex_value(DDS::MemberId id, DDS::Dyna
 template<typename SequenceType>
 bool DynamicDataImpl::insert_sequence(DDS::MemberId id, const SequenceType& value)
 {
-  if (container_.complex_map_.erase(id) == 0) {
-    container_.sequence_map_.erase(id);
-  }
-  return container_.sequence_map_.insert(std::make_pair(id, value)).second;
+  container_.complex_map_.erase(id);
+  container_.reserve_members(container_.sequence_map_);
+  container_.sequence_map_.set(id, value);
+  return true;
 }
 
 // Check that the member at the given Id has a compatible type.
@@ -3974,6 +4007,21 @@ void DynamicDataImpl::DataContainer::clear()
   sequence_map_.clear();
 }
 
+const OPENDDS_VECTOR(DDS::MemberId)& DynamicDataImpl::DataContainer::member_ids() const
+{
+  if (member_ids_.empty()) {
+    const ACE_CDR::ULong count = type_->get_member_count();
+    member_ids_.reserve(count);
+    for (ACE_CDR::ULong i = 0; i < count; ++i) {
+      DDS::DynamicTypeMember_var dtm;
+      if (type_->get_member_by_index(dtm, i) == DDS::RETCODE_OK) {
+        member_ids_.push_back(dtm->get_id());
+      }
+    }
+  }
+  return member_ids_;
+}
+
 // Get largest index among elements of a sequence-like type written to the single map.
 bool DynamicDataImpl::DataContainer::get_largest_single_index(CORBA::ULong& largest_index) const
 {
@@ -8,6 +8,7 @@
 
 #ifndef OPENDDS_SAFETY_PROFILE
 #  include "DynamicDataBase.h"
+#  include "MemberIdMap.h"
 
 #  include <dds/DCPS/FilterEvaluator.h>
 #  include <dds/DCPS/Sample.h>
@@ -486,6 +487,7 @@ private:
     SingleValue(const SingleValue& other);
     SingleValue& operator=(const SingleValue& other);
     void copy(const SingleValue& other);
+    void destroy();
 
     ~SingleValue();
 
@@ -525,6 +527,7 @@ private:
   };
 
   struct SequenceValue {
+    SequenceValue();
     SequenceValue(const DDS::Int32Seq& int32_seq);
     SequenceValue(const DDS::UInt32Seq& uint32_seq);
     SequenceValue(const DDS::Int8Seq& int8_seq);
@@ -546,6 +549,9 @@ private:
 #endif
 
     SequenceValue(const SequenceValue& rhs);
+    SequenceValue& operator=(const SequenceValue& rhs);
+    void copy(const SequenceValue& rhs);
+    void destroy();
     ~SequenceValue();
 
     template<typename T> const T& get() const;
@@ -575,14 +581,11 @@ private:
 #endif
 #undef SEQUENCE_VALUE_MEMBER
     };
-
-  private:
-    SequenceValue& operator=(const SequenceValue& rhs);
   };
 
-  typedef OPENDDS_MAP(DDS::MemberId, SingleValue)::const_iterator const_single_iterator;
-  typedef OPENDDS_MAP(DDS::MemberId, SequenceValue)::const_iterator const_sequence_iterator;
-  typedef OPENDDS_MAP(DDS::MemberId, DDS::DynamicData_var)::const_iterator const_complex_iterator;
+  typedef MemberIdMap<SingleValue>::const_iterator const_single_iterator;
+  typedef MemberIdMap<SequenceValue>::const_iterator const_sequence_iterator;
+  typedef MemberIdMap<DDS::DynamicData_var>::const_iterator const_complex_iterator;
 
   // Container for all data written to this DynamicData object.
   // At anytime, there can be at most 1 entry for any given MemberId in all maps.
@@ -605,6 +608,19 @@ private:
 
     void clear();
 
+    // The first entry stored in a map of a struct gives every member a slot,
+    // so setting and clearing members never moves the others.
+    template<typename Map>
+    void reserve_members(Map& map) const
+    {
+      if (!map.laid_out() && type_->get_kind() == TK_STRUCTURE) {
+        map.layout(member_ids());
+      }
+    }
+
+    // Ids of the members of a struct, looked up once per container.
+    const OPENDDS_VECTOR(DDS::MemberId)& member_ids() const;
+
     // Get the largest index of all elements in each map.
     // Call only for collection-like types (sequence, string, etc).
     // Must be called with a non-empty map.
@@ -622,13 +638,14 @@ private:
     bool get_largest_index_basic_sequence(CORBA::ULong& index) const;
 
     // Internal data
-    OPENDDS_MAP(DDS::MemberId, SingleValue) single_map_;
-    OPENDDS_MAP(DDS::MemberId, SequenceValue) sequence_map_;
-    OPENDDS_MAP(DDS::MemberId, DDS::DynamicData_var) complex_map_;
+    MemberIdMap<SingleValue> single_map_;
+    MemberIdMap<SequenceValue> sequence_map_;
+    MemberIdMap<DDS::DynamicData_var> complex_map_;
 
     const DDS::DynamicType_var& type_;
     const DDS::TypeDescriptor_var& type_desc_;
     const DynamicDataImpl* data_;
+    mutable OPENDDS_VECTOR(DDS::MemberId) member_ids_;
   };
 
   // Copy a value of a basic member from single map to a DynamicData object.
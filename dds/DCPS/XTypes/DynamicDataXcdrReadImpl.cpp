@@ -40,6 +40,7 @@
 
 #  include <ace/OS_NS_string.h>
 
+#  include <algorithm>
 #  include <stdexcept>
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
@@ -132,6 +133,7 @@ void DynamicDataXcdrReadImpl::copy(const DynamicDataXcdrReadImpl& other)
   strm_ = other.strm_;
   type_ = other.type_;
   item_count_ = other.item_count_;
+  offsets_ = other.offsets_;
 }
 
 DDS::ReturnCode_t DynamicDataXcdrReadImpl::set_descriptor(MemberId, DDS::MemberDescriptor*)
@@ -1094,22 +1096,31 @@ bool DynamicDataXcdrReadImpl::skip_to_sequence_element(MemberId id, DDS::Dynamic
     return (strm_ >> length) &&
       get_index_from_id(id, index, length) &&
       strm_.skip(index, size);
-  } else {
-    ACE_CDR::ULong length, index;
+  } else if (skip_all) {
+    ACE_CDR::ULong length;
     if (!strm_.skip_delimiter() || !(strm_ >> length)) {
       return false;
     }
-    if (skip_all) {
-      index = length;
-    } else if (!get_index_from_id(id, index, length)) {
-      return false;
-    }
-    for (ACE_CDR::ULong i = 0; i < index; ++i) {
+    for (ACE_CDR::ULong i = 0; i < length; ++i) {
       if (!skip_member(elem_type)) {
         return false;
       }
     }
     return true;
+  } else {
+    const size_t start = strm_.rpos();
+    ACE_CDR::ULong length, index;
+    if (offsets_.by_index.empty()) {
+      if (!strm_.skip_delimiter() || !(strm_ >> length)) {
+        return false;
+      }
+      offsets_.length = length;
+      offsets_.by_index.push_back(strm_.rpos() - start);
+    } else {
+      length = offsets_.length;
+    }
+    return get_index_from_id(id, index, length) &&
+      skip_to_indexed_element(start, index, elem_type);
   }
 }
 
@@ -1134,23 +1145,46 @@ bool DynamicDataXcdrReadImpl::skip_to_array_element(MemberId id, DDS::DynamicTyp
   if (get_primitive_size(elem_type, size)) {
     ACE_CDR::ULong index;
     return get_index_from_id(id, index, length) && strm_.skip(index, size);
-  } else {
+  } else if (skip_all) {
     if (!strm_.skip_delimiter()) {
       return false;
     }
-    ACE_CDR::ULong index;
-    if (skip_all) {
-      index = length;
-    } else if (!get_index_from_id(id, index, length)) {
-      return false;
-    }
-    for (ACE_CDR::ULong i = 0; i < index; ++i) {
+    for (ACE_CDR::ULong i = 0; i < length; ++i) {
       if (!skip_member(elem_type)) {
         return false;
       }
     }
     return true;
+  } else {
+    const size_t start = strm_.rpos();
+    if (offsets_.by_index.empty()) {
+      if (!strm_.skip_delimiter()) {
+        return false;
+      }
+      offsets_.by_index.push_back(strm_.rpos() - start);
+    }
+    ACE_CDR::ULong index;
+    return get_index_from_id(id, index, length) &&
+      skip_to_indexed_element(start, index, elem_type);
+  }
+}
+
+bool DynamicDataXcdrReadImpl::skip_to_indexed_element(size_t start, ACE_CDR::ULong index,
+                                                      DDS::DynamicType_ptr elem_type)
+{
+  // offsets_.by_index has at least the offset of the first element.
+  const ACE_CDR::ULong known = static_cast<ACE_CDR::ULong>(offsets_.by_index.size() - 1);
+  const ACE_CDR::ULong from = (std::min)(index, known);
+  if (!strm_.skip(start + offsets_.by_index[from] - strm_.rpos())) {
+    return false;
+  }
+  for (ACE_CDR::ULong i = from; i < index; ++i) {
+    if (!skip_member(elem_type)) {
+      return false;
+    }
+    offsets_.by_index.push_back(strm_.rpos() - start);
   }
+  return true;
 }
 
 bool DynamicDataXcdrReadImpl::skip_to_map_element(MemberId id)
@@ -2176,21 +2210,34 @@ CORBA::Boolean DynamicDataXcdrReadImpl::equals(DDS::DynamicData_ptr)
 
 DDS::ReturnCode_t DynamicDataXcdrReadImpl::skip_to_struct_member(DDS::MemberDescriptor* member_desc, MemberId id)
 {
+  const size_t start = strm_.rpos();
   const DDS::ExtensibilityKind ek = type_desc_->extensibility_kind();
   if (ek == DDS::FINAL || ek == DDS::APPENDABLE) {
-    size_t dheader = 0;
+    const ACE_CDR::ULong index = member_desc->index();
     const bool xcdr2_appendable = encoding_.xcdr_version() == DCPS::Encoding::XCDR_VERSION_2 &&
       ek == DDS::APPENDABLE;
-    if (xcdr2_appendable && !strm_.read_delimiter(dheader)) {
-      if (log_level >= LogLevel::Notice) {
-        ACE_ERROR((LM_NOTICE, "(%P|%t) NOTICE: DynamicDataXcdrReadImpl::skip_to_struct_member: "
-                   "Failed to read DHEADER for member ID %d\n", id));
+    if (offsets_.by_index.empty()) {
+      size_t dheader = 0;
+      if (xcdr2_appendable && !strm_.read_delimiter(dheader)) {
+        if (log_level >= LogLevel::Notice) {
+          ACE_ERROR((LM_NOTICE, "(%P|%t) NOTICE: DynamicDataXcdrReadImpl::skip_to_struct_member: "
+                     "Failed to read DHEADER for member ID %d\n", id));
+        }
+        return DDS::RETCODE_ERROR;
       }
+      offsets_.end = strm_.rpos() - start + dheader;
+      offsets_.by_index.push_back(strm_.rpos() - start);
+    }
+    const size_t end_of_struct = start + offsets_.end;
+
+    // Resume from the furthest member whose offset is known.
+    const ACE_CDR::ULong known = static_cast<ACE_CDR::ULong>(offsets_.by_index.size() - 1);
+    const ACE_CDR::ULong from = (std::min)(index, known);
+    if (!strm_.skip(start + offsets_.by_index[from] - strm_.rpos())) {
       return DDS::RETCODE_ERROR;
     }
-    const size_t end_of_struct = strm_.rpos() + dheader;
 
-    for (ACE_CDR::ULong i = 0; i < member_desc->index(); ++i) {
+    for (ACE_CDR::ULong i = from; i < index; ++i) {
       DDS::DynamicTypeMember_var dtm;
       DDS::ReturnCode_t rc = type_->get_member_by_index(dtm, i);
       if (rc != DDS::RETCODE_OK) {
@@ -2209,37 +2256,50 @@ DDS::ReturnCode_t DynamicDataXcdrReadImpl::skip_to_struct_member(DDS::MemberDesc
         }
         return rc;
       }
-      if (exclude_member(extent_, md->is_key(), has_explicit_keys(type_))) {
-        // This member is not present in the sample, don't need to do anything.
-        continue;
+      // An excluded member is not present in the sample, there is nothing to skip.
+      if (!exclude_member(extent_, md->is_key(), has_explicit_keys(type_))) {
+        ACE_CDR::ULong num_skipped;
+        if (!skip_struct_member_at_index(i, num_skipped)) {
+          if (DCPS::DCPS_debug_level >= 1) {
+            ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DynamicDataXcdrReadImpl::skip_to_struct_member -")
+                       ACE_TEXT(" Failed to skip member at index %d\n"), i));
+          }
+          return DDS::RETCODE_ERROR;
+        }
+        if (xcdr2_appendable && strm_.rpos() >= end_of_struct) {
+          return DDS::RETCODE_NO_DATA;
+        }
       }
+      offsets_.by_index.push_back(strm_.rpos() - start);
+    }
+    return DDS::RETCODE_OK;
+  } else {
+    const OPENDDS_MAP(MemberId, size_t)::const_iterator found = offsets_.by_id.find(id);
+    if (found != offsets_.by_id.end()) {
+      return strm_.skip(found->second) ? DDS::RETCODE_OK : DDS::RETCODE_ERROR;
+    }
 
-      ACE_CDR::ULong num_skipped;
-      if (!skip_struct_member_at_index(i, num_skipped)) {
+    if (offsets_.resume == 0) {
+      size_t dheader = 0;
+      if (!strm_.read_delimiter(dheader)) {
         if (DCPS::DCPS_debug_level >= 1) {
           ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DynamicDataXcdrReadImpl::skip_to_struct_member -")
-                     ACE_TEXT(" Failed to skip member at index %d\n"), i));
+                     ACE_TEXT(" Failed to read DHEADER for member ID %d\n"), id));
         }
         return DDS::RETCODE_ERROR;
       }
-      if (xcdr2_appendable && strm_.rpos() >= end_of_struct) {
-        return DDS::RETCODE_NO_DATA;
-      }
-    }
-    return DDS::RETCODE_OK;
-  } else {
-    size_t dheader = 0;
-    if (!strm_.read_delimiter(dheader)) {
-      if (DCPS::DCPS_debug_level >= 1) {
-        ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DynamicDataXcdrReadImpl::skip_to_struct_member -")
-                   ACE_TEXT(" Failed to read DHEADER for member ID %d\n"), id));
-      }
+      offsets_.resume = strm_.rpos() - start;
+      offsets_.end = offsets_.resume + dheader;
+    } else if (!strm_.skip(offsets_.resume)) {
       return DDS::RETCODE_ERROR;
     }
 
-    const size_t end_of_struct = strm_.rpos() + dheader;
+    // Continue where the last search stopped, members before that were
+    // either recorded or aren't present.
+    const size_t end_of_struct = start + offsets_.end;
     while (true) {
       if (strm_.rpos() >= end_of_struct) {
+        offsets_.resume = strm_.rpos() - start;
         if (DCPS::DCPS_debug_level >= 1) {
           ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) DynamicDataXcdrReadImpl::skip_to_struct_member -")
                      ACE_TEXT(" Could not find a member with ID %d\n"), id));
@@ -2257,8 +2317,10 @@ DDS::ReturnCode_t DynamicDataXcdrReadImpl::skip_to_struct_member(DDS::MemberDesc
         }
         return DDS::RETCODE_ERROR;
       }
+      offsets_.by_id.insert(std::make_pair(member_id, strm_.rpos() - start));
 
       if (member_id == id) {
+        offsets_.resume = strm_.rpos() - start + member_size;
         return DDS::RETCODE_OK;
       }
 
@@ -461,6 +461,11 @@ private:
   /// element is also skipped.
   bool skip_to_map_element(MemberId id);
 
+  /// Skip from @a start, the beginning of this object's data, to the element at
+  /// @a index of this sequence or array, recording the offsets of the elements
+  /// skipped on the way.
+  bool skip_to_indexed_element(size_t start, ACE_CDR::ULong index, DDS::DynamicType_ptr elem_type);
+
   /// Read a sequence with element type @a elem_tk and store the result in @a value,
   /// which is a sequence of primitives or strings or wstrings. Sequence of enums or
   /// bitmasks are read as a sequence of signed and unsigned integers, respectively.
@@ -572,6 +577,34 @@ private:
 
   /// Cache the number of items (i.e., members or elements) in the data it holds.
   ACE_CDR::ULong item_count_;
+
+  /// Where members and elements start, relative to the beginning of the data
+  /// this object holds.  These are recorded as skip_to_struct_member() and
+  /// skip_to_*_element() scan the data, so reading a member or element that
+  /// was already passed is a single seek instead of another scan.
+  struct OffsetIndex {
+    OffsetIndex() : length(0), resume(0), end(0) {}
+
+    /// Final and appendable structs, and sequences and arrays of non-primitive
+    /// elements: the offset of each member or element up to the furthest one
+    /// reached so far.
+    OPENDDS_VECTOR(size_t) by_index;
+
+    /// Mutable structs: the offset of the value of each member seen so far,
+    /// just after its EMHEADER.
+    OPENDDS_MAP(MemberId, size_t) by_id;
+
+    /// Number of elements of a sequence.
+    ACE_CDR::ULong length;
+
+    /// Mutable structs: the offset of the first EMHEADER not yet read, or 0
+    /// if the DHEADER hasn't been read.
+    size_t resume;
+
+    /// Appendable and mutable structs: the offset of the end of the struct.
+    size_t end;
+  };
+  OffsetIndex offsets_;
 };
 
 OpenDDS_Dcps_Export bool print_dynamic_data(DDS::DynamicData_ptr dd,
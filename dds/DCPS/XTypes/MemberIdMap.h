@@ -0,0 +1,312 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_XTYPES_MEMBER_ID_MAP_H
+#define OPENDDS_DCPS_XTYPES_MEMBER_ID_MAP_H
+
+#ifndef OPENDDS_SAFETY_PROFILE
+
+#include "TypeObject.h"
+
+#include <dds/DCPS/PoolAllocator.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace XTypes {
+
+/**
+ * Map from MemberId to Value stored contiguously and sorted by id.
+ *
+ * This has the parts of the std::map interface that DynamicDataImpl uses.
+ * Members are usually set in increasing id order, so inserting is normally
+ * an append and, with reserve(), a sample is built without an allocation
+ * per member.
+ *
+ * Erasing doesn't move the other values, it leaves an empty slot behind
+ * that setting the same id reuses.  After layout(), every member of a
+ * struct has a slot, so setting, erasing, and clearing members are all
+ * O(log n) no matter the order.  Unlike std::map, inserting a new id can
+ * invalidate iterators.
+ */
+template <typename Value>
+class MemberIdMap {
+public:
+  typedef std::pair<MemberId, Value> value_type;
+
+private:
+  struct Slot {
+    Slot(const value_type& v, bool l)
+      : value(v)
+      , live(l)
+    {}
+
+    value_type value;
+    bool live;
+  };
+  typedef OPENDDS_VECTOR(Slot) Storage;
+
+  /// Visits the slots that hold a value.
+  template <typename SlotIter, typename Ref, typename Ptr>
+  class Iter {
+  public:
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef typename MemberIdMap::value_type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Ptr pointer;
+    typedef Ref reference;
+
+    Iter() {}
+
+    Iter(SlotIter pos, SlotIter first, SlotIter last)
+      : pos_(pos)
+      , first_(first)
+      , last_(last)
+    {}
+
+    /// iterator to const_iterator
+    template <typename S, typename R, typename P>
+    Iter(const Iter<S, R, P>& other)
+      : pos_(other.pos_)
+      , first_(other.first_)
+      , last_(other.last_)
+    {}
+
+    Ref operator*() const { return pos_->value; }
+    Ptr operator->() const { return &pos_->value; }
+
+    Iter& operator++()
+    {
+      do {
+        ++pos_;
+      } while (pos_ != last_ && !pos_->live);
+      return *this;
+    }
+
+    Iter operator++(int)
+    {
+      const Iter prev(*this);
+      ++*this;
+      return prev;
+    }
+
+    Iter& operator--()
+    {
+      do {
+        --pos_;
+      } while (pos_ != first_ && !pos_->live);
+      return *this;
+    }
+
+    Iter operator--(int)
+    {
+      const Iter prev(*this);
+      --*this;
+      return prev;
+    }
+
+    template <typename S, typename R, typename P>
+    bool operator==(const Iter<S, R, P>& other) const { return pos_ == other.pos_; }
+
+    template <typename S, typename R, typename P>
+    bool operator!=(const Iter<S, R, P>& other) const { return pos_ != other.pos_; }
+
+  private:
+    template <typename, typename, typename> friend class Iter;
+    friend class MemberIdMap;
+
+    SlotIter pos_;
+    SlotIter first_;
+    SlotIter last_;
+  };
+
+public:
+  typedef Iter<typename Storage::iterator, value_type&, value_type*> iterator;
+  typedef Iter<typename Storage::const_iterator, const value_type&, const value_type*> const_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  MemberIdMap()
+    : live_(0)
+    , laid_out_(false)
+  {}
+
+  iterator begin() { return first_live(storage_.begin()); }
+  iterator end() { return make_iterator(storage_.end()); }
+  const_iterator begin() const { return first_live(storage_.begin()); }
+  const_iterator end() const { return make_iterator(storage_.end()); }
+  const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+  bool empty() const { return live_ == 0; }
+  size_t size() const { return live_; }
+  size_t capacity() const { return storage_.capacity(); }
+  void reserve(size_t count) { storage_.reserve(count); }
+
+  /// Give each of ids an empty slot, so the map never has to move values
+  /// to make room for them.  Only an empty map is laid out.
+  void layout(const OPENDDS_VECTOR(MemberId)& ids)
+  {
+    if (laid_out_ || !storage_.empty()) {
+      return;
+    }
+    OPENDDS_VECTOR(MemberId) sorted(ids);
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    storage_.reserve(sorted.size());
+    for (size_t i = 0; i < sorted.size(); ++i) {
+      storage_.push_back(Slot(value_type(sorted[i], Value()), false));
+    }
+    laid_out_ = true;
+  }
+
+  bool laid_out() const { return laid_out_; }
+
+  /// Remove all values.  A laid out map keeps its slots.
+  void clear()
+  {
+    if (!laid_out_) {
+      storage_.clear();
+    } else {
+      for (typename Storage::iterator it = storage_.begin(); it != storage_.end(); ++it) {
+        kill(*it);
+      }
+    }
+    live_ = 0;
+  }
+
+  iterator find(MemberId id)
+  {
+    const typename Storage::iterator pos = lower_bound(id);
+    return make_iterator(pos != storage_.end() && pos->value.first == id && pos->live ? pos : storage_.end());
+  }
+
+  const_iterator find(MemberId id) const
+  {
+    const typename Storage::const_iterator pos = lower_bound(id);
+    return make_iterator(pos != storage_.end() && pos->value.first == id && pos->live ? pos : storage_.end());
+  }
+
+  /// Same as std::map::insert, an existing value is kept.
+  std::pair<iterator, bool> insert(const value_type& value)
+  {
+    const typename Storage::iterator pos = slot(value.first);
+    if (pos->live) {
+      return std::make_pair(make_iterator(pos), false);
+    }
+    pos->value.second = value.second;
+    pos->live = true;
+    ++live_;
+    return std::make_pair(make_iterator(pos), true);
+  }
+
+  /// Insert or replace the value for "id".
+  void set(MemberId id, const Value& value)
+  {
+    const typename Storage::iterator pos = slot(id);
+    pos->value.second = value;
+    if (!pos->live) {
+      pos->live = true;
+      ++live_;
+    }
+  }
+
+  size_t erase(MemberId id)
+  {
+    const typename Storage::iterator pos = lower_bound(id);
+    if (pos == storage_.end() || pos->value.first != id || !pos->live) {
+      return 0;
+    }
+    kill(*pos);
+    --live_;
+    return 1;
+  }
+
+private:
+  struct IdLess {
+    bool operator()(const Slot& slot, MemberId id) const
+    {
+      return slot.value.first < id;
+    }
+  };
+
+  typename Storage::iterator lower_bound(MemberId id)
+  {
+    return std::lower_bound(storage_.begin(), storage_.end(), id, IdLess());
+  }
+
+  typename Storage::const_iterator lower_bound(MemberId id) const
+  {
+    return std::lower_bound(storage_.begin(), storage_.end(), id, IdLess());
+  }
+
+  /// The slot for id, added empty if there isn't one yet.
+  typename Storage::iterator slot(MemberId id)
+  {
+    if (storage_.empty() || storage_.back().value.first < id) {
+      storage_.push_back(Slot(value_type(id, Value()), false));
+      return storage_.end() - 1;
+    }
+    const typename Storage::iterator pos = lower_bound(id);
+    if (pos != storage_.end() && pos->value.first == id) {
+      return pos;
+    }
+    return storage_.insert(pos, Slot(value_type(id, Value()), false));
+  }
+
+  /// Release what an erased value holds and mark its slot empty.
+  static void kill(Slot& slot)
+  {
+    if (slot.live) {
+      slot.value.second = Value();
+      slot.live = false;
+    }
+  }
+
+  iterator make_iterator(typename Storage::iterator pos)
+  {
+    return iterator(pos, storage_.begin(), storage_.end());
+  }
+
+  const_iterator make_iterator(typename Storage::const_iterator pos) const
+  {
+    return const_iterator(pos, storage_.begin(), storage_.end());
+  }
+
+  template <typename SlotIter>
+  SlotIter skip_empty(SlotIter pos, SlotIter last) const
+  {
+    while (pos != last && !pos->live) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  iterator first_live(typename Storage::iterator pos)
+  {
+    return make_iterator(skip_empty(pos, storage_.end()));
+  }
+
+  const_iterator first_live(typename Storage::const_iterator pos) const
+  {
+    return make_iterator(skip_empty(pos, storage_.end()));
+  }
+
+  Storage storage_;
+  size_t live_;
+  bool laid_out_;
+};
+
+} // namespace XTypes
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif // OPENDDS_SAFETY_PROFILE
+
+#endif // OPENDDS_DCPS_XTYPES_MEMBER_ID_MAP_H
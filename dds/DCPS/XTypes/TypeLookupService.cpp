@@ -140,6 +140,16 @@ void TypeLookupService::add_type_objects_to_cache(const TypeIdentifierTypeObject
   }
 }
 
+void TypeLookupService::get_hashed_type_objects(TypeIdentifierTypeObjectPairSeq& types) const
+{
+  ACE_GUARD(ACE_Thread_Mutex, g, mutex_);
+  for (TypeMap::const_iterator pos = type_map_.begin(); pos != type_map_.end(); ++pos) {
+    if (pos->first.kind() == EK_MINIMAL || pos->first.kind() == EK_COMPLETE) {
+      types.append(TypeIdentifierTypeObjectPair(pos->first, pos->second));
+    }
+  }
+}
+
 void TypeLookupService::add(TypeMap::const_iterator begin, TypeMap::const_iterator end)
 {
   ACE_GUARD(ACE_Thread_Mutex, g, mutex_);
@@ -40,6 +40,10 @@ public:
     TypeIdentifierTypeObjectPairSeq& types) const;
   void add_type_objects_to_cache(const TypeIdentifierTypeObjectPairSeq& types);
 
+  /// Append every type object with a hashed type identifier, for saving
+  /// them in a discovery cache.
+  void get_hashed_type_objects(TypeIdentifierTypeObjectPairSeq& types) const;
+
   /// For converting between complete to minimal TypeObject of remote types
   ///@{
   void update_type_identifier_map(const TypeIdentifierPairSeq& tid_pairs);
@@ -30,6 +30,24 @@ Governance::TopicAccessRule::TopicAccessRule()
   topic_attrs.is_liveliness_protected = false;
 }
 
+void Governance::DomainRule::add_topic_rule(const TopicAccessRule& rule)
+{
+  topic_rules.push_back(rule);
+  topic_matcher.add(rule.topic_expression);
+  if (!rule.topic_attrs.is_read_protected) {
+    read_unprotected_matcher.add(rule.topic_expression);
+  }
+  if (!rule.topic_attrs.is_write_protected) {
+    write_unprotected_matcher.add(rule.topic_expression);
+  }
+}
+
+const Governance::TopicAccessRule* Governance::DomainRule::find_topic_rule(const char* topic_name) const
+{
+  const size_t index = topic_matcher.find_first(topic_name);
+  return index == NameMatcher::npos ? 0 : &topic_rules[index];
+}
+
 Governance::Governance()
 {
 }
@@ -229,7 +247,7 @@ int Governance::load(const SSL::SignedDocument& doc)
           return -1;
         }
       }
-      domain_rule.topic_rules.push_back(t_rules);
+      domain_rule.add_topic_rule(t_rules);
     }
 
     access_rules_.push_back(domain_rule);
@@ -7,6 +7,7 @@
 #define OPENDDS_DCPS_SECURITY_ACCESSCONTROL_GOVERNANCE_H
 
 #include "DomainIdSet.h"
+#include "NameMatcher.h"
 
 #include <dds/DCPS/security/SSL/SignedDocument.h>
 #include <dds/DCPS/RcObject.h>
@@ -39,6 +40,16 @@ public:
     DomainIdSet domains;
     DDS::Security::ParticipantSecurityAttributes domain_attrs;
     TopicAccessRules topic_rules;
+    /// Compiled from the topic expressions of topic_rules by add_topic_rule.
+    /// The other two only have the rules that don't protect reads or writes.
+    NameMatcher topic_matcher;
+    NameMatcher read_unprotected_matcher;
+    NameMatcher write_unprotected_matcher;
+
+    void add_topic_rule(const TopicAccessRule& rule);
+
+    /// The first topic rule that matches "topic_name", or null.
+    const TopicAccessRule* find_topic_rule(const char* topic_name) const;
   };
 
   typedef std::vector<DomainRule> GovernanceAccessRules;
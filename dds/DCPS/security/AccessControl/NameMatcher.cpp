@@ -0,0 +1,55 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.OpenDDS.org/license.html
+ */
+
+#include "NameMatcher.h"
+
+#include <ace/ACE.h>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace Security {
+
+const size_t NameMatcher::npos = static_cast<size_t>(-1);
+
+NameMatcher::NameMatcher()
+  : size_(0)
+{
+}
+
+NameMatcher::Pattern::Pattern(size_t i, const std::string& expression)
+  : index(i)
+  , pattern(expression.c_str())
+  , escaped(!pattern.wildcard())
+{
+}
+
+void NameMatcher::add(const std::string& expression)
+{
+  if (expression.find_first_of("?*[\\") == std::string::npos) {
+    // Only the first of duplicate names can be found.
+    exact_.insert(std::make_pair(expression, size_));
+  } else {
+    patterns_.push_back(Pattern(size_, expression));
+  }
+  ++size_;
+}
+
+size_t NameMatcher::find_first(const char* name) const
+{
+  const ExactMap::const_iterator exact = exact_.find(name);
+  const size_t limit = exact == exact_.end() ? npos : exact->second;
+  for (Patterns::const_iterator it = patterns_.begin(); it != patterns_.end() && it->index < limit; ++it) {
+    if (it->escaped ? ACE::wild_match(name, it->pattern.name().c_str(), true, true) : it->pattern.matches(name)) {
+      return it->index;
+    }
+  }
+  return limit;
+}
+
+} // namespace Security
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,72 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.OpenDDS.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_SECURITY_ACCESS_CONTROL_NAME_MATCHER_H
+#define OPENDDS_DCPS_SECURITY_ACCESS_CONTROL_NAME_MATCHER_H
+
+#include <dds/DCPS/PartitionMatcher.h>
+#include <dds/DCPS/security/OpenDDS_Security_Export.h>
+#include <dds/Versioned_Namespace.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace Security {
+
+/**
+ * A list of topic expressions or partition names from a governance or
+ * permissions document, compiled so that finding which of them match a name
+ * doesn't call AccessControlBuiltInImpl::pattern_match() on each one.
+ *
+ * Expressions without wildcards or escapes are looked up by name and the
+ * others are parsed once and tried in document order.
+ */
+class OpenDDS_Security_Export NameMatcher {
+public:
+  NameMatcher();
+
+  /// Append "expression", which gets the next index.
+  void add(const std::string& expression);
+
+  size_t size() const { return size_; }
+
+  /// Index of the first expression that matches "name", or npos.
+  size_t find_first(const char* name) const;
+
+  bool matches(const char* name) const
+  {
+    return find_first(name) != npos;
+  }
+
+  static const size_t npos;
+
+private:
+  typedef std::map<std::string, size_t> ExactMap;
+  ExactMap exact_;
+  struct Pattern {
+    Pattern(size_t i, const std::string& expression);
+
+    size_t index;
+    DCPS::PartitionPattern pattern;
+    /// The pattern only has escaped wildcards, which PartitionPattern takes
+    /// literally, so it's matched with ACE::wild_match() instead.
+    bool escaped;
+  };
+  typedef std::vector<Pattern> Patterns;
+  Patterns patterns_;
+  size_t size_;
+};
+
+} // namespace Security
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif
@@ -151,7 +151,7 @@ int Permissions::load(const SSL::SignedDocument& doc)
                   const xercesc::DOMNode* topicNode = topicNodes->item(tn);
 
                   if (ACE_TEXT("topic") == XStr(topicNode->getNodeName())) {
-                    action.topics.push_back(to_string(topicNode));
+                    action.add_topic(to_string(topicNode));
                   }
                 }
 
@@ -163,7 +163,7 @@ int Permissions::load(const SSL::SignedDocument& doc)
                   const xercesc::DOMNode* partitionNode = partitionNodes->item(pn);
 
                   if (ACE_TEXT("partition") == XStr(partitionNode->getNodeName())) {
-                    action.partitions.push_back(to_string(partitionNode));
+                    action.add_partition(to_string(partitionNode));
                   }
                 }
               } else if (ACE_TEXT("validity") == XStr(topicListNode->getNodeName())) {
@@ -238,18 +238,21 @@ Permissions::Grant_rch Permissions::find_grant(const SSL::SubjectName& name) con
   return Grant_rch();
 }
 
-namespace {
-  typedef std::vector<std::string>::const_iterator vsiter_t;
+void Permissions::Action::add_topic(const std::string& topic)
+{
+  topics.push_back(topic);
+  topic_matcher.add(topic);
+}
+
+void Permissions::Action::add_partition(const std::string& partition)
+{
+  partitions.push_back(partition);
+  partition_matcher.add(partition);
 }
 
 bool Permissions::Action::topic_matches(const char* topic) const
 {
-  for (vsiter_t it = topics.begin(); it != topics.end(); ++it) {
-    if (AccessControlBuiltInImpl::pattern_match(topic, it->c_str())) {
-      return true;
-    }
-  }
-  return false;
+  return topic_matcher.matches(topic);
 }
 
 bool Permissions::Action::partitions_match(const DDS::StringSeq& entity_partitions, AllowDeny_t allow_or_deny) const
@@ -273,12 +276,7 @@ bool Permissions::Action::partitions_match(const DDS::StringSeq& entity_partitio
   }
 
   for (unsigned int i = 0; i < n_entity_names; ++i) {
-    bool found = false;
-    for (vsiter_t perm_it = partitions.begin(); !found && perm_it != partitions.end(); ++perm_it) {
-      if (AccessControlBuiltInImpl::pattern_match(entity_partitions[i], perm_it->c_str())) {
-        found = true;
-      }
-    }
+    const bool found = partition_matcher.matches(entity_partitions[i]);
     if (allow_or_deny == ALLOW && !found) {
       // DDS-Security v1.1 9.4.1.3.2.3.1.4
       // In order for an action to meet the allowed partitions condition that appears
@@ -7,6 +7,7 @@
 #define OPENDDS_DCPS_SECURITY_ACCESSCONTROL_PERMISSIONS_H
 
 #include "DomainIdSet.h"
+#include "NameMatcher.h"
 
 #include <dds/DCPS/security/SSL/SignedDocument.h>
 #include <dds/DCPS/security/SSL/SubjectName.h>
@@ -69,7 +70,12 @@ struct OpenDDS_Security_Export Permissions : DCPS::RcObject {
     std::vector<std::string> topics;
     std::vector<std::string> partitions;
     Validity_t validity;
+    /// Compiled from topics and partitions by add_topic and add_partition.
+    NameMatcher topic_matcher;
+    NameMatcher partition_matcher;
 
+    void add_topic(const std::string& topic);
+    void add_partition(const std::string& partition);
     bool topic_matches(const char* topic) const;
     bool partitions_match(const DDS::StringSeq& entity_partitions, AllowDeny_t allow_or_deny) const;
     bool valid(time_t now_utc) const;
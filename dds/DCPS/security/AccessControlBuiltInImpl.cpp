@@ -27,6 +27,7 @@
 #include <iterator>
 #include <cstring>
 #include <iomanip>
+#include <limits>
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
@@ -376,16 +377,8 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
 
   for (gov_iter giter = begin; giter != end; ++giter) {
 
-    if (giter->domains.has(domain_id)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(topic_name, tr_iter->topic_expression.c_str())) {
-          if (!tr_iter->topic_attrs.is_write_protected) {
-            return true;
-          }
-        }
-      }
+    if (giter->domains.has(domain_id) && giter->write_unprotected_matcher.matches(topic_name)) {
+      return true;
     }
   }
 
@@ -402,7 +395,7 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
   }
 
   time_t expiration_time = grant->validity.not_after;
-  if (!search_permissions(topic_name, domain_id, partition, Permissions::PUBLISH, *grant, now_utc, expiration_time, ex)) {
+  if (!search_permissions(topic_name, domain_id, partition, Permissions::PUBLISH, *grant, ac_iter->second.verdicts, now_utc, expiration_time, ex)) {
     return false;
   }
 
@@ -441,16 +434,8 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
 
   for (gov_iter giter = begin; giter != end; ++giter) {
 
-    if (giter->domains.has(domain_id)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(topic_name, tr_iter->topic_expression.c_str())) {
-          if (!tr_iter->topic_attrs.is_read_protected) {
-            return true;
-          }
-        }
-      }
+    if (giter->domains.has(domain_id) && giter->read_unprotected_matcher.matches(topic_name)) {
+      return true;
     }
   }
 
@@ -467,7 +452,7 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
   }
 
   time_t expiration_time = grant->validity.not_after;
-  if (!search_permissions(topic_name, domain_id, partition, Permissions::SUBSCRIBE, *grant, now_utc, expiration_time, ex)) {
+  if (!search_permissions(topic_name, domain_id, partition, Permissions::SUBSCRIBE, *grant, ac_iter->second.verdicts, now_utc, expiration_time, ex)) {
     return false;
   }
 
@@ -511,16 +496,10 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
 
   for (gov_iter giter = begin; giter != end; ++giter) {
 
-    if (giter->domains.has(domain_to_find)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(topic_name, tr_iter->topic_expression.c_str())) {
-          if (!tr_iter->topic_attrs.is_read_protected || !tr_iter->topic_attrs.is_write_protected) {
-            return true;
-          }
-        }
-      }
+    if (giter->domains.has(domain_to_find) &&
+        (giter->read_unprotected_matcher.matches(topic_name) ||
+         giter->write_unprotected_matcher.matches(topic_name))) {
+      return true;
     }
   }
 
@@ -544,19 +523,15 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
       perm_topic_actions_iter tpsr_iter;
       for (tpsr_iter = ptr_iter->actions.begin(); tpsr_iter != ptr_iter->actions.end(); ++tpsr_iter) {
 
-        std::vector<std::string>::iterator tl_iter;
-        for (tl_iter = tpsr_iter->topics.begin(); tl_iter != tpsr_iter->topics.end(); ++tl_iter) {
-
-          if (pattern_match(topic_name, tl_iter->c_str())) {
-            if (ptr_iter->ad_type == Permissions::ALLOW) {
-              return true;
-            }
-            if (found_deny && denied_type != tpsr_iter->ps_type) {
-              return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl::check_create_topic: Both publish and subscribe are denied for this topic.");
-            } else if (!found_deny) {
-              found_deny = true;
-              denied_type = tpsr_iter->ps_type;
-            }
+        if (tpsr_iter->topic_matches(topic_name)) {
+          if (ptr_iter->ad_type == Permissions::ALLOW) {
+            return true;
+          }
+          if (found_deny && denied_type != tpsr_iter->ps_type) {
+            return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl::check_create_topic: Both publish and subscribe are denied for this topic.");
+          } else if (!found_deny) {
+            found_deny = true;
+            denied_type = tpsr_iter->ps_type;
           }
         }
       }
@@ -718,16 +693,8 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
 
   for (gov_iter giter = begin; giter != end; ++giter) {
 
-    if (giter->domains.has(domain_id)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(publication_data.base.base.topic_name, tr_iter->topic_expression.c_str())) {
-          if (!tr_iter->topic_attrs.is_write_protected) {
-            return true;
-          }
-        }
-      }
+    if (giter->domains.has(domain_id) && giter->write_unprotected_matcher.matches(publication_data.base.base.topic_name)) {
+      return true;
     }
   }
 
@@ -744,7 +711,7 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
   time_t expiration_time = grant->validity.not_after;
   if (!search_permissions(publication_data.base.base.topic_name, domain_id,
                           publication_data.base.base.partition, Permissions::PUBLISH,
-                          *grant, now_utc, expiration_time, ex)) {
+                          *grant, ac_iter->second.verdicts, now_utc, expiration_time, ex)) {
     return false;
   }
 
@@ -780,16 +747,8 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
 
   for (gov_iter giter = begin; giter != end; ++giter) {
 
-    if (giter->domains.has(domain_id)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(subscription_data.base.base.topic_name, tr_iter->topic_expression.c_str())) {
-          if (!tr_iter->topic_attrs.is_read_protected) {
-            return true;
-          }
-        }
-      }
+    if (giter->domains.has(domain_id) && giter->read_unprotected_matcher.matches(subscription_data.base.base.topic_name)) {
+      return true;
     }
   }
 
@@ -806,7 +765,7 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
   time_t expiration_time = grant->validity.not_after;
   if (!search_permissions(subscription_data.base.base.topic_name, domain_id,
                           subscription_data.base.base.partition, Permissions::SUBSCRIBE,
-                          *grant, now_utc, expiration_time, ex)) {
+                          *grant, ac_iter->second.verdicts, now_utc, expiration_time, ex)) {
     return false;
   }
 
@@ -883,16 +842,10 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
 
   for (gov_iter giter = begin; giter != end; ++giter) {
 
-    if (giter->domains.has(domain_id)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(topic_data.name, tr_iter->topic_expression.c_str())) {
-          if (!tr_iter->topic_attrs.is_read_protected || !tr_iter->topic_attrs.is_write_protected) {
-            return true;
-          }
-        }
-      }
+    if (giter->domains.has(domain_id) &&
+        (giter->read_unprotected_matcher.matches(topic_data.name) ||
+         giter->write_unprotected_matcher.matches(topic_data.name))) {
+      return true;
     }
   }
 
@@ -920,19 +873,15 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
         // TODO Add support for relay permissions once relay only key exchange is supported
         if (tpsr_iter->ps_type == Permissions::PUBLISH || tpsr_iter->ps_type == Permissions::SUBSCRIBE) {
 
-          std::vector<std::string>::iterator tl_iter;
-          for (tl_iter = tpsr_iter->topics.begin(); tl_iter != tpsr_iter->topics.end(); ++tl_iter) {
-
-            if (pattern_match(topic_data.name, tl_iter->c_str())) {
-              if (ptr_iter->ad_type == Permissions::ALLOW) {
-                return true;
-              }
-              if (found_deny && denied_type != tpsr_iter->ps_type) {
-                return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl::check_remote_topic: Both publish and subscribe are denied for this topic.");
-              } else if (!found_deny) {
-                found_deny = true;
-                denied_type = tpsr_iter->ps_type;
-              }
+          if (tpsr_iter->topic_matches(topic_data.name)) {
+            if (ptr_iter->ad_type == Permissions::ALLOW) {
+              return true;
+            }
+            if (found_deny && denied_type != tpsr_iter->ps_type) {
+              return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl::check_remote_topic: Both publish and subscribe are denied for this topic.");
+            } else if (!found_deny) {
+              found_deny = true;
+              denied_type = tpsr_iter->ps_type;
             }
           }
         }
@@ -1195,13 +1144,10 @@ AccessControlBuiltInImpl::~AccessControlBuiltInImpl()
   for (gov_iter giter = begin; giter != end; ++giter) {
 
     if (giter->domains.has(piter->second.domain_id)) {
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(topic_name, tr_iter->topic_expression.c_str())) {
-          attributes = tr_iter->topic_attrs;
-          return true;
-        }
+      const Governance::TopicAccessRule* const rule = giter->find_topic_rule(topic_name);
+      if (rule) {
+        attributes = rule->topic_attrs;
+        return true;
       }
     }
   }
@@ -1433,53 +1379,49 @@ CORBA::Boolean AccessControlBuiltInImpl::get_sec_attributes(::DDS::Security::Per
         return true;
       }
 
-      Governance::TopicAccessRules::iterator tr_iter;
-
-      for (tr_iter = giter->topic_rules.begin(); tr_iter != giter->topic_rules.end(); ++tr_iter) {
-        if (pattern_match(topic_name, tr_iter->topic_expression.c_str())) {
-
-          // Process the TopicSecurityAttributes base
-          attributes.base.is_write_protected = tr_iter->topic_attrs.is_write_protected;
-          attributes.base.is_read_protected = tr_iter->topic_attrs.is_read_protected;
-          attributes.base.is_liveliness_protected = tr_iter->topic_attrs.is_liveliness_protected;
-          attributes.base.is_discovery_protected = tr_iter->topic_attrs.is_discovery_protected;
+      const Governance::TopicAccessRule* const rule = giter->find_topic_rule(topic_name);
+      if (rule) {
+        // Process the TopicSecurityAttributes base
+        attributes.base.is_write_protected = rule->topic_attrs.is_write_protected;
+        attributes.base.is_read_protected = rule->topic_attrs.is_read_protected;
+        attributes.base.is_liveliness_protected = rule->topic_attrs.is_liveliness_protected;
+        attributes.base.is_discovery_protected = rule->topic_attrs.is_discovery_protected;
+
+        // Process metadata protection attributes
+        if (rule->metadata_protection_kind == "NONE") {
+          attributes.is_submessage_protected = false;
+        }
+        else {
+          attributes.is_submessage_protected = true;
 
-          // Process metadata protection attributes
-          if (tr_iter->metadata_protection_kind == "NONE") {
-            attributes.is_submessage_protected = false;
+          if (rule->metadata_protection_kind == "ENCRYPT" ||
+            rule->metadata_protection_kind == "ENCRYPT_WITH_ORIGIN_AUTHENTICATION") {
+            attributes.plugin_endpoint_attributes |= ::DDS::Security::PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED;
           }
-          else {
-            attributes.is_submessage_protected = true;
-
-            if (tr_iter->metadata_protection_kind == "ENCRYPT" ||
-              tr_iter->metadata_protection_kind == "ENCRYPT_WITH_ORIGIN_AUTHENTICATION") {
-              attributes.plugin_endpoint_attributes |= ::DDS::Security::PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ENCRYPTED;
-            }
 
-            if (tr_iter->metadata_protection_kind == "SIGN_WITH_ORIGIN_AUTHENTICATION" ||
-              tr_iter->metadata_protection_kind == "ENCRYPT_WITH_ORIGIN_AUTHENTICATION") {
-              attributes.plugin_endpoint_attributes |= ::DDS::Security::PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ORIGIN_AUTHENTICATED;
-            }
+          if (rule->metadata_protection_kind == "SIGN_WITH_ORIGIN_AUTHENTICATION" ||
+            rule->metadata_protection_kind == "ENCRYPT_WITH_ORIGIN_AUTHENTICATION") {
+            attributes.plugin_endpoint_attributes |= ::DDS::Security::PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_SUBMESSAGE_ORIGIN_AUTHENTICATED;
           }
+        }
 
-          // Process data protection attributes
+        // Process data protection attributes
 
-          if (tr_iter->data_protection_kind == "NONE") {
-            attributes.is_payload_protected = false;
-            attributes.is_key_protected = false;
-          }
-          else if (tr_iter->data_protection_kind == "SIGN") {
-            attributes.is_payload_protected = true;
-            attributes.is_key_protected = false;
-          }
-          else if (tr_iter->data_protection_kind == "ENCRYPT") {
-            attributes.is_payload_protected = true;
-            attributes.is_key_protected = true;
-            attributes.plugin_endpoint_attributes |= ::DDS::Security::PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
-          }
-
-          return true;
+        if (rule->data_protection_kind == "NONE") {
+          attributes.is_payload_protected = false;
+          attributes.is_key_protected = false;
+        }
+        else if (rule->data_protection_kind == "SIGN") {
+          attributes.is_payload_protected = true;
+          attributes.is_key_protected = false;
+        }
+        else if (rule->data_protection_kind == "ENCRYPT") {
+          attributes.is_payload_protected = true;
+          attributes.is_key_protected = true;
+          attributes.plugin_endpoint_attributes |= ::DDS::Security::PLUGIN_ENDPOINT_SECURITY_ATTRIBUTES_FLAG_IS_PAYLOAD_ENCRYPTED;
         }
+
+        return true;
       }
     }
   }
@@ -1488,16 +1430,106 @@ CORBA::Boolean AccessControlBuiltInImpl::get_sec_attributes(::DDS::Security::Per
   return false;
 }
 
+AccessControlBuiltInImpl::PermissionsVerdictKey::PermissionsVerdictKey(
+  DDS::Security::DomainId_t domain,
+  const char* topic,
+  const DDS::PartitionQosPolicy& partition,
+  Permissions::PublishSubscribe_t ps)
+  : domain_id(domain)
+  , topic_name(topic)
+  , pub_or_sub(ps)
+{
+  // An empty list and a list with just the empty name are told apart.
+  for (CORBA::ULong i = 0; i < partition.name.length(); ++i) {
+    partitions.append(partition.name[i].in());
+    partitions.push_back('\0');
+  }
+}
+
+bool AccessControlBuiltInImpl::PermissionsVerdictKey::operator<(const PermissionsVerdictKey& other) const
+{
+  if (domain_id != other.domain_id) {
+    return domain_id < other.domain_id;
+  }
+  if (pub_or_sub != other.pub_or_sub) {
+    return pub_or_sub < other.pub_or_sub;
+  }
+  const int topic_cmp = topic_name.compare(other.topic_name);
+  if (topic_cmp) {
+    return topic_cmp < 0;
+  }
+  return partitions < other.partitions;
+}
+
 bool AccessControlBuiltInImpl::search_permissions(
   const char* topic_name,
   const DDS::Security::DomainId_t domain_id,
   const DDS::PartitionQosPolicy& partition,
   const Permissions::PublishSubscribe_t pub_or_sub,
   const Permissions::Grant& grant,
+  PermissionsVerdictMap& verdicts,
   time_t now_utc,
   time_t& expiration_time,
   DDS::Security::SecurityException& ex)
 {
+  const PermissionsVerdictKey key(domain_id, topic_name, partition, pub_or_sub);
+  PermissionsVerdictMap::iterator it = verdicts.find(key);
+  if (it == verdicts.end()) {
+    if (verdicts.size() >= MAX_PERMISSIONS_VERDICTS) {
+      verdicts.clear();
+    }
+    it = verdicts.insert(std::make_pair(key, evaluate_permissions(topic_name, domain_id, partition,
+                                                                  pub_or_sub, grant, now_utc))).first;
+  } else if (!it->second.holds_at(now_utc)) {
+    it->second = evaluate_permissions(topic_name, domain_id, partition, pub_or_sub, grant, now_utc);
+  }
+
+  switch (it->second.kind) {
+  case PermissionsVerdict::ALLOW:
+    if (it->second.not_after != 0) {
+      expiration_time = std::min(expiration_time, it->second.not_after);
+    }
+    return true;
+  case PermissionsVerdict::DENY_RULE:
+    return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl: DENY rule matched");
+  default:
+    return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl: No matching rule for topic, default permission is DENY.");
+  }
+}
+
+AccessControlBuiltInImpl::PermissionsVerdict AccessControlBuiltInImpl::evaluate_permissions(
+  const char* topic_name,
+  const DDS::Security::DomainId_t domain_id,
+  const DDS::PartitionQosPolicy& partition,
+  const Permissions::PublishSubscribe_t pub_or_sub,
+  const Permissions::Grant& grant,
+  time_t now_utc)
+{
+  PermissionsVerdict verdict;
+  verdict.kind = grant.default_permission == Permissions::ALLOW ?
+    PermissionsVerdict::ALLOW : PermissionsVerdict::DENY_DEFAULT;
+  verdict.not_after = 0;
+  verdict.valid_from = std::numeric_limits<time_t>::min();
+  verdict.valid_until = std::numeric_limits<time_t>::max();
+
+  // Whether an action is valid only changes at its not_before and just after
+  // its not_after, so the verdict holds between the nearest of those.
+  for (Permissions::Rules::const_iterator rit = grant.rules.begin(); rit != grant.rules.end(); ++rit) {
+    for (Permissions::Actions::const_iterator ait = rit->actions.begin(); ait != rit->actions.end(); ++ait) {
+      const time_t boundaries[] = {ait->validity.not_before, ait->validity.not_after ? ait->validity.not_after + 1 : 0};
+      for (size_t i = 0; i < sizeof boundaries / sizeof boundaries[0]; ++i) {
+        if (boundaries[i] == 0) {
+          continue;
+        }
+        if (boundaries[i] <= now_utc) {
+          verdict.valid_from = std::max(verdict.valid_from, boundaries[i]);
+        } else {
+          verdict.valid_until = std::min(verdict.valid_until, boundaries[i]);
+        }
+      }
+    }
+  }
+
   for (Permissions::Rules::const_iterator rit = grant.rules.begin(); rit != grant.rules.end(); ++rit) {
     if (rit->domains.has(domain_id)) {
       for (Permissions::Actions::const_iterator ait = rit->actions.begin(); ait != rit->actions.end(); ++ait) {
@@ -1506,23 +1538,18 @@ bool AccessControlBuiltInImpl::search_permissions(
             ait->partitions_match(partition.name, rit->ad_type) &&
             ait->valid(now_utc)) {
           if (rit->ad_type == Permissions::ALLOW) {
-            if (ait->validity.not_after != 0) {
-              expiration_time = std::min(expiration_time, ait->validity.not_after);
-            }
-            return true;
+            verdict.kind = PermissionsVerdict::ALLOW;
+            verdict.not_after = ait->validity.not_after;
           } else {
-            return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl: DENY rule matched");
+            verdict.kind = PermissionsVerdict::DENY_RULE;
           }
+          return verdict;
         }
       }
     }
   }
 
-  if (grant.default_permission == Permissions::ALLOW) {
-    return true;
-  } else {
-    return CommonUtilities::set_security_error(ex, -1, 0, "AccessControlBuiltInImpl: No matching rule for topic, default permission is DENY.");
-  }
+  return verdict;
 }
 
 void AccessControlBuiltInImpl::parse_class_id(
@@ -243,6 +243,43 @@ private:
   AccessControlBuiltInImpl(const AccessControlBuiltInImpl&);
   AccessControlBuiltInImpl& operator=(const AccessControlBuiltInImpl&);
 
+  /// What search_permissions() found for a topic, partitions, and action.
+  struct PermissionsVerdict {
+    enum Kind { ALLOW, DENY_RULE, DENY_DEFAULT };
+    Kind kind;
+    /// not_after of the allowing action, 0 if it has none.
+    time_t not_after;
+    /// The verdict holds from valid_from up to but not including
+    /// valid_until, since the actions are valid at different times.
+    time_t valid_from;
+    time_t valid_until;
+
+    bool holds_at(time_t now_utc) const
+    {
+      return valid_from <= now_utc && now_utc < valid_until;
+    }
+  };
+
+  struct PermissionsVerdictKey {
+    PermissionsVerdictKey(DDS::Security::DomainId_t domain_id,
+                          const char* topic_name,
+                          const DDS::PartitionQosPolicy& partition,
+                          Permissions::PublishSubscribe_t pub_or_sub);
+
+    bool operator<(const PermissionsVerdictKey& other) const;
+
+    DDS::Security::DomainId_t domain_id;
+    std::string topic_name;
+    /// Each partition name followed by a null.
+    std::string partitions;
+    Permissions::PublishSubscribe_t pub_or_sub;
+  };
+
+  typedef std::map<PermissionsVerdictKey, PermissionsVerdict> PermissionsVerdictMap;
+
+  /// Bound on the number of cached verdicts per permissions handle.
+  static const size_t MAX_PERMISSIONS_VERDICTS = 1024;
+
   struct AccessData {
     DDS::Security::IdentityHandle identity;
     DDS::Security::DomainId_t domain_id;
@@ -250,6 +287,7 @@ private:
     Permissions::shared_ptr perm;
     Governance::shared_ptr gov;
     LocalAccessCredentialData::shared_ptr local_access_credential_data;
+    PermissionsVerdictMap verdicts;
   };
 
   typedef std::map<DDS::Security::PermissionsHandle, AccessData> ACPermsMap;
@@ -313,10 +351,18 @@ private:
                           const DDS::PartitionQosPolicy& partition,
                           Permissions::PublishSubscribe_t pub_or_sub,
                           const Permissions::Grant& grant,
+                          PermissionsVerdictMap& verdicts,
                           time_t now_utc,
                           time_t& expiration_time,
                           DDS::Security::SecurityException& ex);
 
+  static PermissionsVerdict evaluate_permissions(const char* topic_name,
+                                                 DDS::Security::DomainId_t domain_id,
+                                                 const DDS::PartitionQosPolicy& partition,
+                                                 Permissions::PublishSubscribe_t pub_or_sub,
+                                                 const Permissions::Grant& grant,
+                                                 time_t now_utc);
+
   void parse_class_id(const std::string& class_id,
                       std::string& plugin_class_name,
                       int& major_version,
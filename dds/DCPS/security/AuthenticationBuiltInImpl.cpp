@@ -675,7 +675,7 @@ static void make_final_signature_sequence(const DDS::OctetSeq& hash_c1,
   if (cid.length() > 0) {
 
     remote_cert->deserialize(cid);
-    if (X509_V_OK != remote_cert->validate(local_credential_data.get_ca_cert()))
+    if (X509_V_OK != validate_certificate(*remote_cert, local_credential_data.get_ca_cert()))
     {
       set_security_error(ex, -1, 0, "Certificate validation failed");
       return Failure;
@@ -1117,7 +1117,7 @@ DDS::Security::ValidationResult_t AuthenticationBuiltInImpl::process_handshake_r
 
       remote_cert->deserialize(cid);
 
-    if (X509_V_OK != remote_cert->validate(local_credential_data.get_ca_cert()))
+    if (X509_V_OK != validate_certificate(*remote_cert, local_credential_data.get_ca_cert()))
     {
       set_security_error(ex, -1, 0, "Certificate validation failed");
       return Failure;
@@ -1481,6 +1481,47 @@ std::string AuthenticationBuiltInImpl::get_extension(const char* class_id)
   return ext_string;
 }
 
+size_t AuthenticationBuiltInImpl::validated_certificates() const
+{
+  ACE_Guard<ACE_Thread_Mutex> guard(validated_certificates_mutex_);
+  return validated_certificates_.size();
+}
+
+int AuthenticationBuiltInImpl::validate_certificate(const SSL::Certificate& cert, const SSL::Certificate& ca)
+{
+  std::vector<const DDS::OctetSeq*> contents;
+  contents.push_back(&ca.original_bytes());
+  contents.push_back(&cert.original_bytes());
+  DDS::OctetSeq digest;
+  if (SSL::hash(contents, digest) != 0 || !cert.x509() || !ca.x509()) {
+    return cert.validate(ca);
+  }
+  const std::string fingerprint(reinterpret_cast<const char*>(digest.get_buffer()), digest.length());
+
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(validated_certificates_mutex_);
+    if (validated_certificates_.count(fingerprint)) {
+      // The chain was verified before, but either certificate may have
+      // expired since.
+      if (X509_cmp_current_time(X509_get_notAfter(cert.x509())) > 0 &&
+          X509_cmp_current_time(X509_get_notAfter(ca.x509())) > 0) {
+        return X509_V_OK;
+      }
+      validated_certificates_.erase(fingerprint);
+    }
+  }
+
+  const int result = cert.validate(ca);
+  if (result == X509_V_OK) {
+    ACE_Guard<ACE_Thread_Mutex> guard(validated_certificates_mutex_);
+    if (validated_certificates_.size() >= MAX_VALIDATED_CERTIFICATES) {
+      validated_certificates_.clear();
+    }
+    validated_certificates_.insert(fingerprint);
+  }
+  return result;
+}
+
 CORBA::Long AuthenticationBuiltInImpl::get_next_handle()
 {
   ACE_Guard<ACE_Thread_Mutex> guard(handle_mutex_);
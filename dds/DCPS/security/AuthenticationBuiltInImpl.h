@@ -22,6 +22,7 @@
 #include <ace/Thread_Mutex.h>
 
 #include <map>
+#include <set>
 #include <string>
 #include <memory>
 
@@ -158,6 +159,9 @@ public:
     ::DDS::Security::SharedSecretHandle* sharedsecret_handle,
     ::DDS::Security::SecurityException & ex);
 
+  /// Number of remote certificates whose chain verification is cached.
+  size_t validated_certificates() const;
+
 private:
 
   struct RemoteParticipantData : public DCPS::RcObject {
@@ -242,6 +246,12 @@ private:
     DDS::Security::HandshakeHandle handshake_handle,
     DDS::Security::SecurityException & ex);
 
+  /// Verify the chain of cert against ca.  Successful verifications are
+  /// remembered by the fingerprint of both certificates so a peer that
+  /// handshakes again, or with another local participant, only has its
+  /// validity period checked.
+  int validate_certificate(const SSL::Certificate& cert, const SSL::Certificate& ca);
+
   bool is_handshake_initiator(const DCPS::GUID_t& local, const DCPS::GUID_t& remote);
 
   bool check_class_versions(const char* remote_class_id);
@@ -283,6 +293,11 @@ private:
   ACE_Thread_Mutex handshake_mutex_;
   ACE_Thread_Mutex handle_mutex_;
 
+  static const size_t MAX_VALIDATED_CERTIFICATES = 1024;
+  typedef std::set<std::string> FingerprintSet;
+  FingerprintSet validated_certificates_;
+  mutable ACE_Thread_Mutex validated_certificates_mutex_;
+
   CORBA::Long next_handle_;
 
 };
@@ -44,6 +44,9 @@ OpenDDS::DCPS::DataLinkSet::insert_link(const DataLink_rch& link)
   DBG_ENTRY_LVL("DataLinkSet","insert_link",6);
   GuardType guard(this->lock_);
   const int retval = OpenDDS::DCPS::bind(map_, link->id(), link);
+  if (retval == 0) {
+    snapshot_.reset();
+  }
   VDBG((LM_DEBUG,
         ACE_TEXT("(%P|%t) DataLinkSet::insert_link: ")
         ACE_TEXT("added link [%@] id %d %C to map\n"),
@@ -57,6 +60,9 @@ OpenDDS::DCPS::DataLinkSet::remove_link(const DataLink_rch& link)
   DBG_ENTRY_LVL("DataLinkSet", "remove_link", 6);
   GuardType guard1(this->lock_);
   const int retval = unbind(map_, link->id());
+  if (retval == 0) {
+    snapshot_.reset();
+  }
   VDBG((LM_DEBUG,
         ACE_TEXT("(%P|%t) DataLinkSet::remove_link: ")
         ACE_TEXT("link [%@] id %d %Cfound in map.\n"),
@@ -96,13 +102,9 @@ OpenDDS::DCPS::DataLinkSet::empty()
 
 void OpenDDS::DCPS::DataLinkSet::terminate_send_if_suspended()
 {
-  MapType map_copy;
-  {
-    GuardType guard(lock_);
-    map_copy = map_;
-  }
-  for (MapType::iterator itr = map_copy.begin();
-      itr != map_copy.end(); ++itr) {
+  const Snapshot_rch links = snapshot();
+  for (MapType::const_iterator itr = links->map().begin();
+      itr != links->map().end(); ++itr) {
         itr->second->terminate_send_if_suspended();
   }
 }
@@ -80,11 +80,26 @@ public:
   typedef OPENDDS_MAP(DataLinkIdType, DataLink_rch) MapType;
 
   //{@
-  /// Accessors for external iteration
+  /// Accessors for external iteration.  The map must not be modified.
   LockType& lock() { return lock_; }
   MapType& map() { return map_; }
   //@}
 
+  /// Immutable copy of the links in the set.  Sending takes a reference to
+  /// the current snapshot instead of copying the map, and the set replaces
+  /// the snapshot when the links change.
+  class Snapshot : public virtual RcObject {
+  public:
+    explicit Snapshot(const MapType& map) : map_(map) {}
+    const MapType& map() const { return map_; }
+
+  private:
+    const MapType map_;
+  };
+  typedef RcHandle<Snapshot> Snapshot_rch;
+
+  Snapshot_rch snapshot() const;
+
   void terminate_send_if_suspended();
 
   bool is_leading(const GUID_t& writer_id,
@@ -95,6 +110,9 @@ private:
   /// Hash map for DataLinks.
   MapType map_;
 
+  /// Snapshot of map_, created on demand and reset when map_ changes.
+  mutable Snapshot_rch snapshot_;
+
   /// This lock will protect critical sections of code that play a
   /// role in the sending of data.
   mutable LockType lock_;
@@ -102,8 +120,7 @@ private:
   /// Listener for TransportSendControlElements created in send_response
   SendResponseListener send_response_listener_;
 
-  /// lock and copy map for lock-free access
-  void copy_map_to(MapType& target);
+  Snapshot_rch snapshot_i() const;
 };
 
 } // namespace DCPS
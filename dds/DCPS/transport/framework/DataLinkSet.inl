@@ -30,15 +30,12 @@ OpenDDS::DCPS::DataLinkSet::send(DataSampleElement* sample)
     DataSampleHeader::test_flag(CONTENT_FILTER_FLAG, sample->get_sample());
 #endif
 
-  MapType map_copy;
-  {
-    GuardType guard(lock_);
-    map_copy = map_;
-  }
+  const Snapshot_rch links = snapshot();
+  const MapType& map = links->map();
 
-  if (map_copy.size()) {
-    TransportSendElement* send_element = new TransportSendElement(static_cast<int>(map_copy.size()), sample);
-    for (MapType::iterator itr = map_copy.begin(); itr != map_copy.end(); ++itr) {
+  if (map.size()) {
+    TransportSendElement* send_element = new TransportSendElement(static_cast<int>(map.size()), sample);
+    for (MapType::const_iterator itr = map.begin(); itr != map.end(); ++itr) {
 
 #ifndef OPENDDS_NO_CONTENT_SUBSCRIPTION_PROFILE
       if (customHeader) {
@@ -82,16 +79,13 @@ OpenDDS::DCPS::DataLinkSet::send_control(DataSampleElement* sample)
 {
   DBG_ENTRY_LVL("DataLinkSet", "send_control", 6);
   VDBG((LM_DEBUG, "(%P|%t) DBG: DataLinkSet::send_control %@.\n", sample));
-  MapType map_copy;
-  {
-    GuardType guard(lock_);
-    map_copy = map_;
-  }
+  const Snapshot_rch links = snapshot();
+  const MapType& map = links->map();
 
   TransportSendControlElement* send_element =
-    new TransportSendControlElement(static_cast<int>(map_copy.size()), sample);
+    new TransportSendControlElement(static_cast<int>(map.size()), sample);
 
-  for (MapType::iterator itr = map_copy.begin(); itr != map_copy.end(); ++itr) {
+  for (MapType::const_iterator itr = map.begin(); itr != map.end(); ++itr) {
     itr->second->send(send_element);
   }
 }
@@ -105,10 +99,10 @@ OpenDDS::DCPS::DataLinkSet::send_control(GUID_t                           pub_id
   DBG_ENTRY_LVL("DataLinkSet","send_control",6);
   //Optimized - use cached allocator.
 
-  MapType dup_map;
-  copy_map_to(dup_map);
+  const Snapshot_rch links = snapshot();
+  const MapType& map = links->map();
 
-  if (dup_map.empty()) {
+  if (map.empty()) {
     // similar to the "no links" case in TransportClient::send()
     if (DCPS_debug_level > 4) {
       const LogGuid logger(pub_id);
@@ -123,11 +117,11 @@ OpenDDS::DCPS::DataLinkSet::send_control(GUID_t                           pub_id
   }
 
   TransportSendControlElement* const send_element =
-    new TransportSendControlElement(static_cast<int>(dup_map.size()), pub_id,
+    new TransportSendControlElement(static_cast<int>(map.size()), pub_id,
                                        listener.in(), header, move(msg));
 
-  for (MapType::iterator itr = dup_map.begin();
-       itr != dup_map.end();
+  for (MapType::const_iterator itr = map.begin();
+       itr != map.end();
        ++itr) {
     itr->second->send_start();
     itr->second->send(send_element);
@@ -166,13 +160,9 @@ ACE_INLINE bool
 OpenDDS::DCPS::DataLinkSet::remove_sample(const DataSampleElement* sample)
 {
   DBG_ENTRY_LVL("DataLinkSet", "remove_sample", 6);
-  MapType map_copy;
-  {
-    GuardType guard(lock_);
-    map_copy = map_;
-  }
-  const MapType::iterator end = map_copy.end();
-  for (MapType::iterator itr = map_copy.begin(); itr != end; ++itr) {
+  const Snapshot_rch links = snapshot();
+  const MapType::const_iterator end = links->map().end();
+  for (MapType::const_iterator itr = links->map().begin(); itr != end; ++itr) {
     if (itr->second->remove_sample(sample) == REMOVE_RELEASED) {
       return true;
     }
@@ -185,13 +175,9 @@ ACE_INLINE bool
 OpenDDS::DCPS::DataLinkSet::remove_all_msgs(const GUID_t& pub_id)
 {
   DBG_ENTRY_LVL("DataLinkSet", "remove_all_msgs", 6);
-  MapType map_copy;
-  {
-    GuardType guard(lock_);
-    map_copy = map_;
-  }
-  const MapType::iterator end = map_copy.end();
-  for (MapType::iterator itr = map_copy.begin(); itr != end; ++itr) {
+  const Snapshot_rch links = snapshot();
+  const MapType::const_iterator end = links->map().end();
+  for (MapType::const_iterator itr = links->map().begin(); itr != end; ++itr) {
     itr->second->remove_all_msgs(pub_id);
   }
 
@@ -218,6 +204,7 @@ OpenDDS::DCPS::DataLinkSet::send_start(DataLinkSet* in)
         // meaning that it wasn't already a member.  We should tell
         // the DataLink about the send_start() event.
         send_start_vec.push_back(itr->second);
+        snapshot_.reset();
 
       } else if (result == -1) {
         ACE_ERROR((LM_ERROR,
@@ -243,8 +230,8 @@ OpenDDS::DCPS::DataLinkSet::send_stop(GUID_t repoId)
   MapType map_copy;
   {
     GuardType guard(lock_);
-    map_copy = map_;
-    map_.clear();
+    map_copy.swap(map_);
+    snapshot_.reset();
   }
 
   for (MapType::iterator itr = map_copy.begin(); itr != map_copy.end(); ++itr) {
@@ -252,21 +239,20 @@ OpenDDS::DCPS::DataLinkSet::send_stop(GUID_t repoId)
   }
 }
 
-ACE_INLINE void
-OpenDDS::DCPS::DataLinkSet::copy_map_to(MapType& target)
+ACE_INLINE OpenDDS::DCPS::DataLinkSet::Snapshot_rch
+OpenDDS::DCPS::DataLinkSet::snapshot() const
 {
-  target.clear();
-
-  // Lock the existing map
-  GuardType guard(this->lock_);
-
+  GuardType guard(lock_);
+  return snapshot_i();
+}
 
-  // Copy to target
-  for (MapType::iterator itr = map_.begin();
-       itr != map_.end();
-       ++itr) {
-    target.insert(*itr);
+ACE_INLINE OpenDDS::DCPS::DataLinkSet::Snapshot_rch
+OpenDDS::DCPS::DataLinkSet::snapshot_i() const
+{
+  if (!snapshot_) {
+    snapshot_ = make_rch<Snapshot>(map_);
   }
+  return snapshot_;
 }
 
 ACE_INLINE void
@@ -275,8 +261,8 @@ OpenDDS::DCPS::DataLinkSet::send_final_acks(const GUID_t& readerid)
   MapType map_copy;
   {
     GuardType guard(lock_);
-    map_copy = map_;
-    map_.clear();
+    map_copy.swap(map_);
+    snapshot_.reset();
   }
 
   for (MapType::iterator itr = map_copy.begin(); itr != map_copy.end(); ++itr) {
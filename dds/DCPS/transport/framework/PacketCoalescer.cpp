@@ -0,0 +1,81 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
+#include "PacketCoalescer.h"
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+void
+CoalesceStatistics::take(CoalesceCount& count)
+{
+  count.packets = packets.exchange(0);
+  count.samples = samples.exchange(0);
+  count.window_flushes = window_flushes.exchange(0);
+  count.size_flushes = size_flushes.exchange(0);
+  count.delay_usec = delay_usec.exchange(0);
+}
+
+PacketCoalescer::PacketCoalescer(const TimeDuration& window, size_t bytes,
+                                 const RcHandle<CoalesceStatistics>& statistics)
+  : window_(window)
+  , bytes_(bytes)
+  , statistics_(statistics)
+  , holding_(false)
+{
+}
+
+bool
+PacketCoalescer::hold(const MonotonicTimePoint& now, size_t packet_bytes, size_t samples,
+                      TimeDuration& remaining)
+{
+  if (packet_bytes >= bytes_) {
+    release(now, samples, false);
+    return false;
+  }
+
+  if (!holding_) {
+    holding_ = true;
+    start_ = now;
+  }
+
+  remaining = start_ + window_ - now;
+  if (remaining <= TimeDuration::zero_value) {
+    release(now, samples, true);
+    return false;
+  }
+  return true;
+}
+
+void
+PacketCoalescer::release(const MonotonicTimePoint& now, size_t samples, bool window_expired)
+{
+  if (!holding_) {
+    return;
+  }
+  holding_ = false;
+
+  if (samples == 0 || !statistics_) {
+    return;
+  }
+
+  ++statistics_->packets;
+  statistics_->samples += samples;
+  if (window_expired) {
+    ++statistics_->window_flushes;
+  } else {
+    ++statistics_->size_flushes;
+  }
+  const ACE_Time_Value delay = (now - start_).value();
+  statistics_->delay_usec += static_cast<ACE_UINT64>(delay.sec()) * 1000000 + delay.usec();
+}
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
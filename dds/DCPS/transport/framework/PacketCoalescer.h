@@ -0,0 +1,102 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_TRANSPORT_FRAMEWORK_PACKETCOALESCER_H
+#define OPENDDS_DCPS_TRANSPORT_FRAMEWORK_PACKETCOALESCER_H
+
+#include <dds/DCPS/Atomic.h>
+#include <dds/DCPS/RcObject.h>
+#include <dds/DCPS/TimeTypes.h>
+#include <dds/DCPS/dcps_export.h>
+
+#include <dds/OpenddsDcpsExtC.h>
+
+#ifndef ACE_LACKS_PRAGMA_ONCE
+#  pragma once
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/// Counters for holding back MODE_DIRECT packets so later writes can share
+/// them (see TransportInst::coalesce_window).  Samples per packet measure
+/// the throughput gained, the delay measures the latency paid for it.  One
+/// instance is shared by all the send strategies of a transport.
+struct OpenDDS_Dcps_Export CoalesceStatistics : public RcObject {
+  /// Packets that were held back at least once before being sent.
+  Atomic<size_t> packets;
+  /// Samples carried by those packets.
+  Atomic<size_t> samples;
+  /// Packets sent because the coalesce window expired.
+  Atomic<size_t> window_flushes;
+  /// Packets sent because they reached the byte or sample limits.
+  Atomic<size_t> size_flushes;
+  /// Total time, in microseconds, the first sample of those packets waited.
+  Atomic<ACE_UINT64> delay_usec;
+
+  CoalesceStatistics()
+    : packets(0)
+    , samples(0)
+    , window_flushes(0)
+    , size_flushes(0)
+    , delay_usec(0)
+  {}
+
+  /// Move the counts into count and start counting from zero.
+  void take(CoalesceCount& count);
+};
+
+/**
+ * Decides when a packet that a send strategy would send right away is held
+ * back instead, so that later writes can be added to it.
+ *
+ * A packet is held for at most the window, measured from when it was first
+ * held, and is sent early once it reaches the byte threshold.  The caller
+ * does the sending and the scheduling; this class only tracks the held
+ * packet and counts the outcome in the shared CoalesceStatistics.  It does
+ * no locking.
+ */
+class OpenDDS_Dcps_Export PacketCoalescer {
+public:
+  PacketCoalescer(const TimeDuration& window, size_t bytes,
+                  const RcHandle<CoalesceStatistics>& statistics);
+
+  bool holding() const { return holding_; }
+
+  /// Is a held packet of packet_bytes big enough to be sent now?
+  bool full(size_t packet_bytes) const
+  {
+    return holding_ && packet_bytes >= bytes_;
+  }
+
+  /// Called when the writer stops adding to a packet of packet_bytes holding
+  /// samples.  Returns true if the packet should be held, with remaining set
+  /// to the rest of the window.  Otherwise the packet should be sent now and
+  /// release() was already called for it.
+  bool hold(const MonotonicTimePoint& now, size_t packet_bytes, size_t samples,
+            TimeDuration& remaining);
+
+  /// Account for the held packet, if any, which is about to be sent.
+  void release(const MonotonicTimePoint& now, size_t samples, bool window_expired);
+
+  /// Forget the held packet without counting it.
+  void reset() { holding_ = false; }
+
+private:
+  const TimeDuration window_;
+  const size_t bytes_;
+  const RcHandle<CoalesceStatistics> statistics_;
+  bool holding_;
+  MonotonicTimePoint start_;
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* OPENDDS_DCPS_TRANSPORT_FRAMEWORK_PACKETCOALESCER_H */
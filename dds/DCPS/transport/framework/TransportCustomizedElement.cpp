@@ -9,6 +9,7 @@
 #include "TransportCustomizedElement.h"
 #include "TransportSendListener.h"
 #include "TransportSendElement.h"
+#include "TransportQueueElementPool.h"
 
 #if !defined (__ACE_INLINE__)
 #include "TransportCustomizedElement.inl"
@@ -19,11 +20,33 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
+namespace {
+  // Leaked so that elements released during static destruction still have it.
+  TransportQueueElementPool& pool()
+  {
+    static TransportQueueElementPool* const instance =
+      new TransportQueueElementPool("TransportCustomizedElement", sizeof(TransportCustomizedElement));
+    return *instance;
+  }
+}
+
 TransportCustomizedElement::~TransportCustomizedElement()
 {
   DBG_ENTRY_LVL("TransportCustomizedElement", "~TransportCustomizedElement", 6);
 }
 
+void*
+TransportCustomizedElement::operator new(size_t size)
+{
+  return pool().allocate(size);
+}
+
+void
+TransportCustomizedElement::operator delete(void* ptr, size_t size)
+{
+  pool().deallocate(ptr, size);
+}
+
 void
 TransportCustomizedElement::release_element(bool dropped_by_transport)
 {
@@ -25,6 +25,10 @@ class OpenDDS_Dcps_Export TransportCustomizedElement
 public:
   explicit TransportCustomizedElement(TransportQueueElement* orig);
 
+  /// Elements are pooled since one is created for each sample sent.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   void set_fragment(TransportQueueElement* orig);
 
   virtual GUID_t publication_id() const;
@@ -9,6 +9,7 @@
 #include "TransportImpl.h"
 #include "DataLink.h"
 #include "TransportExceptions.h"
+#include "TransportStatistics.h"
 #include "dds/DCPS/BuiltInTopicUtils.h"
 #include "dds/DCPS/DataWriterImpl.h"
 #include "dds/DCPS/DataReaderImpl.h"
@@ -34,6 +35,7 @@ TransportImpl::TransportImpl(TransportInst_rch config,
                              DDS::DomainId_t domain)
   : config_(config)
   , event_dispatcher_(make_rch<ServiceEventDispatcher>(1))
+  , coalesce_statistics_(make_rch<CoalesceStatistics>())
   , is_shut_down_(false)
   , domain_(domain)
 {
@@ -139,6 +141,14 @@ TransportImpl::report()
   }
 }
 
+void
+TransportImpl::append_transport_statistics(TransportStatisticsSequence& seq)
+{
+  const TransportInst_rch cfg = config_.lock();
+  append(seq, InternalTransportStatistics(cfg ? cfg->name() : OPENDDS_STRING()));
+  coalesce_statistics_->take(seq[seq.length() - 1].coalesce);
+}
+
 void
 TransportImpl::dump()
 {
@@ -10,6 +10,7 @@
 #include "TransportInst_rch.h"
 #include "TransportInst.h"
 #include "DataLinkCleanupTask.h"
+#include "PacketCoalescer.h"
 
 #include <dds/DCPS/AtomicBool.h>
 #include <dds/DCPS/DiscoveryListener.h>
@@ -111,7 +112,10 @@ public:
   virtual void get_last_recv_locator(const GUID_t& /*remote_id*/,
                                      TransportLocator& /*locators*/) {}
 
-  virtual void append_transport_statistics(TransportStatisticsSequence& /*seq*/) {}
+  /// Append an element for this transport to seq.  The default only has
+  /// the counts kept by the framework for every transport: coalescing and
+  /// queue elements.
+  virtual void append_transport_statistics(TransportStatisticsSequence& seq);
 
   /// Interface to the transport's reactor for scheduling timers.
   ACE_Reactor_Timer_Interface* timer() const;
@@ -178,6 +182,9 @@ public:
 
   EventDispatcher_rch event_dispatcher() { return event_dispatcher_; }
 
+  /// Counters shared by the send strategies of this transport.
+  const RcHandle<CoalesceStatistics>& coalesce_statistics() const { return coalesce_statistics_; }
+
   DDS::DomainId_t domain() const { return domain_; }
 
 protected:
@@ -301,6 +308,8 @@ private:
   /// smart ptr to the associated DL cleanup task
   EventDispatcher_rch event_dispatcher_;
 
+  const RcHandle<CoalesceStatistics> coalesce_statistics_;
+
   /// Monitor object for this entity
   unique_ptr<Monitor> monitor_;
 
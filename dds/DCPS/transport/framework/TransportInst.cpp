@@ -78,6 +78,8 @@ TransportInst::dump_to_str(DDS::DomainId_t) const
   ret += formatNameForDump("max_packet_size")         + to_dds_string(unsigned(max_packet_size())) + '\n';
   ret += formatNameForDump("max_samples_per_packet")  + to_dds_string(unsigned(max_samples_per_packet())) + '\n';
   ret += formatNameForDump("optimum_packet_size")     + to_dds_string(unsigned(optimum_packet_size())) + '\n';
+  ret += formatNameForDump("coalesce_window")         + to_dds_string(unsigned(coalesce_window())) + '\n';
+  ret += formatNameForDump("coalesce_bytes")          + to_dds_string(unsigned(coalesce_bytes())) + '\n';
   ret += formatNameForDump("thread_per_connection")   + (thread_per_connection() ? "true" : "false") + '\n';
   ret += formatNameForDump("datalink_release_delay")  + to_dds_string(datalink_release_delay()) + '\n';
   ret += formatNameForDump("datalink_control_chunks") + to_dds_string(unsigned(datalink_control_chunks())) + '\n';
@@ -139,6 +141,30 @@ TransportInst::optimum_packet_size() const
   return TheServiceParticipant->config_store()->get_uint32(config_key("OPTIMUM_PACKET_SIZE").c_str(), DEFAULT_CONFIG_OPTIMUM_PACKET_SIZE);
 }
 
+void
+TransportInst::coalesce_window(ACE_UINT32 usec)
+{
+  TheServiceParticipant->config_store()->set_uint32(config_key("COALESCE_WINDOW").c_str(), usec);
+}
+
+ACE_UINT32
+TransportInst::coalesce_window() const
+{
+  return TheServiceParticipant->config_store()->get_uint32(config_key("COALESCE_WINDOW").c_str(), 0);
+}
+
+void
+TransportInst::coalesce_bytes(ACE_UINT32 bytes)
+{
+  TheServiceParticipant->config_store()->set_uint32(config_key("COALESCE_BYTES").c_str(), bytes);
+}
+
+ACE_UINT32
+TransportInst::coalesce_bytes() const
+{
+  return TheServiceParticipant->config_store()->get_uint32(config_key("COALESCE_BYTES").c_str(), 0);
+}
+
 void
 TransportInst::thread_per_connection(bool tpc)
 {
@@ -402,6 +428,17 @@ TransportInst::get_ice_endpoint(DDS::DomainId_t domain,
   return temp ? temp->get_ice_endpoint() : WeakRcHandle<OpenDDS::ICE::Endpoint>();
 }
 
+void
+TransportInst::append_transport_statistics(TransportStatisticsSequence& seq,
+                                           DDS::DomainId_t domain,
+                                           DomainParticipantImpl* participant)
+{
+  const TransportImpl_rch impl = get_impl(domain, participant);
+  if (impl) {
+    impl->append_transport_statistics(seq);
+  }
+}
+
 void
 TransportInst::rtps_relay_only_now(bool flag)
 {
@@ -96,6 +96,18 @@ public:
   void optimum_packet_size(ACE_UINT32 ops);
   ACE_UINT32 optimum_packet_size() const;
 
+  /// Time, in microseconds, that a packet written without backpressure
+  /// may be held back so that later writes can share it.  The packet is
+  /// sent when the window expires or when it reaches coalesce_bytes.
+  /// The default (0) sends every write right away.
+  void coalesce_window(ACE_UINT32 usec);
+  ACE_UINT32 coalesce_window() const;
+
+  /// Size (in bytes) at which a held back packet is sent before the
+  /// coalesce_window expires.  The default (0) uses optimum_packet_size.
+  void coalesce_bytes(ACE_UINT32 bytes);
+  ACE_UINT32 coalesce_bytes() const;
+
   /// Flag for whether a new thread is needed for connection to
   /// send without backpressure.
   void thread_per_connection(bool tpc);
@@ -195,9 +207,11 @@ public:
   void count_messages(bool flag);
   bool count_messages() const;
 
-  virtual void append_transport_statistics(TransportStatisticsSequence& /*seq*/,
-                                           DDS::DomainId_t /*domain*/,
-                                           DomainParticipantImpl* /*participant*/) {}
+  /// Append the statistics of the transport used by participant, if it has
+  /// been created, to seq.
+  virtual void append_transport_statistics(TransportStatisticsSequence& seq,
+                                           DDS::DomainId_t domain,
+                                           DomainParticipantImpl* participant);
 
   static void set_port_in_addr_string(OPENDDS_STRING& addr_str, u_short port_number);
 
@@ -0,0 +1,419 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
+#include "TransportQueueElementPool.h"
+
+#include <dds/DCPS/PoolAllocator.h>
+#include <dds/DCPS/Util.h>
+
+#include <ace/Guard_T.h>
+#include <ace/Malloc_Base.h>
+
+#include <algorithm>
+#include <new>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+namespace {
+  void* heap_allocate(size_t size)
+  {
+    void* const ptr = ACE_Allocator::instance()->malloc(size);
+    if (ptr == 0) {
+      throw std::bad_alloc();
+    }
+    return ptr;
+  }
+
+  void heap_free(void* ptr)
+  {
+    ACE_Allocator::instance()->free(ptr);
+  }
+
+  typedef TransportQueueElementPool::FreeElement FreeElement;
+
+  void heap_free_list(FreeElement* element)
+  {
+    while (element) {
+      FreeElement* const next = element->next;
+      heap_free(element);
+      element = next;
+    }
+  }
+
+#ifdef ACE_HAS_CPP11
+  // Each thread has a free list per pool.  The pool's id picks the entry, and
+  // an entry left by a pool with another id, i.e. one that is gone or shares
+  // the entry, is emptied before it's reused.
+  const size_t thread_entries = 16;
+  const size_t thread_max_free = 64;
+
+  // The counts are only written by the entry's thread, so they don't share a
+  // cache line between threads, and are read by append_counts.
+  struct ThreadEntry {
+    size_t pool_id;
+    FreeElement* head;
+    FreeElement* tail;
+    size_t count;
+    Atomic<ACE_UINT64> allocations;
+    Atomic<ACE_UINT64> reuses;
+  };
+
+  void increment(Atomic<ACE_UINT64>& counter)
+  {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  // Plain data so that using it never needs an initialization check.
+  struct ThreadFreeLists {
+    ThreadEntry entries[thread_entries];
+    ThreadFreeLists* next;
+    ThreadFreeLists* prev;
+    bool registered;
+    bool exited;
+  };
+
+  thread_local ThreadFreeLists thread_free_lists;
+
+  struct PoolCounts {
+    PoolCounts() : allocations(0), reuses(0) {}
+    ACE_UINT64 allocations;
+    ACE_UINT64 reuses;
+  };
+
+  // The free lists of every thread, so their counts can be summed, and the
+  // counts of entries that were emptied since.  An entry's pool_id and counts
+  // only change under the mutex.
+  struct ThreadRegistry {
+    ThreadRegistry() : head(0) {}
+    ACE_Thread_Mutex mutex;
+    ThreadFreeLists* head;
+    OPENDDS_MAP(size_t, PoolCounts) retired;
+  };
+
+  // Leaked so that threads exiting during static destruction still have it.
+  ThreadRegistry& thread_registry()
+  {
+    static ThreadRegistry* const instance = new ThreadRegistry;
+    return *instance;
+  }
+
+  // Called with the registry's mutex held.
+  void retire_entry(ThreadRegistry& registry, ThreadEntry& entry, size_t pool_id)
+  {
+    heap_free_list(entry.head);
+    const ACE_UINT64 allocations = entry.allocations.load(std::memory_order_relaxed);
+    const ACE_UINT64 reuses = entry.reuses.load(std::memory_order_relaxed);
+    if (entry.pool_id && (allocations || reuses)) {
+      PoolCounts& retired = registry.retired[entry.pool_id];
+      retired.allocations += allocations;
+      retired.reuses += reuses;
+    }
+    entry.pool_id = pool_id;
+    entry.head = entry.tail = 0;
+    entry.count = 0;
+    entry.allocations.store(0, std::memory_order_relaxed);
+    entry.reuses.store(0, std::memory_order_relaxed);
+  }
+
+  struct ThreadFreeListsCleanup {
+    ~ThreadFreeListsCleanup()
+    {
+      ThreadFreeLists& lists = thread_free_lists;
+      ThreadRegistry& registry = thread_registry();
+      ACE_Guard<ACE_Thread_Mutex> guard(registry.mutex);
+      for (size_t i = 0; i < thread_entries; ++i) {
+        retire_entry(registry, lists.entries[i], 0);
+      }
+      if (lists.prev) {
+        lists.prev->next = lists.next;
+      } else {
+        registry.head = lists.next;
+      }
+      if (lists.next) {
+        lists.next->prev = lists.prev;
+      }
+      lists.exited = true;
+    }
+  };
+
+  // Returns null once the thread's thread_local objects are destroyed.
+  ThreadEntry* thread_entry(size_t pool_id)
+  {
+    ThreadFreeLists& lists = thread_free_lists;
+    if (lists.exited) {
+      return 0;
+    }
+    if (!lists.registered) {
+      static thread_local ThreadFreeListsCleanup cleanup;
+      ACE_UNUSED_ARG(cleanup);
+      ThreadRegistry& registry = thread_registry();
+      ACE_Guard<ACE_Thread_Mutex> guard(registry.mutex);
+      lists.next = registry.head;
+      if (lists.next) {
+        lists.next->prev = &lists;
+      }
+      registry.head = &lists;
+      lists.registered = true;
+    }
+    ThreadEntry& entry = lists.entries[pool_id % thread_entries];
+    if (entry.pool_id != pool_id) {
+      ThreadRegistry& registry = thread_registry();
+      ACE_Guard<ACE_Thread_Mutex> guard(registry.mutex);
+      retire_entry(registry, entry, pool_id);
+    }
+    return &entry;
+  }
+
+  PoolCounts thread_counts(size_t pool_id)
+  {
+    ThreadRegistry& registry = thread_registry();
+    ACE_Guard<ACE_Thread_Mutex> guard(registry.mutex);
+    PoolCounts counts;
+    const OPENDDS_MAP(size_t, PoolCounts)::const_iterator retired = registry.retired.find(pool_id);
+    if (retired != registry.retired.end()) {
+      counts = retired->second;
+    }
+    for (const ThreadFreeLists* lists = registry.head; lists; lists = lists->next) {
+      const ThreadEntry& entry = lists->entries[pool_id % thread_entries];
+      if (entry.pool_id == pool_id) {
+        counts.allocations += entry.allocations.load(std::memory_order_relaxed);
+        counts.reuses += entry.reuses.load(std::memory_order_relaxed);
+      }
+    }
+    return counts;
+  }
+
+  Atomic<size_t> next_pool_id(1);
+#endif
+}
+
+TransportQueueElementPool::TransportQueueElementPool(const char* name, size_t element_size, size_t max_free)
+  : name_(name)
+  , element_size_(element_size)
+  , max_free_(max_free)
+  , allocations_(0)
+  , reuses_(0)
+  , next_pool_(0)
+#ifdef ACE_HAS_CPP11
+  , id_(next_pool_id++)
+  , shared_(0)
+  , shared_count_(0)
+#else
+  , free_(0)
+  , free_count_(0)
+#endif
+{
+  ACE_Guard<ACE_Thread_Mutex> guard(pools_mutex());
+  next_pool_ = pools();
+  pools() = this;
+}
+
+TransportQueueElementPool::~TransportQueueElementPool()
+{
+  {
+    ACE_Guard<ACE_Thread_Mutex> guard(pools_mutex());
+    for (TransportQueueElementPool** pos = &pools(); *pos; pos = &(*pos)->next_pool_) {
+      if (*pos == this) {
+        *pos = next_pool_;
+        break;
+      }
+    }
+  }
+
+#ifdef ACE_HAS_CPP11
+  // The lists of other threads are freed when they exit or when another pool
+  // takes their entry.
+  {
+    ThreadRegistry& registry = thread_registry();
+    ACE_Guard<ACE_Thread_Mutex> guard(registry.mutex);
+    if (!thread_free_lists.exited) {
+      ThreadEntry& entry = thread_free_lists.entries[id_ % thread_entries];
+      if (entry.pool_id == id_) {
+        retire_entry(registry, entry, 0);
+      }
+    }
+    registry.retired.erase(id_);
+  }
+  heap_free_list(shared_.exchange(0));
+#else
+  heap_free_list(free_);
+#endif
+}
+
+ACE_Thread_Mutex&
+TransportQueueElementPool::pools_mutex()
+{
+  static ACE_Thread_Mutex mutex;
+  return mutex;
+}
+
+TransportQueueElementPool*&
+TransportQueueElementPool::pools()
+{
+  static TransportQueueElementPool* head = 0;
+  return head;
+}
+
+ACE_UINT64
+TransportQueueElementPool::allocations() const
+{
+#ifdef ACE_HAS_CPP11
+  return allocations_ + thread_counts(id_).allocations;
+#else
+  return allocations_;
+#endif
+}
+
+ACE_UINT64
+TransportQueueElementPool::reuses() const
+{
+#ifdef ACE_HAS_CPP11
+  return reuses_ + thread_counts(id_).reuses;
+#else
+  return reuses_;
+#endif
+}
+
+void
+TransportQueueElementPool::append_counts(QueueElementCountSequence& seq)
+{
+  ACE_Guard<ACE_Thread_Mutex> guard(pools_mutex());
+  for (const TransportQueueElementPool* pool = pools(); pool; pool = pool->next_pool_) {
+    QueueElementCount qec;
+    qec.element = pool->name_;
+    qec.allocations = pool->allocations();
+    qec.reuses = pool->reuses();
+    push_back(seq, qec);
+  }
+}
+
+#ifdef ACE_HAS_CPP11
+TransportQueueElementPool::FreeElement*
+TransportQueueElementPool::take_shared()
+{
+  if (!shared_.load(std::memory_order_relaxed)) {
+    return 0;
+  }
+  return shared_.exchange(0, std::memory_order_acquire);
+}
+
+bool
+TransportQueueElementPool::give_shared(FreeElement* head, FreeElement* tail, size_t count)
+{
+  if (shared_count_.fetch_add(count, std::memory_order_relaxed) + count > max_free_) {
+    shared_count_.fetch_sub(count, std::memory_order_relaxed);
+    return false;
+  }
+  FreeElement* old_head = shared_.load(std::memory_order_relaxed);
+  do {
+    tail->next = old_head;
+  } while (!shared_.compare_exchange_weak(old_head, head,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed));
+  return true;
+}
+#endif
+
+void*
+TransportQueueElementPool::allocate(size_t size)
+{
+  if (size == element_size_) {
+#ifdef ACE_HAS_CPP11
+    ThreadEntry* const entry = thread_entry(id_);
+    if (entry) {
+      if (!entry->head) {
+        // Take everything in the shared list so the next allocations by this
+        // thread don't touch it.
+        entry->head = take_shared();
+        if (entry->head) {
+          entry->count = 1;
+          for (entry->tail = entry->head; entry->tail->next; entry->tail = entry->tail->next) {
+            ++entry->count;
+          }
+          shared_count_.fetch_sub(entry->count, std::memory_order_relaxed);
+        }
+      }
+      if (entry->head) {
+        FreeElement* const element = entry->head;
+        entry->head = element->next;
+        if (!entry->head) {
+          entry->tail = 0;
+        }
+        --entry->count;
+        increment(entry->reuses);
+        return element;
+      }
+      increment(entry->allocations);
+      return heap_allocate(size);
+    }
+#else
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+    if (free_) {
+      FreeElement* const element = free_;
+      free_ = element->next;
+      --free_count_;
+      ++reuses_;
+      return element;
+    }
+#endif
+  }
+
+  ++allocations_;
+  return heap_allocate(size);
+}
+
+void
+TransportQueueElementPool::deallocate(void* ptr, size_t size)
+{
+  if (!ptr) {
+    return;
+  }
+
+  if (size == element_size_) {
+#ifdef ACE_HAS_CPP11
+    ThreadEntry* const entry = max_free_ ? thread_entry(id_) : 0;
+    if (entry) {
+      // A full list goes to the shared one in a single step, which is how
+      // elements released by the transport get back to the writing thread.
+      if (entry->count >= std::min(thread_max_free, max_free_)) {
+        if (!give_shared(entry->head, entry->tail, entry->count)) {
+          heap_free(ptr);
+          return;
+        }
+        entry->head = entry->tail = 0;
+        entry->count = 0;
+      }
+      FreeElement* const element = static_cast<FreeElement*>(ptr);
+      element->next = entry->head;
+      entry->head = element;
+      if (!entry->tail) {
+        entry->tail = element;
+      }
+      ++entry->count;
+      return;
+    }
+#else
+    ACE_Guard<ACE_Thread_Mutex> guard(mutex_);
+    if (free_count_ < max_free_) {
+      FreeElement* const element = static_cast<FreeElement*>(ptr);
+      element->next = free_;
+      free_ = element;
+      ++free_count_;
+      return;
+    }
+#endif
+  }
+
+  heap_free(ptr);
+}
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,102 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_TRANSPORT_FRAMEWORK_TRANSPORTQUEUEELEMENTPOOL_H
+#define OPENDDS_DCPS_TRANSPORT_FRAMEWORK_TRANSPORTQUEUEELEMENTPOOL_H
+
+#include "dds/DCPS/dcps_export.h"
+#include "dds/DCPS/Atomic.h"
+#include "dds/Versioned_Namespace.h"
+
+#include <dds/OpenddsDcpsExtC.h>
+
+#include <ace/Thread_Mutex.h>
+
+#include <cstddef>
+
+#ifndef ACE_LACKS_PRAGMA_ONCE
+#  pragma once
+#endif
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/**
+ * @class TransportQueueElementPool
+ *
+ * @brief Free lists for the memory of one TransportQueueElement class.
+ *
+ * Some elements are created and released for every sample sent, so the
+ * memory of a released element is kept for the next one instead of going
+ * back to the allocator.  Each thread keeps a short free list that only it
+ * uses.  Once that is full, the thread hands the whole list to a shared one
+ * holding up to max_free elements, and a thread whose own list is empty
+ * takes everything in the shared list at once.  Neither step takes a lock,
+ * which matters because elements are usually created by the writing thread
+ * and released by a transport thread.  Without C++11 there are no
+ * per-thread lists and the shared list is guarded by a mutex.  Allocations
+ * of any other size, i.e. of classes derived from the pooled one, aren't
+ * pooled.  The counts of pooled allocations are also kept per thread and
+ * are summed when they're read.
+ */
+class OpenDDS_Dcps_Export TransportQueueElementPool {
+public:
+  TransportQueueElementPool(const char* name, size_t element_size, size_t max_free = 1024);
+  ~TransportQueueElementPool();
+
+  void* allocate(size_t size);
+  void deallocate(void* ptr, size_t size);
+
+  /// Number of elements allocated from the allocator.
+  ACE_UINT64 allocations() const;
+  /// Number of elements allocated from a free list.
+  ACE_UINT64 reuses() const;
+
+  /// Append the counts of every pool in the process.
+  static void append_counts(QueueElementCountSequence& seq);
+
+  /// What a free element's memory is used for while it's on a free list.
+  struct FreeElement {
+    FreeElement* next;
+  };
+
+private:
+  TransportQueueElementPool(const TransportQueueElementPool&);
+  TransportQueueElementPool& operator=(const TransportQueueElementPool&);
+
+  static ACE_Thread_Mutex& pools_mutex();
+  static TransportQueueElementPool*& pools();
+
+  const char* const name_;
+  const size_t element_size_;
+  const size_t max_free_;
+  /// With C++11 these only count what isn't counted in the thread's entry.
+  Atomic<ACE_UINT64> allocations_;
+  Atomic<ACE_UINT64> reuses_;
+  TransportQueueElementPool* next_pool_;
+
+#ifdef ACE_HAS_CPP11
+  FreeElement* take_shared();
+  bool give_shared(FreeElement* head, FreeElement* tail, size_t count);
+
+  /// Identifies this pool's entry in each thread's free lists.
+  const size_t id_;
+  Atomic<FreeElement*> shared_;
+  Atomic<size_t> shared_count_;
+#else
+  ACE_Thread_Mutex mutex_;
+  FreeElement* free_;
+  size_t free_count_;
+#endif
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif /* OPENDDS_DCPS_TRANSPORT_FRAMEWORK_TRANSPORTQUEUEELEMENTPOOL_H */
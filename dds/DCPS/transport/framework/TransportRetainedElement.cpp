@@ -7,6 +7,7 @@
 
 #include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
 #include "TransportRetainedElement.h"
+#include "TransportQueueElementPool.h"
 
 #if !defined (__ACE_INLINE__)
 #include "TransportRetainedElement.inl"
@@ -14,11 +15,33 @@
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace {
+  // Leaked so that elements released during static destruction still have it.
+  OpenDDS::DCPS::TransportQueueElementPool& pool()
+  {
+    static OpenDDS::DCPS::TransportQueueElementPool* const instance =
+      new OpenDDS::DCPS::TransportQueueElementPool("TransportRetainedElement", sizeof(OpenDDS::DCPS::TransportRetainedElement));
+    return *instance;
+  }
+}
+
 OpenDDS::DCPS::TransportRetainedElement::~TransportRetainedElement()
 {
   DBG_ENTRY_LVL("TransportRetainedElement", "~TransportRetainedElement", 6);
 }
 
+void*
+OpenDDS::DCPS::TransportRetainedElement::operator new(size_t size)
+{
+  return pool().allocate(size);
+}
+
+void
+OpenDDS::DCPS::TransportRetainedElement::operator delete(void* ptr, size_t size)
+{
+  pool().deallocate(ptr, size);
+}
+
 void
 OpenDDS::DCPS::TransportRetainedElement::release_element(
   bool /* dropped_by_transport */
@@ -43,6 +43,10 @@ public:
 
   virtual ~TransportRetainedElement();
 
+  /// Elements are pooled since one is created for each sample retained.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   ///{ @name TransportQueueElement methods
 
   virtual GUID_t publication_id() const;
@@ -9,6 +9,7 @@
 
 #include "TransportSendControlElement.h"
 #include "TransportSendListener.h"
+#include "TransportQueueElementPool.h"
 #include "EntryExit.h"
 
 #include <dds/DCPS/DataSampleElement.h>
@@ -22,6 +23,15 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
+namespace {
+  // Leaked so that elements released during static destruction still have it.
+  TransportQueueElementPool& pool()
+  {
+    static TransportQueueElementPool* const instance =
+      new TransportQueueElementPool("TransportSendControlElement", sizeof(TransportSendControlElement));
+    return *instance;
+  }
+}
 
 TransportSendControlElement::TransportSendControlElement(int initial_count,
                                                          const GUID_t& publisher_id,
@@ -55,6 +65,18 @@ TransportSendControlElement::~TransportSendControlElement()
   DBG_ENTRY_LVL("TransportSendControlElement", "~TransportSendControlElement", 6);
 }
 
+void*
+TransportSendControlElement::operator new(size_t size)
+{
+  return pool().allocate(size);
+}
+
+void
+TransportSendControlElement::operator delete(void* ptr, size_t size)
+{
+  pool().deallocate(ptr, size);
+}
+
 bool
 TransportSendControlElement::requires_exclusive_packet() const
 {
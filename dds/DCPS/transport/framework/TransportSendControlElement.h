@@ -25,12 +25,8 @@ namespace OpenDDS {
 namespace DCPS {
 
 class TransportSendListener;
-class TransportSendControlElement;
 class DataSampleElement;
 
-typedef Cached_Allocator_With_Overflow<TransportSendControlElement, ACE_SYNCH_NULL_MUTEX>
-TransportSendControlElementAllocator;
-
 class OpenDDS_Dcps_Export TransportSendControlElement : public TransportQueueElement {
 public:
 
@@ -45,6 +41,10 @@ public:
 
   virtual ~TransportSendControlElement();
 
+  /// Elements are pooled since one is created for each control message sent.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   /// Overridden to always return true for Send Control elements.
   virtual bool requires_exclusive_packet() const;
 
@@ -8,6 +8,7 @@
 #include "DCPS/DdsDcps_pch.h" //Only the _pch include should start with DCPS/
 #include "TransportSendElement.h"
 #include "TransportSendListener.h"
+#include "TransportQueueElementPool.h"
 
 #if !defined (__ACE_INLINE__)
 #include "TransportSendElement.inl"
@@ -15,11 +16,33 @@
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace {
+  // Leaked so that elements released during static destruction still have it.
+  OpenDDS::DCPS::TransportQueueElementPool& pool()
+  {
+    static OpenDDS::DCPS::TransportQueueElementPool* const instance =
+      new OpenDDS::DCPS::TransportQueueElementPool("TransportSendElement", sizeof(OpenDDS::DCPS::TransportSendElement));
+    return *instance;
+  }
+}
+
 OpenDDS::DCPS::TransportSendElement::~TransportSendElement()
 {
   DBG_ENTRY_LVL("TransportSendElement", "~TransportSendElement", 6);
 }
 
+void*
+OpenDDS::DCPS::TransportSendElement::operator new(size_t size)
+{
+  return pool().allocate(size);
+}
+
+void
+OpenDDS::DCPS::TransportSendElement::operator delete(void* ptr, size_t size)
+{
+  pool().deallocate(ptr, size);
+}
+
 void
 OpenDDS::DCPS::TransportSendElement::release_element(bool dropped_by_transport)
 {
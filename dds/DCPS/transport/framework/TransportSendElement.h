@@ -25,6 +25,10 @@ public:
 
   virtual ~TransportSendElement();
 
+  /// Elements are pooled since one is created for each sample sent.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
   /// Accessor for the publisher id.
   virtual GUID_t publication_id() const;
 
@@ -93,6 +93,16 @@ TransportSendStrategy::TransportSendStrategy(
     max_samples_ = cfg->max_samples_per_packet();
     optimum_size_ = cfg->optimum_packet_size();
     max_size_ = cfg->max_packet_size();
+
+    const ACE_UINT32 window = cfg->coalesce_window();
+    if (window) {
+      const ACE_UINT32 bytes = cfg->coalesce_bytes();
+      coalescer_.reset(new PacketCoalescer(TimeDuration(window / 1000000, window % 1000000),
+                                           (bytes && bytes < optimum_size_) ? bytes : optimum_size_,
+                                           transport->coalesce_statistics()));
+      coalesce_event_ = make_rch<SporadicEvent>(transport->event_dispatcher(),
+        make_rch<PmfEvent<TransportSendStrategy> >(rchandle_from(this), &TransportSendStrategy::coalesce_flush));
+    }
   }
 
   // Create a ThreadSynch object just for us.
@@ -117,6 +127,9 @@ TransportSendStrategy::~TransportSendStrategy()
 {
   DBG_ENTRY_LVL("TransportSendStrategy","~TransportSendStrategy",6);
 
+  if (coalesce_event_) {
+    coalesce_event_->cancel();
+  }
 
   delayed_delivered_notification_queue_.clear();
 }
@@ -815,6 +828,9 @@ TransportSendStrategy::clear(SendMode new_mode, SendMode old_mode)
     pkt_chain_ = 0;
     header_complete_ = false;
     start_counter_ = 0;
+    if (coalescer_) {
+      coalescer_->reset();
+    }
     mode_ = new_mode;
     mode_before_suspend_ = MODE_NOT_SET;
   }
@@ -881,6 +897,12 @@ TransportSendStrategy::stop()
 {
   DBG_ENTRY_LVL("TransportSendStrategy","stop",6);
 
+  if (coalesce_event_) {
+    coalesce_event_->cancel();
+    // Send anything still held back by the coalesce window.
+    coalesce_flush();
+  }
+
   if (header_block_ != 0) {
     header_block_->release ();
     header_block_ = 0;
@@ -1067,6 +1089,7 @@ TransportSendStrategy::send(TransportQueueElement* element, bool relink)
         // The invocation's relink status should dictate the direct_send's
         // do_relink. We don't want a (relink == false) invocation to end up
         // doing a relink. Think of (relink == false) as a non-blocking call.
+        end_coalesce_i(false);
         direct_send(relink);
 
         // Now check to see if we flipped into MODE_QUEUE, which would mean
@@ -1165,13 +1188,16 @@ TransportSendStrategy::send(TransportQueueElement* element, bool relink)
         // - The current packet's total length exceeds the optimum packet size.
         // - The current element (currently part of the packet elems_)
         //   requires an exclusive packet.
+        // - The packet was held back and has reached the coalesce size.
         //
         if (next_fragment || (elems_.size() >= max_samples_)
             || (max_header_size_ + message_length > optimum_size_)
+            || (coalescer_ && coalescer_->full(max_header_size_ + message_length))
             || exclusive) {
           VDBG((LM_DEBUG, "(%P|%t) DBG:   "
                 "Now the current packet looks full - send it (directly).\n"));
 
+          end_coalesce_i(false);
           direct_send(relink);
 
           if (next_fragment && mode_ != MODE_DIRECT) {
@@ -1288,10 +1314,12 @@ TransportSendStrategy::send_stop(GUID_t /*repoId*/)
           "header_.length_ == [%d].\n", header_length));
 
     // Only attempt to send the current packet (directly) if the current
-    // packet actually contains something (it could be empty).
+    // packet actually contains something (it could be empty) and it isn't
+    // being held back for the coalesce window.
     if ((header_length > 0) &&
         //(elems_.size ()+not_yet_pac_q_->size() > 0))
-        (elems_.size() > 0)) {
+        (elems_.size() > 0) &&
+        !coalesce_i()) {
       VDBG((LM_DEBUG, "(%P|%t) DBG:   "
             "There is something in the current packet - attempt to send "
             "it (directly) now.\n"));
@@ -1315,6 +1343,74 @@ TransportSendStrategy::send_stop(GUID_t /*repoId*/)
   send_delayed_notifications();
 }
 
+bool
+TransportSendStrategy::coalesce_i()
+{
+  if (!coalescer_) {
+    return false;
+  }
+
+  TimeDuration remaining;
+  if (!coalescer_->hold(MonotonicTimePoint::now(), max_header_size_ + header_.length_,
+                        elems_.size(), remaining)) {
+    return false;
+  }
+
+  coalesce_event_->schedule(remaining);
+  return true;
+}
+
+void
+TransportSendStrategy::end_coalesce_i(bool window_expired)
+{
+  if (coalescer_) {
+    coalescer_->release(MonotonicTimePoint::now(), elems_.size(), window_expired);
+  }
+}
+
+bool
+TransportSendStrategy::send_held_packet_i()
+{
+  if (!coalescer_ || !coalescer_->holding()) {
+    return false;
+  }
+
+  if (mode_ != MODE_DIRECT || header_.length_ == 0 || elems_.size() == 0) {
+    coalescer_->reset();
+    return false;
+  }
+
+  end_coalesce_i(true);
+  direct_send(false);
+  return true;
+}
+
+void
+TransportSendStrategy::coalesce_flush()
+{
+  {
+    GuardType guard(lock_);
+
+    // A send in progress will either send the packet or hold it again
+    // from its send_stop().  A suspended link sends it from resume_send().
+    if (!coalescer_ || !coalescer_->holding() || link_released_ || start_counter_ != 0
+        || mode_ != MODE_DIRECT) {
+      return;
+    }
+
+    end_coalesce_i(true);
+
+    if (header_.length_ > 0 && elems_.size() > 0) {
+      direct_send(true);
+      if (mode_ == MODE_QUEUE) {
+        synch_->work_available();
+      }
+    }
+  }
+
+  send_delayed_notifications();
+}
+
 void
 TransportSendStrategy::remove_all_msgs(const GUID_t& pub_id)
 {
@@ -9,6 +9,7 @@
 #define OPENDDS_DCPS_TRANSPORT_FRAMEWORK_TRANSPORTSENDSTRATEGY_H
 
 #include "BasicQueue_T.h"
+#include "PacketCoalescer.h"
 #include "ThreadSynchStrategy_rch.h"
 #include "ThreadSynchWorker.h"
 #include "TransportDefs.h"
@@ -23,6 +24,8 @@
 #include <dds/DCPS/Dynamic_Cached_Allocator_With_Overflow_T.h>
 #include <dds/DCPS/PoolAllocator.h>
 #include <dds/DCPS/RcObject.h>
+#include <dds/DCPS/SporadicEvent.h>
+#include <dds/DCPS/TimeTypes.h>
 #include <dds/DCPS/dcps_export.h>
 
 #if OPENDDS_CONFIG_SECURITY
@@ -239,6 +242,21 @@ private:
   /// the send.
   void direct_send(bool relink);
 
+  /// Called from send_stop() in MODE_DIRECT.  Returns true if the current
+  /// packet should be held back for the rest of the coalesce window.
+  bool coalesce_i();
+
+  /// Account for a held back packet that is about to be sent.
+  void end_coalesce_i(bool window_expired);
+
+  /// Send a held back packet once the coalesce window expires.
+  void coalesce_flush();
+
+  /// Send the packet held back by the coalesce window, if any, when leaving
+  /// MODE_SUSPEND.  It was never sent, unlike the rest of the current packet
+  /// that resume_send() drops.  Returns false if nothing was held.
+  bool send_held_packet_i();
+
   /// This method is used while in MODE_QUEUE mode, and a new packet
   /// needs to be formulated using elements from the queue_.  This is
   /// the first step of formulating the new packet.  It will extract
@@ -437,6 +455,10 @@ private:
 
   TransportSendBuffer* send_buffer_;
 
+  /// Coalescing of MODE_DIRECT packets, null when coalesce_window is 0.
+  unique_ptr<PacketCoalescer> coalescer_;
+  RcHandle<SporadicEvent> coalesce_event_;
+
   // N.B. The behavior present in TransortSendBuffer should be
   // refactored into the TransportSendStrategy eventually; a good
   // amount of private state is shared between both classes.
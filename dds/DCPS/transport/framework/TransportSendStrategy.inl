@@ -92,13 +92,15 @@ void TransportSendStrategy::resume_send()
     this->delayed_delivered_notification_queue_.clear();
 
   } else if (this->mode_ == MODE_SUSPEND) {
-    this->header_.length_ = 0;
-    this->pkt_chain_ = 0;
-    QueueType elems;
-    elems.swap(this->elems_);
     this->mode_ = this->mode_before_suspend_;
-    this->header_complete_ = false;
     this->mode_before_suspend_ = MODE_NOT_SET;
+    if (!this->send_held_packet_i()) {
+      this->header_.length_ = 0;
+      this->pkt_chain_ = 0;
+      QueueType elems;
+      elems.swap(this->elems_);
+      this->header_complete_ = false;
+    }
     if (this->queue_.size() > 0) {
       this->mode_ = MODE_QUEUE;
       this->synch_->work_available();
@@ -10,6 +10,7 @@
 
 #include "dds/DCPS/NetworkAddress.h"
 #include "dds/DCPS/NetworkResource.h"
+#include "dds/DCPS/transport/framework/TransportQueueElementPool.h"
 #include "dds/DCPS/ConfigStoreImpl.h"
 #include "dds/DCPS/Util.h"
 
@@ -144,6 +145,11 @@ inline void append(TransportStatisticsSequence& seq, const InternalTransportStat
     const GuidCount gc = { pos->first, pos->second };
     push_back(stats.reader_nack_count, gc);
   }
+  const CoalesceCount no_coalesce = {0, 0, 0, 0, 0};
+  stats.coalesce = no_coalesce;
+  const MulticastFecCount no_fec = {0, 0, 0, 0, 0};
+  stats.fec = no_fec;
+  TransportQueueElementPool::append_counts(stats.queue_element_count);
 }
 
 } // namespace DCPS
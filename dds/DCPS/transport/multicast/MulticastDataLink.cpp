@@ -13,6 +13,7 @@
 #include "MulticastReceiveStrategy.h"
 
 #include <dds/DCPS/Service_Participant.h>
+#include <dds/DCPS/transport/framework/TransportHeader.h>
 #include <dds/DCPS/NetworkResource.h>
 #include <dds/DCPS/GuidConverter.h>
 #include <dds/DCPS/RepoIdConverter.h>
@@ -49,7 +50,8 @@ MulticastDataLink::MulticastDataLink(const MulticastTransport_rch& transport,
   local_peer_(local_peer),
   reactor_task_(reactor_task),
   send_strategy_(make_rch<MulticastSendStrategy>(this)),
-  recv_strategy_(make_rch<MulticastReceiveStrategy>(this))
+  recv_strategy_(make_rch<MulticastReceiveStrategy>(this)),
+  fec_enabled_(false)
 {
   // A send buffer may be bound to the send strategy to ensure a
   // configured number of most-recent datagrams are retained:
@@ -59,11 +61,27 @@ MulticastDataLink::MulticastDataLink(const MulticastTransport_rch& transport,
     const size_t max_samples_per_packet = config ? config->max_samples_per_packet() : default_max_samples;
     send_buffer_.reset(new SingleSendBuffer(nak_depth, max_samples_per_packet));
     send_strategy_->send_buffer(send_buffer_.get());
+
+    const size_t fec_window = config ? config->fec_window() : MulticastInst::DEFAULT_FEC_WINDOW;
+    fec_enabled_ = fec_window > 0;
+    if (fec_enabled_ && is_active && reactor_task) {
+      fec_encoder_.reset(new MulticastFecEncoder(fec_window, config->fec_parity()));
+      // Parity for a partial window goes out well before subscribers
+      // would start NAK'ing the gaps it is able to repair.
+      fec_flush_delay_ = config->nak_interval() / 2.0;
+      fec_task_ = make_rch<Sporadic>(TheServiceParticipant->time_source(),
+                                     reactor_task->interceptor(),
+                                     rchandle_from(this),
+                                     &MulticastDataLink::send_fec_parity);
+    }
   }
 }
 
 MulticastDataLink::~MulticastDataLink()
 {
+  if (fec_task_) {
+    fec_task_->cancel();
+  }
   if (send_buffer_) {
     send_strategy_->send_buffer(0);
   }
@@ -441,9 +459,111 @@ MulticastDataLink::syn_received_no_session(MulticastPeer source,
   }
 }
 
+void
+MulticastDataLink::fec_datagram_sent(const iovec iov[], int n)
+{
+  if (!fec_encoder_) {
+    return;
+  }
+
+  bool first = false;
+  bool complete = false;
+  {
+    ACE_GUARD(ACE_Thread_Mutex, guard, fec_lock_);
+    if (!fec_encoder_->add(iov, n)) {
+      return;
+    }
+    first = fec_encoder_->pending() == 1;
+    complete = fec_encoder_->window_complete();
+  }
+
+  // Parity is sent from the reactor since this is called while the send
+  // strategy is in the middle of sending.
+  if (complete) {
+    fec_task_->schedule(TimeDuration::zero_value);
+  } else if (first) {
+    fec_task_->schedule(fec_flush_delay_);
+  }
+}
+
+void
+MulticastDataLink::send_fec_parity(const MonotonicTimePoint& /*now*/)
+{
+  MulticastFecWindow window;
+  {
+    ACE_GUARD(ACE_Thread_Mutex, guard, fec_lock_);
+    if (!fec_encoder_ || fec_encoder_->pending() == 0) {
+      return;
+    }
+    fec_encoder_->take_window(window);
+  }
+
+  for (size_t i = 0; i < window.groups.size(); ++i) {
+    Message_Block_Ptr payload;
+    if (!window.parity(i, payload)) {
+      continue;
+    }
+
+    DataSampleHeader header;
+    Message_Block_Ptr control(create_control(MULTICAST_FEC, header, move(payload)));
+    if (!control) {
+      ACE_ERROR((LM_ERROR,
+                 ACE_TEXT("(%P|%t) ERROR: ")
+                 ACE_TEXT("MulticastDataLink::send_fec_parity: ")
+                 ACE_TEXT("create_control failed!\n")));
+      return;
+    }
+
+    const int error = send_control(header, move(control));
+    if (error != SEND_CONTROL_OK) {
+      ACE_ERROR((LM_ERROR,
+                 ACE_TEXT("(%P|%t) ERROR: ")
+                 ACE_TEXT("MulticastDataLink::send_fec_parity: ")
+                 ACE_TEXT("send_control failed: %d!\n"),
+                 error));
+      return;
+    }
+    ++fec_statistics_.parity_sent;
+  }
+}
+
+void
+MulticastDataLink::fec_datagram_received(const char* data, size_t length)
+{
+  if (!fec_enabled_ || is_active()) {
+    return;
+  }
+
+  ACE_Message_Block mb(data, length);
+  mb.wr_ptr(length);
+  TransportHeader header;
+  if (!header.init(&mb) || !header.valid()) {
+    return;
+  }
+
+  MulticastSession_rch session = find_session(header.source_);
+  if (session) {
+    session->datagram_received(header.sequence_, data, length);
+  }
+}
+
 void
 MulticastDataLink::stop_i()
 {
+  if (fec_task_) {
+    fec_task_->cancel();
+  }
+
+  if (fec_enabled_) {
+    VDBG_LVL((LM_DEBUG, "(%P|%t) MulticastDataLink::stop_i: FEC parity sent %B "
+              "received %B recovered %B unrecoverable %B naked %B\n",
+              static_cast<size_t>(fec_statistics_.parity_sent),
+              static_cast<size_t>(fec_statistics_.parity_received),
+              static_cast<size_t>(fec_statistics_.recovered),
+              static_cast<size_t>(fec_statistics_.unrecoverable),
+              static_cast<size_t>(fec_statistics_.naked)), 2);
+  }
+
   ACE_GUARD(ACE_SYNCH_RECURSIVE_MUTEX,
       guard,
       this->session_lock_);
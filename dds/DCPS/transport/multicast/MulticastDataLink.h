@@ -16,11 +16,13 @@
 #include "MulticastSession_rch.h"
 #include "MulticastSessionFactory_rch.h"
 #include "MulticastTypes.h"
+#include "MulticastFec.h"
 
 #include <dds/DCPS/DisjointSequence.h>
 #include <dds/DCPS/PoolAllocator.h>
 #include <dds/DCPS/transport/framework/DataLink.h>
 #include <dds/DCPS/ReactorTask.h>
+#include <dds/DCPS/SporadicTask.h>
 #include <dds/DCPS/transport/framework/TransportSendBuffer.h>
 
 #include <ace/SOCK_Dgram_Mcast.h>
@@ -80,6 +82,17 @@ public:
 
   void client_stop(const GUID_t& localId);
 
+  /// Forward error correction is configured for this (reliable) link.
+  bool fec_enabled() const { return fec_enabled_; }
+
+  /// Called by the send strategy for every datagram written to the socket.
+  void fec_datagram_sent(const iovec iov[], int n);
+
+  /// Called by the receive strategy for every datagram read from the socket.
+  void fec_datagram_received(const char* data, size_t length);
+
+  MulticastFecStatistics& fec_statistics() { return fec_statistics_; }
+
 private:
 
   MulticastSessionFactory_rch session_factory_;
@@ -110,6 +123,15 @@ private:
   bool ready_to_deliver(const ReceivedDataSample& data);
 
   bool uses_end_historic_control_messages() const { return false; }
+
+  bool fec_enabled_;
+  MulticastFecStatistics fec_statistics_;
+  ACE_Thread_Mutex fec_lock_;
+  unique_ptr<MulticastFecEncoder> fec_encoder_;
+  TimeDuration fec_flush_delay_;
+  typedef PmfSporadicTask<MulticastDataLink> Sporadic;
+  RcHandle<Sporadic> fec_task_;
+  void send_fec_parity(const MonotonicTimePoint& now);
 };
 
 } // namespace DCPS
@@ -0,0 +1,227 @@
+/*
+ *
+ *
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include "MulticastFec.h"
+
+#include <dds/DCPS/DataSampleHeader.h>
+#include <dds/DCPS/transport/framework/TransportHeader.h>
+
+#include <ace/Truncate.h>
+
+#include <algorithm>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+namespace {
+  const Encoding encoding_unaligned_native(Encoding::KIND_UNALIGNED_CDR);
+
+  void xor_into(OPENDDS_VECTOR(char)& parity, const char* data, size_t length)
+  {
+    if (parity.size() < length) {
+      parity.resize(length, 0);
+    }
+    for (size_t i = 0; i < length; ++i) {
+      parity[i] ^= data[i];
+    }
+  }
+}
+
+void
+MulticastFecStatistics::take(MulticastFecCount& count)
+{
+  count.parity_sent += parity_sent.exchange(0);
+  count.parity_received += parity_received.exchange(0);
+  count.recovered += recovered.exchange(0);
+  count.unrecoverable += unrecoverable.exchange(0);
+  count.naked += naked.exchange(0);
+}
+
+MulticastFecEncoder::MulticastFecEncoder(size_t window, size_t parity_count)
+  : window_(std::max<size_t>(window, 1))
+  , count_(0)
+{
+  current_.groups.resize(std::max<size_t>(std::min(parity_count, window_), 1));
+}
+
+bool
+MulticastFecEncoder::add(const iovec iov[], int n)
+{
+  scratch_.clear();
+  for (int i = 0; i < n; ++i) {
+    const char* const base = static_cast<const char*>(iov[i].iov_base);
+    scratch_.insert(scratch_.end(), base, base + iov[i].iov_len);
+  }
+
+  if (scratch_.size() < TRANSPORT_HDR_SERIALIZED_SZ + 2) {
+    return false;
+  }
+
+  ACE_Message_Block mb(&scratch_[0], scratch_.size());
+  mb.wr_ptr(scratch_.size());
+  TransportHeader header;
+  if (!header.init(&mb) || !header.valid()) {
+    return false;
+  }
+
+  // Resends from the send buffer are already covered by an earlier window.
+  if (last_ != SequenceNumber() && header.sequence_ <= last_) {
+    return false;
+  }
+
+  // Parity is never computed over parity.
+  const char message_id = scratch_[TRANSPORT_HDR_SERIALIZED_SZ];
+  const char submessage_id = scratch_[TRANSPORT_HDR_SERIALIZED_SZ + 1];
+  if (message_id == TRANSPORT_CONTROL && submessage_id == MULTICAST_FEC) {
+    return false;
+  }
+
+  last_ = header.sequence_;
+
+  MulticastFecWindow::Group& group = current_.groups[count_ % current_.groups.size()];
+  group.sequences.push_back(header.sequence_);
+  group.lengths.push_back(ACE_Utils::truncate_cast<ACE_CDR::ULong>(scratch_.size()));
+  xor_into(group.parity, &scratch_[0], scratch_.size());
+  ++count_;
+  return true;
+}
+
+void
+MulticastFecEncoder::take_window(MulticastFecWindow& window)
+{
+  const size_t groups = current_.groups.size();
+  window.groups.swap(current_.groups);
+  current_.groups.clear();
+  current_.groups.resize(groups);
+  count_ = 0;
+}
+
+bool
+MulticastFecWindow::parity(size_t index, Message_Block_Ptr& payload) const
+{
+  if (index >= groups.size() || groups[index].sequences.empty()) {
+    return false;
+  }
+  const Group& group = groups[index];
+
+  const ACE_CDR::ULong count = ACE_Utils::truncate_cast<ACE_CDR::ULong>(group.sequences.size());
+  const ACE_CDR::ULong parity_length = ACE_Utils::truncate_cast<ACE_CDR::ULong>(group.parity.size());
+
+  const size_t len = sizeof(count)
+                   + count * (sizeof(SequenceNumber) + sizeof(ACE_CDR::ULong))
+                   + sizeof(parity_length)
+                   + parity_length;
+
+  payload.reset(new ACE_Message_Block(len));
+  Serializer serializer(payload.get(), encoding_unaligned_native);
+
+  serializer << count;
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    serializer << group.sequences[i];
+    serializer << group.lengths[i];
+  }
+  serializer << parity_length;
+  return serializer.write_octet_array(reinterpret_cast<const ACE_CDR::Octet*>(&group.parity[0]),
+                                      parity_length);
+}
+
+MulticastFecDecoder::MulticastFecDecoder(size_t depth)
+  : depth_(std::max<size_t>(depth, 1))
+  , high_(SequenceNumber::SEQUENCENUMBER_UNKNOWN())
+{
+}
+
+void
+MulticastFecDecoder::record(const SequenceNumber& seq, const char* data, size_t length)
+{
+  OPENDDS_VECTOR(char)& datagram = datagrams_[seq];
+  datagram.assign(data, data + length);
+
+  while (datagrams_.size() > depth_) {
+    datagrams_.erase(datagrams_.begin());
+  }
+}
+
+MulticastFecDecoder::Result
+MulticastFecDecoder::decode(Serializer& serializer,
+                            const DisjointSequence& received,
+                            SequenceNumber& seq,
+                            Message_Block_Ptr& datagram)
+{
+  ACE_CDR::ULong count = 0;
+  if (!(serializer >> count)) {
+    return FEC_INVALID;
+  }
+
+  OPENDDS_VECTOR(SequenceNumber) sequences(count);
+  OPENDDS_VECTOR(ACE_CDR::ULong) lengths(count);
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    if (!(serializer >> sequences[i]) || !(serializer >> lengths[i])) {
+      return FEC_INVALID;
+    }
+  }
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    if (sequences[i] > high_) {
+      high_ = sequences[i];
+    }
+  }
+
+  ACE_CDR::ULong parity_length = 0;
+  if (!(serializer >> parity_length)) {
+    return FEC_INVALID;
+  }
+  OPENDDS_VECTOR(char) parity(parity_length);
+  if (parity_length && !serializer.read_octet_array(reinterpret_cast<ACE_CDR::Octet*>(&parity[0]),
+                                                    parity_length)) {
+    return FEC_INVALID;
+  }
+
+  size_t missing = count;
+  size_t missing_count = 0;
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    if (!received.contains(sequences[i])) {
+      missing = i;
+      ++missing_count;
+    }
+  }
+
+  if (missing_count == 0) {
+    return FEC_COMPLETE;
+  }
+  if (missing_count > 1) {
+    return FEC_UNRECOVERABLE;
+  }
+
+  for (ACE_CDR::ULong i = 0; i < count; ++i) {
+    if (i == missing) {
+      continue;
+    }
+    const DatagramMap::const_iterator pos = datagrams_.find(sequences[i]);
+    if (pos == datagrams_.end() || pos->second.size() != lengths[i]) {
+      // Received but no longer retained; a NAK will have to repair it.
+      return FEC_UNRECOVERABLE;
+    }
+    xor_into(parity, pos->second.empty() ? 0 : &pos->second[0], pos->second.size());
+  }
+
+  const ACE_CDR::ULong length = lengths[missing];
+  if (length == 0 || length > parity.size()) {
+    return FEC_INVALID;
+  }
+
+  seq = sequences[missing];
+  datagram.reset(new ACE_Message_Block(length));
+  datagram->copy(&parity[0], length);
+  return FEC_RECOVERED;
+}
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
@@ -0,0 +1,143 @@
+/*
+ *
+ *
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_DCPS_TRANSPORT_MULTICAST_MULTICASTFEC_H
+#define OPENDDS_DCPS_TRANSPORT_MULTICAST_MULTICASTFEC_H
+
+#include "Multicast_Export.h"
+
+#include <dds/DCPS/Atomic.h>
+#include <dds/DCPS/DisjointSequence.h>
+#include <dds/DCPS/Message_Block_Ptr.h>
+#include <dds/DCPS/PoolAllocator.h>
+#include <dds/DCPS/SequenceNumber.h>
+#include <dds/DCPS/Serializer.h>
+
+#include <dds/OpenddsDcpsExtC.h>
+
+#include <ace/os_include/sys/os_uio.h>
+
+OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
+
+namespace OpenDDS {
+namespace DCPS {
+
+/// Counters for forward error correction and repair activity on a
+/// reliable MulticastDataLink.
+struct OpenDDS_Multicast_Export MulticastFecStatistics {
+  /// Parity datagrams sent (active side).
+  Atomic<size_t> parity_sent;
+  /// Parity datagrams received (passive side).
+  Atomic<size_t> parity_received;
+  /// Datagrams rebuilt locally from parity (passive side).
+  Atomic<size_t> recovered;
+  /// Parity groups with more than one datagram missing (passive side).
+  Atomic<size_t> unrecoverable;
+  /// Datagrams requested from the remote peer with MULTICAST_NAK.
+  Atomic<size_t> naked;
+
+  MulticastFecStatistics()
+    : parity_sent(0)
+    , parity_received(0)
+    , recovered(0)
+    , unrecoverable(0)
+    , naked(0)
+  {}
+
+  /// Add the counts to count and start counting from zero.
+  void take(MulticastFecCount& count);
+};
+
+/// XOR parity over one window of outgoing datagrams.
+struct OpenDDS_Multicast_Export MulticastFecWindow {
+  struct Group {
+    OPENDDS_VECTOR(SequenceNumber) sequences;
+    OPENDDS_VECTOR(ACE_CDR::ULong) lengths;
+    OPENDDS_VECTOR(char) parity;
+  };
+  OPENDDS_VECTOR(Group) groups;
+
+  /// Serialize the parity of group "index" into a MULTICAST_FEC payload.
+  /// Returns false if no datagram was assigned to the group.
+  bool parity(size_t index, Message_Block_Ptr& payload) const;
+};
+
+/// Builds XOR parity over consecutive outgoing datagrams.
+///
+/// Every datagram added is assigned to one of parity_count interleaved
+/// groups (round robin).  When window datagrams have been added, or when
+/// the caller flushes early, one MULTICAST_FEC payload is produced per
+/// non-empty group.  A receiver missing at most one datagram of a group
+/// can rebuild it from the others and the parity, so a burst of up to
+/// parity_count consecutive losses within a window is recoverable without
+/// a NAK.
+class OpenDDS_Multicast_Export MulticastFecEncoder {
+public:
+  MulticastFecEncoder(size_t window, size_t parity_count);
+
+  /// Account for a datagram that was just sent.  Resends (sequence
+  /// numbers at or below the last one added) and MULTICAST_FEC datagrams
+  /// are ignored.  Returns true if the datagram was added.
+  bool add(const iovec iov[], int n);
+
+  /// Number of datagrams added to the current window.
+  size_t pending() const { return count_; }
+
+  bool window_complete() const { return count_ >= window_; }
+
+  /// Hand the current window to the caller, who serializes its parity
+  /// without holding any lock that add() needs, and start a new window.
+  void take_window(MulticastFecWindow& window);
+
+private:
+  const size_t window_;
+  MulticastFecWindow current_;
+  size_t count_;
+  SequenceNumber last_;
+  OPENDDS_VECTOR(char) scratch_;
+};
+
+/// Retains recently received datagrams from one remote peer and rebuilds
+/// missing ones from MULTICAST_FEC payloads.
+class OpenDDS_Multicast_Export MulticastFecDecoder {
+public:
+  enum Result {
+    FEC_COMPLETE,      ///< Nothing in the group was missing.
+    FEC_RECOVERED,     ///< Exactly one datagram was rebuilt.
+    FEC_UNRECOVERABLE, ///< Too much of the group is missing.
+    FEC_INVALID        ///< The payload could not be decoded.
+  };
+
+  explicit MulticastFecDecoder(size_t depth);
+
+  /// Retain a copy of a received datagram.
+  void record(const SequenceNumber& seq, const char* data, size_t length);
+
+  /// Decode a MULTICAST_FEC payload.  "received" holds the transport
+  /// sequence numbers already seen from the remote peer.  On
+  /// FEC_RECOVERED, "seq" and "datagram" hold the rebuilt datagram.
+  Result decode(Serializer& serializer,
+                const DisjointSequence& received,
+                SequenceNumber& seq,
+                Message_Block_Ptr& datagram);
+
+  /// Highest sequence number listed in any decoded payload.
+  const SequenceNumber& high() const { return high_; }
+
+private:
+  const size_t depth_;
+  SequenceNumber high_;
+  typedef OPENDDS_MAP(SequenceNumber, OPENDDS_VECTOR(char)) DatagramMap;
+  DatagramMap datagrams_;
+};
+
+} // namespace DCPS
+} // namespace OpenDDS
+
+OPENDDS_END_VERSIONED_NAMESPACE_DECL
+
+#endif  /* OPENDDS_DCPS_TRANSPORT_MULTICAST_MULTICASTFEC_H */
@@ -58,6 +58,8 @@ MulticastInst::MulticastInst(const std::string& name)
   , nak_delay_intervals_(*this, &MulticastInst::nak_delay_intervals, &MulticastInst::nak_delay_intervals)
   , nak_max_(*this, &MulticastInst::nak_max, &MulticastInst::nak_max)
   , nak_timeout_(*this, &MulticastInst::nak_timeout, &MulticastInst::nak_timeout)
+  , fec_window_(*this, &MulticastInst::fec_window, &MulticastInst::fec_window)
+  , fec_parity_(*this, &MulticastInst::fec_parity, &MulticastInst::fec_parity)
   , ttl_(*this, &MulticastInst::ttl, &MulticastInst::ttl)
   , rcv_buffer_size_(*this, &MulticastInst::rcv_buffer_size, &MulticastInst::rcv_buffer_size)
   , async_send_(*this, &MulticastInst::async_send, &MulticastInst::async_send)
@@ -88,6 +90,8 @@ MulticastInst::dump_to_str(DDS::DomainId_t domain) const
   os << formatNameForDump("nak_delay_intervals") << this->nak_delay_intervals() << std::endl;
   os << formatNameForDump("nak_max")             << this->nak_max() << std::endl;
   os << formatNameForDump("nak_timeout")         << this->nak_timeout().str() << std::endl;
+  os << formatNameForDump("fec_window")          << this->fec_window() << std::endl;
+  os << formatNameForDump("fec_parity")          << this->fec_parity() << std::endl;
   os << formatNameForDump("ttl")                 << int(this->ttl()) << std::endl;
   os << formatNameForDump("rcv_buffer_size");
 
@@ -329,6 +333,30 @@ MulticastInst::nak_timeout() const
                                                     ConfigStoreImpl::Format_IntegerMilliseconds);
 }
 
+void
+MulticastInst::fec_window(size_t fw)
+{
+  TheServiceParticipant->config_store()->set_uint32(config_key("FEC_WINDOW").c_str(), static_cast<DDS::UInt32>(fw));
+}
+
+size_t
+MulticastInst::fec_window() const
+{
+  return TheServiceParticipant->config_store()->get_uint32(config_key("FEC_WINDOW").c_str(), DEFAULT_FEC_WINDOW);
+}
+
+void
+MulticastInst::fec_parity(size_t fp)
+{
+  TheServiceParticipant->config_store()->set_uint32(config_key("FEC_PARITY").c_str(), static_cast<DDS::UInt32>(fp));
+}
+
+size_t
+MulticastInst::fec_parity() const
+{
+  return TheServiceParticipant->config_store()->get_uint32(config_key("FEC_PARITY").c_str(), DEFAULT_FEC_PARITY);
+}
+
 void
 MulticastInst::ttl(unsigned char t)
 {
@@ -32,6 +32,8 @@ public:
   static const long DEFAULT_NAK_DELAY_INTERVALS = 4;
   static const long DEFAULT_NAK_MAX = 3;
   static const long DEFAULT_NAK_TIMEOUT = 30000;
+  static const size_t DEFAULT_FEC_WINDOW = 0u;
+  static const size_t DEFAULT_FEC_PARITY = 1u;
 
   /// Enables IPv6 default group address selection.
   /// The default value is: false.
@@ -122,6 +124,21 @@ public:
   void nak_timeout(const TimeDuration& nt);
   TimeDuration nak_timeout() const;
 
+  /// The number of consecutive datagrams protected by forward error
+  /// correction parity (reliable only). A value of 0 disables FEC.
+  /// The default value is: 0.
+  ConfigValue<MulticastInst, size_t> fec_window_;
+  void fec_window(size_t fw);
+  size_t fec_window() const;
+
+  /// The number of XOR parity datagrams sent for each FEC window. The
+  /// window is interleaved across them, so up to this many consecutive
+  /// lost datagrams can be rebuilt by subscribers without a NAK.
+  /// The default value is: 1.
+  ConfigValue<MulticastInst, size_t> fec_parity_;
+  void fec_parity(size_t fp);
+  size_t fec_parity() const;
+
   /// time-to-live.
   /// The default value is: 1 (in same subnet)
   ConfigValue<MulticastInst, unsigned char> ttl_;
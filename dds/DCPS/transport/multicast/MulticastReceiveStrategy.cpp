@@ -10,6 +10,9 @@
 
 #include "ace/Reactor.h"
 
+#include <algorithm>
+#include <cstring>
+
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace OpenDDS {
@@ -33,15 +36,29 @@ MulticastReceiveStrategy::handle_input(ACE_HANDLE fd)
 {
   ThreadStatusManager::Event ev(TheServiceParticipant->get_thread_status_manager());
 
-  const int result = this->handle_dds_input(fd);
+  int result = this->handle_dds_input(fd);
   if (result >= 0 && this->pdu_remaining()) {
     VDBG_LVL((LM_DEBUG, "(%P|%t) MulticastReceiveStrategy[%@]::handle_input "
       "resetting with %B bytes remaining\n", this, this->pdu_remaining()), 4);
     this->reset();
   }
+
+  // Datagrams rebuilt from parity while handling the one above.
+  while (result >= 0 && !injected_.empty()) {
+    result = this->handle_dds_input(fd);
+    if (result >= 0 && this->pdu_remaining()) {
+      this->reset();
+    }
+  }
   return result;
 }
 
+void
+MulticastReceiveStrategy::inject(const Message_Block_Shared_Ptr& datagram)
+{
+  injected_.push_back(datagram);
+}
+
 ssize_t
 MulticastReceiveStrategy::receive_bytes(iovec iov[],
                                         int n,
@@ -49,8 +66,39 @@ MulticastReceiveStrategy::receive_bytes(iovec iov[],
                                         ACE_HANDLE /*fd*/,
                                         bool& /*stop*/)
 {
+  if (!injected_.empty()) {
+    const Message_Block_Shared_Ptr datagram = injected_.front();
+    injected_.erase(injected_.begin());
+
+    const char* src = datagram->rd_ptr();
+    size_t remaining = datagram->length();
+    for (int i = 0; i < n && remaining; ++i) {
+      const size_t amount = std::min(remaining, static_cast<size_t>(iov[i].iov_len));
+      std::memcpy(iov[i].iov_base, src, amount);
+      src += amount;
+      remaining -= amount;
+    }
+    this->link_->fec_datagram_received(datagram->rd_ptr(), datagram->length() - remaining);
+    return static_cast<ssize_t>(datagram->length() - remaining);
+  }
+
   ACE_SOCK_Dgram_Mcast& socket = this->link_->socket();
-  return socket.recv(iov, n, remote_address);
+  const ssize_t result = socket.recv(iov, n, remote_address);
+
+  if (result > 0 && this->link_->fec_enabled()) {
+    // Retain a contiguous copy for rebuilding lost datagrams from parity.
+    fec_scratch_.clear();
+    size_t remaining = static_cast<size_t>(result);
+    for (int i = 0; i < n && remaining; ++i) {
+      const size_t amount = std::min(remaining, static_cast<size_t>(iov[i].iov_len));
+      const char* const base = static_cast<const char*>(iov[i].iov_base);
+      fec_scratch_.insert(fec_scratch_.end(), base, base + amount);
+      remaining -= amount;
+    }
+    this->link_->fec_datagram_received(&fec_scratch_[0], fec_scratch_.size());
+  }
+
+  return result;
 }
 
 bool
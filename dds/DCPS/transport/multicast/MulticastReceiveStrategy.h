@@ -10,6 +10,8 @@
 
 #include "Multicast_Export.h"
 
+#include "dds/DCPS/Message_Block_Ptr.h"
+#include "dds/DCPS/PoolAllocator.h"
 #include "dds/DCPS/RcEventHandler.h"
 #include "dds/DCPS/transport/framework/TransportReceiveStrategy_T.h"
 
@@ -30,6 +32,11 @@ public:
   virtual ACE_HANDLE get_handle() const;
   virtual int handle_input(ACE_HANDLE fd);
 
+  /// Queue a datagram rebuilt by forward error correction.  It is
+  /// processed as if it had been read from the socket once the current
+  /// datagram has been handled.  Only called from the reactor thread.
+  void inject(const Message_Block_Shared_Ptr& datagram);
+
 protected:
   virtual ssize_t receive_bytes(iovec iov[],
                                 int n,
@@ -50,6 +57,10 @@ protected:
 
 private:
   MulticastDataLink* link_;
+
+  typedef OPENDDS_VECTOR(Message_Block_Shared_Ptr) DatagramQueue;
+  DatagramQueue injected_;
+  OPENDDS_VECTOR(char) fec_scratch_;
 };
 
 } // namespace DCPS
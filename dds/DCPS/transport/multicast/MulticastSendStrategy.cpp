@@ -42,7 +42,11 @@ MulticastSendStrategy::prepare_header_i()
 ssize_t
 MulticastSendStrategy::send_bytes_i(const iovec iov[], int n)
 {
-  return async_send_ ? async_send(iov, n, group_address_.to_addr()) : sync_send(iov, n);
+  const ssize_t result = async_send_ ? async_send(iov, n, group_address_.to_addr()) : sync_send(iov, n);
+  if (result > 0) {
+    link_->fec_datagram_sent(iov, n);
+  }
+  return result;
 }
 
 ssize_t
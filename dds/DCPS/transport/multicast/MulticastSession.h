@@ -59,6 +59,12 @@ public:
                                 const ReceivedDataSample& data) = 0;
   virtual void release_remote(const GUID_t& /*remote*/) {};
 
+  /// A raw datagram from the remote peer was read from the socket
+  /// (forward error correction only).
+  virtual void datagram_received(const SequenceNumber& /*seq*/,
+                                 const char* /*data*/,
+                                 size_t /*length*/) {}
+
   virtual bool control_received(char submessage_id,
                                 const Message_Block_Ptr& control);
 
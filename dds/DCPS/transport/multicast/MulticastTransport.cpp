@@ -48,6 +48,25 @@ MulticastTransport::config() const
   return dynamic_rchandle_cast<MulticastInst>(TransportImpl::config());
 }
 
+void
+MulticastTransport::append_transport_statistics(TransportStatisticsSequence& seq)
+{
+  TransportImpl::append_transport_statistics(seq);
+  MulticastFecCount& fec = seq[seq.length() - 1].fec;
+
+  GuardThreadType guard_links(links_lock_);
+  for (Links::const_iterator pos = client_links_.begin(); pos != client_links_.end(); ++pos) {
+    if (pos->second.in()) {
+      pos->second->fec_statistics().take(fec);
+    }
+  }
+  for (Links::const_iterator pos = server_links_.begin(); pos != server_links_.end(); ++pos) {
+    if (pos->second.in()) {
+      pos->second->fec_statistics().take(fec);
+    }
+  }
+}
+
 MulticastDataLink_rch
 MulticastTransport::make_datalink(const GUID_t& local_id,
                                   Priority priority,
@@ -35,6 +35,9 @@ public:
 
   MulticastInst_rch config() const;
 
+  /// Adds the FEC counts of every link to the framework's counts.
+  void append_transport_statistics(TransportStatisticsSequence& seq);
+
 protected:
   virtual AcceptConnectResult connect_datalink(const RemoteTransport& remote,
                                                const ConnectionAttribs& attribs,
@@ -42,7 +42,14 @@ ReliableSession::ReliableSession(RcHandle<ReactorInterceptor> interceptor,
   , nak_delay_intervals_(link->config()->nak_delay_intervals())
   , nak_max_(link->config()->nak_max())
   , nak_interval_(link->config()->nak_interval())
-{}
+  , fec_high_(SequenceNumber::SEQUENCENUMBER_UNKNOWN())
+{
+  if (link->fec_enabled()) {
+    // Room for the window being repaired plus the datagrams sent while
+    // its parity was on the way.
+    fec_decoder_.reset(new MulticastFecDecoder(4 * link->config()->fec_window()));
+  }
+}
 
 ReliableSession::~ReliableSession()
 {
@@ -200,6 +207,10 @@ ReliableSession::control_received(char submessage_id,
     nakack_received(control);
     break;
 
+  case MULTICAST_FEC:
+    fec_received(control);
+    break;
+
   default:
     ACE_ERROR((LM_WARNING,
                ACE_TEXT("(%P|%t) WARNING: ")
@@ -422,6 +433,23 @@ ReliableSession::send_naks()
     // ranges already requested by other peers for this interval:
     received.insert(*it);
   }
+
+  if (fec_decoder_) {
+    SequenceNumber fec_high;
+    MonotonicTimePoint fec_last_received;
+    {
+      ACE_GUARD(ACE_Thread_Mutex, guard, fec_lock_);
+      fec_high = fec_high_;
+      fec_last_received = fec_last_received_;
+    }
+    if (fec_high != SequenceNumber::SEQUENCENUMBER_UNKNOWN()
+        && received.high() > fec_high && now - fec_last_received < nak_interval_ * 2.0) {
+      // Parity is still arriving from the remote peer; gaps past the last
+      // parity may be rebuilt locally, so hold their repair requests.
+      ++fec_high;
+      received.insert(SequenceRange(fec_high, received.high()));
+    }
+  }
   bool sending_naks = false;
   if (received.low() > 1){
     //Special case: nak from beginning to make sure no missing sequence
@@ -429,6 +457,7 @@ ReliableSession::send_naks()
     sending_naks = true;
     std::vector<SequenceRange> ranges;
     ranges.push_back(SequenceRange(SequenceNumber(), received.low()));
+    link_->fec_statistics().naked += static_cast<size_t>(received.low().getValue());
 
     CORBA::ULong size = ACE_Utils::truncate_cast<CORBA::ULong>(ranges.size());
 
@@ -567,6 +596,8 @@ ReliableSession::send_naks(DisjointSequence& received)
        iter != ranges.end(); ++iter) {
     serializer << iter->first;
     serializer << iter->second;
+    link_->fec_statistics().naked +=
+      static_cast<size_t>(iter->second.getValue() - iter->first.getValue() + 1);
     if (OpenDDS::DCPS::DCPS_debug_level > 0) {
       ACE_DEBUG ((LM_DEBUG, ACE_TEXT ("(%P|%t) ReliableSession::send_naks (Disjoint) ")
                             ACE_TEXT (" local %#08x%08x remote %#08x%08x [%q - %q]\n"),
@@ -645,6 +676,74 @@ ReliableSession::send_nakack(SequenceNumber low)
   send_control(MULTICAST_NAKACK, move(data));
 }
 
+void
+ReliableSession::fec_received(const Message_Block_Ptr& control)
+{
+  if (this->active_ || !fec_decoder_) return; // pub sends parity, doesn't receive it.
+
+  const TransportHeader& header =
+    this->link_->receive_strategy()->received_header();
+
+  // Not from the remote peer for this session.
+  if (this->remote_peer_ != header.source_) return;
+
+  ++link_->fec_statistics().parity_received;
+
+  Serializer serializer(control.get(), reliable_session_encoding_kind, header.swap_bytes());
+
+  SequenceNumber seq;
+  Message_Block_Ptr datagram;
+  MulticastFecDecoder::Result result;
+  {
+    ACE_GUARD(ACE_Thread_Mutex, guard, fec_lock_);
+    result = fec_decoder_->decode(serializer, nak_sequence_, seq, datagram);
+    fec_high_ = fec_decoder_->high();
+    fec_last_received_ = MonotonicTimePoint::now();
+  }
+
+  switch (result) {
+  case MulticastFecDecoder::FEC_RECOVERED:
+    ++link_->fec_statistics().recovered;
+    if (DCPS_debug_level > 5) {
+      ACE_DEBUG((LM_DEBUG, ACE_TEXT("(%P|%t) ReliableSession::fec_received local %#08x%08x ")
+                           ACE_TEXT("remote %#08x%08x rebuilt datagram %q from parity\n"),
+                           (unsigned int)(this->link()->local_peer() >> 32),
+                           (unsigned int) this->link()->local_peer(),
+                           (unsigned int)(this->remote_peer_ >> 32),
+                           (unsigned int) this->remote_peer_,
+                           seq.getValue()));
+    }
+    this->link_->receive_strategy()->inject(Message_Block_Shared_Ptr(datagram.release()));
+    break;
+
+  case MulticastFecDecoder::FEC_UNRECOVERABLE:
+    ++link_->fec_statistics().unrecoverable;
+    break;
+
+  case MulticastFecDecoder::FEC_INVALID:
+    ACE_ERROR((LM_WARNING,
+               ACE_TEXT("(%P|%t) WARNING: ReliableSession::fec_received: ")
+               ACE_TEXT("malformed parity from remote peer %#08x%08x!\n"),
+               (unsigned int)(this->remote_peer_ >> 32),
+               (unsigned int) this->remote_peer_));
+    break;
+
+  case MulticastFecDecoder::FEC_COMPLETE:
+    break;
+  }
+}
+
+void
+ReliableSession::datagram_received(const SequenceNumber& seq,
+                                   const char* data,
+                                   size_t length)
+{
+  if (this->active_ || !fec_decoder_) return;
+
+  ACE_GUARD(ACE_Thread_Mutex, guard, fec_lock_);
+  fec_decoder_->record(seq, data, length);
+}
+
 bool
 ReliableSession::start(bool active, bool acked)
 {
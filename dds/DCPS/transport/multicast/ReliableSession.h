@@ -10,6 +10,7 @@
 
 #include "Multicast_Export.h"
 
+#include "MulticastFec.h"
 #include "MulticastSession.h"
 #include "MulticastTypes.h"
 
@@ -53,6 +54,11 @@ public:
   void nakack_received(const Message_Block_Ptr& control);
   virtual void send_nakack(SequenceNumber low);
 
+  void fec_received(const Message_Block_Ptr& control);
+  virtual void datagram_received(const SequenceNumber& seq,
+                                 const char* data,
+                                 size_t length);
+
   virtual bool start(bool active, bool acked);
   virtual void stop();
   virtual bool is_reliable() { return true;}
@@ -81,6 +87,14 @@ private:
   const size_t nak_delay_intervals_;
   const size_t nak_max_;
   const TimeDuration nak_interval_;
+
+  ACE_Thread_Mutex fec_lock_;
+  unique_ptr<MulticastFecDecoder> fec_decoder_;
+  /// Highest sequence number covered by parity received from the remote
+  /// peer, and when that parity arrived.  Gaps above it are left for the
+  /// next parity to repair before they are NAK'ed.
+  SequenceNumber fec_high_;
+  MonotonicTimePoint fec_last_received_;
 };
 
 } // namespace DCPS
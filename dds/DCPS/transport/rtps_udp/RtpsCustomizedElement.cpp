@@ -8,6 +8,8 @@
 #include "RtpsCustomizedElement.h"
 #include "RtpsSampleHeader.h"
 
+#include <dds/DCPS/transport/framework/TransportQueueElementPool.h>
+
 #ifndef __ACE_INLINE__
 #include "RtpsCustomizedElement.inl"
 #endif
@@ -17,9 +19,31 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
+namespace {
+  // Leaked so that elements released during static destruction still have it.
+  TransportQueueElementPool& pool()
+  {
+    static TransportQueueElementPool* const instance =
+      new TransportQueueElementPool("RtpsCustomizedElement", sizeof(RtpsCustomizedElement));
+    return *instance;
+  }
+}
+
 RtpsCustomizedElement::~RtpsCustomizedElement()
 {}
 
+void*
+RtpsCustomizedElement::operator new(size_t size)
+{
+  return pool().allocate(size);
+}
+
+void
+RtpsCustomizedElement::operator delete(void* ptr, size_t size)
+{
+  pool().deallocate(ptr, size);
+}
+
 TqePair RtpsCustomizedElement::fragment(size_t size)
 {
   Message_Block_Ptr head;
@@ -12,8 +12,6 @@
 
 #include "dds/DCPS/transport/framework/TransportCustomizedElement.h"
 
-#include "dds/DCPS/Dynamic_Cached_Allocator_With_Overflow_T.h"
-
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace OpenDDS {
@@ -29,6 +27,11 @@ public:
 
   SequenceNumber last_fragment() const;
 
+  /// Elements are pooled since one is created for each sample and fragment
+  /// sent.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr, size_t size);
+
 private:
 
   virtual ~RtpsCustomizedElement();
@@ -39,10 +42,6 @@ private:
   SequenceNumber last_frag_;
 };
 
-typedef Dynamic_Cached_Allocator_With_Overflow<ACE_Thread_Mutex>
-  RtpsCustomizedElementAllocator;
-
-
 } // namespace DCPS
 } // namespace OpenDDS
 
@@ -513,6 +513,7 @@ void
 RtpsUdpTransport::append_transport_statistics(TransportStatisticsSequence& seq)
 {
   core_.append_transport_statistics(seq);
+  coalesce_statistics()->take(seq[seq.length() - 1].coalesce);
 }
 
 bool RtpsUdpTransport::open_socket(
@@ -25,6 +25,12 @@ ShmemInst::ShmemInst(const std::string& name)
   : TransportInst("shmem", name)
   , pool_size_(*this, &ShmemInst::pool_size, &ShmemInst::pool_size)
   , datalink_control_size_(*this, &ShmemInst::datalink_control_size, &ShmemInst::datalink_control_size)
+  , pool_huge_pages_(*this, &ShmemInst::pool_huge_pages, &ShmemInst::pool_huge_pages)
+  , pool_transparent_huge_pages_(*this, &ShmemInst::pool_transparent_huge_pages,
+                                 &ShmemInst::pool_transparent_huge_pages)
+  , pool_prefault_(*this, &ShmemInst::pool_prefault, &ShmemInst::pool_prefault)
+  , pool_numa_node_(*this, &ShmemInst::pool_numa_node, &ShmemInst::pool_numa_node)
+  , pool_placement_("none")
 {
   std::ostringstream pool;
   pool << "OpenDDS-" << ACE_OS::getpid() << '-' << this->name();
@@ -44,6 +50,11 @@ ShmemInst::dump_to_str(DDS::DomainId_t domain) const
   os << TransportInst::dump_to_str(domain);
   os << formatNameForDump("pool_size") << pool_size() << "\n"
      << formatNameForDump("datalink_control_size") << datalink_control_size() << "\n"
+     << formatNameForDump("pool_huge_pages") << (pool_huge_pages() ? "true" : "false") << "\n"
+     << formatNameForDump("pool_transparent_huge_pages") << (pool_transparent_huge_pages() ? "true" : "false") << "\n"
+     << formatNameForDump("pool_prefault") << (pool_prefault() ? "true" : "false") << "\n"
+     << formatNameForDump("pool_numa_node") << pool_numa_node() << "\n"
+     << formatNameForDump("pool_placement") << pool_placement() << "\n"
      << formatNameForDump("pool_name") << this->poolname_ << "\n"
      << formatNameForDump("host_name") << this->hostname() << "\n"
      << formatNameForDump("association_resend_period") << association_resend_period().str() << "\n";
@@ -96,6 +107,68 @@ ShmemInst::datalink_control_size() const
   return TheServiceParticipant->config_store()->get_uint32(config_key("DATALINK_CONTROL_SIZE").c_str(), 4 * 1024);
 }
 
+void
+ShmemInst::pool_huge_pages(bool php)
+{
+  TheServiceParticipant->config_store()->set_boolean(config_key("POOL_HUGE_PAGES").c_str(), php);
+}
+
+bool
+ShmemInst::pool_huge_pages() const
+{
+  return TheServiceParticipant->config_store()->get_boolean(config_key("POOL_HUGE_PAGES").c_str(), false);
+}
+
+void
+ShmemInst::pool_transparent_huge_pages(bool pthp)
+{
+  TheServiceParticipant->config_store()->set_boolean(config_key("POOL_TRANSPARENT_HUGE_PAGES").c_str(), pthp);
+}
+
+bool
+ShmemInst::pool_transparent_huge_pages() const
+{
+  return TheServiceParticipant->config_store()->get_boolean(config_key("POOL_TRANSPARENT_HUGE_PAGES").c_str(), false);
+}
+
+void
+ShmemInst::pool_prefault(bool pp)
+{
+  TheServiceParticipant->config_store()->set_boolean(config_key("POOL_PREFAULT").c_str(), pp);
+}
+
+bool
+ShmemInst::pool_prefault() const
+{
+  return TheServiceParticipant->config_store()->get_boolean(config_key("POOL_PREFAULT").c_str(), false);
+}
+
+void
+ShmemInst::pool_numa_node(int pnn)
+{
+  TheServiceParticipant->config_store()->set_int32(config_key("POOL_NUMA_NODE").c_str(), pnn);
+}
+
+int
+ShmemInst::pool_numa_node() const
+{
+  return TheServiceParticipant->config_store()->get_int32(config_key("POOL_NUMA_NODE").c_str(), -1);
+}
+
+void
+ShmemInst::pool_placement(const String& placement)
+{
+  ACE_GUARD(ACE_Thread_Mutex, g, pool_placement_mutex_);
+  pool_placement_ = placement;
+}
+
+String
+ShmemInst::pool_placement() const
+{
+  ACE_GUARD_RETURN(ACE_Thread_Mutex, g, pool_placement_mutex_, String());
+  return pool_placement_;
+}
+
 void
 ShmemInst::hostname(const String& h)
 {
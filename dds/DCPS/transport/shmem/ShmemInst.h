@@ -12,6 +12,8 @@
 #include <dds/DCPS/transport/framework/TransportInst.h>
 #include <dds/DCPS/TimeDuration.h>
 
+#include <ace/Thread_Mutex.h>
+
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace OpenDDS {
@@ -36,6 +38,36 @@ public:
   void datalink_control_size(size_t dcs);
   size_t datalink_control_size() const;
 
+  /// Back the pool with huge pages (SHM_HUGETLB).  If the system has no
+  /// huge pages available the pool falls back to normal pages.
+  /// Defaults to false.
+  ConfigValue<ShmemInst, bool> pool_huge_pages_;
+  void pool_huge_pages(bool php);
+  bool pool_huge_pages() const;
+
+  /// Ask for transparent huge pages for the pool (MADV_HUGEPAGE).
+  /// Defaults to false.
+  ConfigValue<ShmemInst, bool> pool_transparent_huge_pages_;
+  void pool_transparent_huge_pages(bool pthp);
+  bool pool_transparent_huge_pages() const;
+
+  /// Fault in every page of the pool when it is created instead of on
+  /// first use.  Defaults to false.
+  ConfigValue<ShmemInst, bool> pool_prefault_;
+  void pool_prefault(bool pp);
+  bool pool_prefault() const;
+
+  /// NUMA node the pages of the pool are bound to, -1 for no binding.
+  /// Defaults to -1.
+  ConfigValue<ShmemInst, int> pool_numa_node_;
+  void pool_numa_node(int pnn);
+  int pool_numa_node() const;
+
+  /// Where the pool of the most recently created transport ended up, as
+  /// reported by dump_to_str().
+  void pool_placement(const String& placement);
+  String pool_placement() const;
+
   bool is_reliable() const { return true; }
 
   virtual size_t populate_locator(OpenDDS::DCPS::TransportLocator& trans_info,
@@ -58,6 +90,9 @@ private:
 
   TransportImpl_rch new_impl(DDS::DomainId_t domain);
   std::string poolname_;
+  /// Set from within get_or_create_impl(), which holds lock_.
+  mutable ACE_Thread_Mutex pool_placement_mutex_;
+  String pool_placement_;
 };
 
 } // namespace DCPS
@@ -12,12 +12,26 @@
 #include <dds/DCPS/debug.h>
 #include <dds/DCPS/AssociationData.h>
 #include <dds/DCPS/NetworkResource.h>
+#include <dds/DCPS/SafetyProfileStreams.h>
 #include <dds/DCPS/transport/framework/TransportExceptions.h>
 #include <dds/DCPS/transport/framework/TransportClient.h>
 
 #include <ace/Log_Msg.h>
+#include <ace/OS_NS_stdio.h>
+#include <ace/OS_NS_unistd.h>
+
+#ifdef OPENDDS_SHMEM_UNIX
+#  include <sys/mman.h>
+#  include <sys/shm.h>
+#  ifdef __linux__
+#    include <linux/mempolicy.h>
+#    include <sys/syscall.h>
+#  endif
+#endif
 
 #include <sstream>
+#include <climits>
+#include <cstdio>
 #include <cstring>
 
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
@@ -25,6 +39,30 @@ OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 namespace OpenDDS {
 namespace DCPS {
 
+#if defined OPENDDS_SHMEM_UNIX && defined __linux__ && defined SYS_mbind
+namespace {
+  /// Size of the default huge pages, which SHM_HUGETLB uses, or 0 if it
+  /// isn't known.
+  size_t default_huge_page_size()
+  {
+    size_t size = 0;
+    FILE* const meminfo = ACE_OS::fopen("/proc/meminfo", "r");
+    if (meminfo) {
+      char line[128];
+      while (ACE_OS::fgets(line, sizeof line, meminfo)) {
+        unsigned long kb = 0;
+        if (std::sscanf(line, "Hugepagesize: %lu kB", &kb) == 1) {
+          size = static_cast<size_t>(kb) * 1024;
+          break;
+        }
+      }
+      ACE_OS::fclose(meminfo);
+    }
+    return size;
+  }
+}
+#endif
+
 ShmemTransport::ShmemTransport(const ShmemInst_rch& inst,
                                  DDS::DomainId_t domain)
   : TransportImpl(inst, domain)
@@ -158,9 +196,40 @@ ShmemTransport::configure_i(const ShmemInst_rch& config)
   alloc_opts.max_segments_ = 1;
 #  endif /* OPENDDS_SHMEM_WINDOWS */
 
-  alloc_.reset(
-    new ShmemAllocator(ACE_TEXT_CHAR_TO_TCHAR(config->poolname().c_str()),
-                       0 /*lock_name is optional*/, &alloc_opts));
+  bool huge_pages = false;
+#  if defined OPENDDS_SHMEM_UNIX && defined SHM_HUGETLB
+  if (config->pool_huge_pages()) {
+    alloc_opts.file_perms_ |= SHM_HUGETLB;
+    alloc_.reset(
+      new ShmemAllocator(ACE_TEXT_CHAR_TO_TCHAR(config->poolname().c_str()),
+                         0 /*lock_name is optional*/, &alloc_opts));
+    huge_pages = !alloc_->bad();
+    if (!huge_pages) {
+      if (log_level >= LogLevel::Warning) {
+        ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: ShmemTransport::configure_i: "
+                   "could not create the pool with huge pages, using normal pages\n"));
+      }
+      alloc_.reset();
+      alloc_opts.file_perms_ &= ~SHM_HUGETLB;
+    }
+  }
+#  endif
+
+  if (!alloc_) {
+    alloc_.reset(
+      new ShmemAllocator(ACE_TEXT_CHAR_TO_TCHAR(config->poolname().c_str()),
+                         0 /*lock_name is optional*/, &alloc_opts));
+  }
+
+  if (alloc_->bad()) {
+    if (log_level >= LogLevel::Error) {
+      ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: ShmemTransport::configure_i: "
+                 "could not create the pool %C\n", config->poolname().c_str()));
+    }
+    return false;
+  }
+
+  config->pool_placement(place_pool(static_cast<char*>(alloc_->base_addr()), *config, huge_pages));
 
   void* mem = alloc_->malloc(sizeof(ShmemSharedSemaphore));
   if (mem == 0) {
@@ -208,6 +277,84 @@ ShmemTransport::configure_i(const ShmemInst_rch& config)
 #endif /* OPENDDS_SHMEM_UNSUPPORTED */
 }
 
+String
+ShmemTransport::place_pool(char* base, const ShmemInst& config, bool huge_pages)
+{
+  if (!base) {
+    if (log_level >= LogLevel::Warning) {
+      ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: ShmemTransport::place_pool: "
+                 "there is no pool to place\n"));
+    }
+    return "none";
+  }
+
+  String placement = huge_pages ? "huge pages" : "normal pages";
+
+#ifdef OPENDDS_SHMEM_UNIX
+  const size_t size = config.pool_size();
+  const size_t page_size = ACE_OS::getpagesize();
+
+#  ifdef MADV_HUGEPAGE
+  if (!huge_pages && config.pool_transparent_huge_pages()) {
+    if (::madvise(base, size, MADV_HUGEPAGE) == 0) {
+      placement += ", transparent huge pages";
+    } else if (log_level >= LogLevel::Warning) {
+      ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: ShmemTransport::place_pool: "
+                 "madvise MADV_HUGEPAGE failed: %m\n"));
+    }
+  }
+#  endif
+
+  const int node = config.pool_numa_node();
+  if (node >= 0) {
+#  if defined __linux__ && defined SYS_mbind
+    unsigned long mask[1024 / (CHAR_BIT * sizeof(unsigned long))] = {0};
+    const size_t bits = CHAR_BIT * sizeof mask[0];
+    // A huge page mapping can only be bound in whole pages.
+    const size_t huge_page_size = huge_pages ? default_huge_page_size() : 0;
+    const size_t align = huge_page_size ? huge_page_size : page_size;
+    const size_t bind_size = (size + align - 1) / align * align;
+    bool bound = false;
+    if (static_cast<size_t>(node) < sizeof mask * CHAR_BIT) {
+      mask[node / bits] |= 1ul << (node % bits);
+      bound = ::syscall(SYS_mbind, base, bind_size, MPOL_BIND, mask,
+                        sizeof mask * CHAR_BIT + 1, MPOL_MF_MOVE) == 0;
+    }
+    if (bound) {
+      placement += ", NUMA node " + to_dds_string(node);
+    } else if (log_level >= LogLevel::Warning) {
+      ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: ShmemTransport::place_pool: "
+                 "could not bind the pool to NUMA node %d: %m\n", node));
+    }
+#  else
+    if (log_level >= LogLevel::Warning) {
+      ACE_ERROR((LM_WARNING, "(%P|%t) WARNING: ShmemTransport::place_pool: "
+                 "binding the pool to a NUMA node is not supported on this platform\n"));
+    }
+#  endif
+  }
+
+  if (config.pool_prefault()) {
+#  ifdef MADV_POPULATE_WRITE
+    const bool populated = ::madvise(base, size, MADV_POPULATE_WRITE) == 0;
+#  else
+    const bool populated = false;
+#  endif
+    if (!populated) {
+      // Nothing else uses the pool yet, so rewriting it in place is safe.
+      for (volatile char* p = base; p < base + size; p += page_size) {
+        *p = *p;
+      }
+    }
+    placement += ", prefaulted";
+  }
+#else
+  ACE_UNUSED_ARG(config);
+#endif
+
+  return placement;
+}
+
 void
 ShmemTransport::shutdown_i()
 {
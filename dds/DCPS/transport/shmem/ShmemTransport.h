@@ -17,6 +17,8 @@
 
 #include <string>
 
+class DDS_TEST;
+
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
 namespace OpenDDS {
@@ -70,6 +72,10 @@ private:
 
   void read_from_links(); // callback from ReadTask
 
+  /// Apply the huge page, NUMA, and prefault options to the pool at "base"
+  /// and describe where it ended up.  Returns "none" without a pool.
+  static String place_pool(char* base, const ShmemInst& config, bool huge_pages);
+
   typedef ACE_Thread_Mutex LockType;
   typedef ACE_Guard<LockType> GuardType;
 
@@ -95,6 +101,8 @@ private:
     AtomicBool stopped_;
   };
   unique_ptr<ReadTask> read_task_;
+
+  friend class ::DDS_TEST;
 };
 
 } // namespace DCPS
@@ -16,6 +16,7 @@
 #include /**/ "dds/DCPS/DCPS_Utils.h"
 #include /**/ "dds/DdsDcpsInfoUtilsC.h"
 #include /**/ "dds/DCPS/RepoIdConverter.h"
+#include /**/ "dds/DCPS/Util.h"
 #include /**/ "dds/DCPS/Qos_Helper.h"
 #include /**/ "tao/debug.h"
 
@@ -41,7 +42,8 @@ DCPS_IR_Publication::DCPS_IR_Publication(const OpenDDS::DCPS::GUID_t& id,
     info_(info),
     transportContext_(transportContext),
     publisherQos_(publisherQos),
-    serializedTypeInfo_(serializedTypeInfo)
+    serializedTypeInfo_(serializedTypeInfo),
+    pending_active_(false)
 {
   writer_ =  OpenDDS::DCPS::DataWriterRemote::_duplicate(writer);
 
@@ -54,7 +56,8 @@ DCPS_IR_Publication::~DCPS_IR_Publication()
 }
 
 int DCPS_IR_Publication::add_associated_subscription(DCPS_IR_Subscription* sub,
-                                                     bool active)
+                                                     bool active,
+                                                     bool batch)
 {
   // keep track of the association locally
   int status = associations_.insert(sub);
@@ -73,7 +76,11 @@ int DCPS_IR_Publication::add_associated_subscription(DCPS_IR_Subscription* sub,
     association.exprParams = sub->get_expr_params();
     association.serializedTypeInfo = sub->get_serialized_type_info();
 
-    if (participant_->is_alive() && this->participant_->isOwner()) {
+    if (batch) {
+      OpenDDS::DCPS::push_back(pending_associations_, association);
+      pending_active_ = active;
+
+    } else if (participant_->is_alive() && this->participant_->isOwner()) {
       try {
         if (OpenDDS::DCPS::DCPS_debug_level > 0) {
           OpenDDS::DCPS::RepoIdConverter pub_converter(id_);
@@ -128,6 +135,110 @@ int DCPS_IR_Publication::add_associated_subscription(DCPS_IR_Subscription* sub,
   return status;
 }
 
+int DCPS_IR_Publication::flush_associations()
+{
+  const CORBA::ULong count = pending_associations_.length();
+  if (count == 0) {
+    return 0;
+  }
+
+  int status = 0;
+
+  if (participant_->is_alive() && this->participant_->isOwner()) {
+    try {
+      if (OpenDDS::DCPS::DCPS_debug_level > 0) {
+        OpenDDS::DCPS::RepoIdConverter converter(id_);
+        ACE_DEBUG((LM_DEBUG,
+                   ACE_TEXT("(%P|%t) DCPS_IR_Publication::flush_associations:")
+                   ACE_TEXT(" publication %C adding %u subscriptions.\n"),
+                   std::string(converter).c_str(),
+                   count));
+      }
+
+      if (count == 1) {
+        writer_->add_association(pending_associations_[0], pending_active_);
+      } else {
+        try {
+          writer_->add_associations(pending_associations_, pending_active_);
+        } catch (const CORBA::BAD_OPERATION&) {
+          // A participant built before add_associations() existed doesn't
+          // have the operation, so it's told one association at a time.
+          for (CORBA::ULong i = 0; i < count; ++i) {
+            writer_->add_association(pending_associations_[i], pending_active_);
+          }
+        }
+      }
+
+    } catch (const CORBA::Exception& ex) {
+      ex._tao_print_exception(
+        "(%P|%t) ERROR: Exception caught in DCPS_IR_Publication::flush_associations:");
+      participant_->mark_dead();
+      status = -1;
+    }
+  }
+
+  pending_associations_.length(0);
+  return status;
+}
+
+int DCPS_IR_Publication::flush_associations(const std::vector<DCPS_IR_Publication*>& others)
+{
+  bool together = !others.empty() && pending_associations_.length() == 1 &&
+    participant_->is_alive() && this->participant_->isOwner();
+  for (size_t i = 0; together && i < others.size(); ++i) {
+    together = others[i]->pending_associations_.length() == 1;
+  }
+
+  int status = 0;
+
+  if (together) {
+    OpenDDS::DCPS::WriterIdSeq other_ids;
+    for (size_t i = 0; i < others.size(); ++i) {
+      OpenDDS::DCPS::push_back(other_ids, others[i]->get_id());
+    }
+
+    try {
+      if (OpenDDS::DCPS::DCPS_debug_level > 0) {
+        OpenDDS::DCPS::RepoIdConverter converter(id_);
+        ACE_DEBUG((LM_DEBUG,
+                   ACE_TEXT("(%P|%t) DCPS_IR_Publication::flush_associations:")
+                   ACE_TEXT(" publication %C and %u others of its participant adding an association.\n"),
+                   std::string(converter).c_str(),
+                   other_ids.length()));
+      }
+
+      writer_->add_association_to_writers(other_ids, pending_associations_[0], pending_active_);
+
+    } catch (const CORBA::BAD_OPERATION&) {
+      // A participant built before add_association_to_writers() existed doesn't
+      // have the operation, so each datawriter is told on its own.
+      together = false;
+
+    } catch (const CORBA::Exception& ex) {
+      ex._tao_print_exception(
+        "(%P|%t) ERROR: Exception caught in DCPS_IR_Publication::flush_associations:");
+      participant_->mark_dead();
+      status = -1;
+    }
+  }
+
+  if (!together) {
+    status = flush_associations();
+    for (size_t i = 0; i < others.size(); ++i) {
+      if (others[i]->flush_associations() == -1) {
+        status = -1;
+      }
+    }
+    return status;
+  }
+
+  pending_associations_.length(0);
+  for (size_t i = 0; i < others.size(); ++i) {
+    others[i]->pending_associations_.length(0);
+  }
+  return status;
+}
+
 int DCPS_IR_Publication::remove_associated_subscription(DCPS_IR_Subscription* sub,
                                                         CORBA::Boolean sendNotify,
                                                         CORBA::Boolean notify_lost,
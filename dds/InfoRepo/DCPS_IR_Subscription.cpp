@@ -15,6 +15,7 @@
 #include /**/ "DCPS_IR_Domain.h"
 #include /**/ "dds/DCPS/DCPS_Utils.h"
 #include /**/ "dds/DCPS/RepoIdConverter.h"
+#include /**/ "dds/DCPS/Util.h"
 #include /**/ "dds/DCPS/Qos_Helper.h"
 #include /**/ "tao/debug.h"
 
@@ -46,7 +47,8 @@ DCPS_IR_Subscription::DCPS_IR_Subscription(const OpenDDS::DCPS::GUID_t& id,
     filterClassName_(filterClassName),
     filterExpression_(filterExpression),
     exprParams_(exprParams),
-    serializedTypeInfo_(serializedTypeInfo)
+    serializedTypeInfo_(serializedTypeInfo),
+    pending_active_(false)
 {
   reader_ =  OpenDDS::DCPS::DataReaderRemote::_duplicate(reader);
 
@@ -59,7 +61,8 @@ DCPS_IR_Subscription::~DCPS_IR_Subscription()
 }
 
 int DCPS_IR_Subscription::add_associated_publication(DCPS_IR_Publication* pub,
-                                                     bool active)
+                                                     bool active,
+                                                     bool batch)
 {
   // keep track of the association locally
   int status = associations_.insert(pub);
@@ -74,7 +77,11 @@ int DCPS_IR_Subscription::add_associated_publication(DCPS_IR_Publication* pub,
     association.pubQos = *(pub->get_publisher_qos());
     association.writerQos = *(pub->get_datawriter_qos());
     association.serializedTypeInfo = pub->get_serialized_type_info();
-    if (participant_->is_alive() && this->participant_->isOwner()) {
+    if (batch) {
+      OpenDDS::DCPS::push_back(pending_associations_, association);
+      pending_active_ = active;
+
+    } else if (participant_->is_alive() && this->participant_->isOwner()) {
       try {
         if (OpenDDS::DCPS::DCPS_debug_level > 0) {
           OpenDDS::DCPS::RepoIdConverter sub_converter(id_);
@@ -130,6 +137,110 @@ int DCPS_IR_Subscription::add_associated_publication(DCPS_IR_Publication* pub,
   return status;
 }
 
+int DCPS_IR_Subscription::flush_associations()
+{
+  const CORBA::ULong count = pending_associations_.length();
+  if (count == 0) {
+    return 0;
+  }
+
+  int status = 0;
+
+  if (participant_->is_alive() && this->participant_->isOwner()) {
+    try {
+      if (OpenDDS::DCPS::DCPS_debug_level > 0) {
+        OpenDDS::DCPS::RepoIdConverter converter(id_);
+        ACE_DEBUG((LM_DEBUG,
+                   ACE_TEXT("(%P|%t) DCPS_IR_Subscription::flush_associations:")
+                   ACE_TEXT(" subscription %C adding %u publications.\n"),
+                   std::string(converter).c_str(),
+                   count));
+      }
+
+      if (count == 1) {
+        reader_->add_association(pending_associations_[0], pending_active_);
+      } else {
+        try {
+          reader_->add_associations(pending_associations_, pending_active_);
+        } catch (const CORBA::BAD_OPERATION&) {
+          // A participant built before add_associations() existed doesn't
+          // have the operation, so it's told one association at a time.
+          for (CORBA::ULong i = 0; i < count; ++i) {
+            reader_->add_association(pending_associations_[i], pending_active_);
+          }
+        }
+      }
+
+    } catch (const CORBA::Exception& ex) {
+      ex._tao_print_exception(
+        "(%P|%t) ERROR: Exception caught in DCPS_IR_Subscription::flush_associations:");
+      participant_->mark_dead();
+      status = -1;
+    }
+  }
+
+  pending_associations_.length(0);
+  return status;
+}
+
+int DCPS_IR_Subscription::flush_associations(const std::vector<DCPS_IR_Subscription*>& others)
+{
+  bool together = !others.empty() && pending_associations_.length() == 1 &&
+    participant_->is_alive() && this->participant_->isOwner();
+  for (size_t i = 0; together && i < others.size(); ++i) {
+    together = others[i]->pending_associations_.length() == 1;
+  }
+
+  int status = 0;
+
+  if (together) {
+    OpenDDS::DCPS::ReaderIdSeq other_ids;
+    for (size_t i = 0; i < others.size(); ++i) {
+      OpenDDS::DCPS::push_back(other_ids, others[i]->get_id());
+    }
+
+    try {
+      if (OpenDDS::DCPS::DCPS_debug_level > 0) {
+        OpenDDS::DCPS::RepoIdConverter converter(id_);
+        ACE_DEBUG((LM_DEBUG,
+                   ACE_TEXT("(%P|%t) DCPS_IR_Subscription::flush_associations:")
+                   ACE_TEXT(" subscription %C and %u others of its participant adding an association.\n"),
+                   std::string(converter).c_str(),
+                   other_ids.length()));
+      }
+
+      reader_->add_association_to_readers(other_ids, pending_associations_[0], pending_active_);
+
+    } catch (const CORBA::BAD_OPERATION&) {
+      // A participant built before add_association_to_readers() existed doesn't
+      // have the operation, so each datareader is told on its own.
+      together = false;
+
+    } catch (const CORBA::Exception& ex) {
+      ex._tao_print_exception(
+        "(%P|%t) ERROR: Exception caught in DCPS_IR_Subscription::flush_associations:");
+      participant_->mark_dead();
+      status = -1;
+    }
+  }
+
+  if (!together) {
+    status = flush_associations();
+    for (size_t i = 0; i < others.size(); ++i) {
+      if (others[i]->flush_associations() == -1) {
+        status = -1;
+      }
+    }
+    return status;
+  }
+
+  pending_associations_.length(0);
+  for (size_t i = 0; i < others.size(); ++i) {
+    others[i]->pending_associations_.length(0);
+  }
+  return status;
+}
+
 int DCPS_IR_Subscription::remove_associated_publication(DCPS_IR_Publication* pub,
                                                         CORBA::Boolean sendNotify,
                                                         CORBA::Boolean notify_lost,
@@ -17,6 +17,8 @@
 #include /**/ "ace/Unbounded_Set.h"
 #include "dds/DCPS/unique_ptr.h"
 
+#include <vector>
+
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 #pragma once
 #endif /* ACE_LACKS_PRAGMA_ONCE */
@@ -60,8 +62,23 @@ public:
   /// Adds the publication to the list of associated
   ///  publications and notifies datareader if successfully added
   /// This method can mark the participant dead
+  /// If batch is true the datareader is not notified until flush_associations()
   /// Returns 0 if added, 1 if already exists, -1 other failure
-  int add_associated_publication(DCPS_IR_Publication* pub, bool active);
+  int add_associated_publication(DCPS_IR_Publication* pub, bool active, bool batch = false);
+
+  /// Notify the datareader of the associations added in batch mode since the
+  ///  last flush, using a single add_associations() call if there are several
+  ///  and falling back to add_association() if the remote doesn't have it
+  /// This method can mark the participant dead
+  /// Returns 0 if successful, -1 if the datareader could not be notified
+  int flush_associations();
+
+  /// Same as flush_associations() for this datareader and the others, which
+  ///  belong to the same participant, using a single add_association_to_readers()
+  ///  call if each of them has the same one association pending
+  /// This method can mark the participant dead
+  /// Returns 0 if successful, -1 if the datareaders could not be notified
+  int flush_associations(const std::vector<DCPS_IR_Subscription*>& others);
 
   /// Remove the associated publication
   /// Removes the publication from the list of associated
@@ -202,6 +219,10 @@ private:
   DCPS_IR_Publication_Set associations_;
   DCPS_IR_Publication_Set defunct_;
 
+  /// associations added in batch mode and not yet sent to the datareader
+  OpenDDS::DCPS::WriterAssociationSeq pending_associations_;
+  bool pending_active_;
+
   OpenDDS::DCPS::IncompatibleQosStatus incompatibleQosStatus_;
 };
 
@@ -277,7 +277,9 @@ bool DCPS_IR_Topic::set_topic_qos(const DDS::TopicQos& qos)
   return true;
 }
 
-void DCPS_IR_Topic::try_associate(DCPS_IR_Subscription* subscription)
+void DCPS_IR_Topic::try_associate(DCPS_IR_Subscription* subscription,
+                                  DCPS_IR_Association_Batch batch,
+                                  std::vector<DCPS_IR_Publication*>* matched)
 {
   // check if we should ignore this subscription
   if (participant_->is_subscription_ignored(subscription->get_id()) ||
@@ -304,7 +306,10 @@ void DCPS_IR_Topic::try_associate(DCPS_IR_Subscription* subscription)
     while (iter != end) {
       pub = *iter;
       ++iter;
-      description_->try_associate(pub, subscription);
+      if (description_->try_associate(pub, subscription, batch) && matched) {
+        matched->push_back(pub);
+      }
+
       // Check the publications QOS status
       qosStatus = pub->get_incompatibleQosStatus();
 
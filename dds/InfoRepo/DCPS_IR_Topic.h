@@ -9,12 +9,14 @@
 #define DCPS_IR_TOPIC_H
 
 #include  "inforepo_export.h"
+#include /**/ "DCPS_IR_Topic_Description.h"
 #include /**/ "dds/DdsDcpsInfrastructureC.h"
 #include /**/ "dds/DdsDcpsTopicC.h"
 #include /**/ "dds/DCPS/InfoRepoDiscovery/InfoC.h"
 #include /**/ "ace/Unbounded_Set.h"
 #include "dds/DCPS/unique_ptr.h"
 #include <string>
+#include <vector>
 
 #if !defined (ACE_LACKS_PRAGMA_ONCE)
 #pragma once
@@ -86,7 +88,10 @@ public:
   ///  associate method.
   /// This method does not check the subscription's incompatible
   ///  qos status.
-  void try_associate(DCPS_IR_Subscription* subscription);
+  /// The publications that match are added to matched if it's given.
+  void try_associate(DCPS_IR_Subscription* subscription,
+                     DCPS_IR_Association_Batch batch = BATCH_NONE,
+                     std::vector<DCPS_IR_Publication*>* matched = 0);
 
   /// Called by the DCPS_IR_Topic_Description to re-evaluate the
   /// association between the publications of this topic and the
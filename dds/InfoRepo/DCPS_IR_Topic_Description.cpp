@@ -15,13 +15,36 @@
 #include /**/ "DCPS_IR_Domain.h"
 
 #include /**/ "dds/DCPS/DCPS_Utils.h"
+#include /**/ "dds/DCPS/GuidUtils.h"
 
 #include /**/ "tao/debug.h"
 
 #include /**/ "dds/DCPS/RepoIdConverter.h"
 
+#include <map>
+#include <vector>
+
 OPENDDS_BEGIN_VERSIONED_NAMESPACE_DECL
 
+namespace {
+  template <typename Endpoint>
+  struct ParticipantGroups {
+    typedef std::map<OpenDDS::DCPS::GUID_t, std::vector<Endpoint*>,
+                     OpenDDS::DCPS::GUID_tKeyLessThan> Map;
+  };
+
+  /// Group the endpoints by participant, so that each participant is told
+  /// about a new association in one call.
+  template <typename Endpoint>
+  void group_by_participant(const std::vector<Endpoint*>& endpoints,
+                            typename ParticipantGroups<Endpoint>::Map& groups)
+  {
+    for (size_t i = 0; i < endpoints.size(); ++i) {
+      groups[endpoints[i]->get_participant_id()].push_back(endpoints[i]);
+    }
+  }
+}
+
 DCPS_IR_Topic_Description::DCPS_IR_Topic_Description(DCPS_IR_Domain* domain,
                                                      const char* name,
                                                      const char* dataTypeName)
@@ -210,13 +233,18 @@ void DCPS_IR_Topic_Description::try_associate_publication(DCPS_IR_Publication* p
   DCPS_IR_Subscription* subscription = 0;
   OpenDDS::DCPS::IncompatibleQosStatus* qosStatus = 0;
 
+  std::vector<DCPS_IR_Subscription*> matched;
+
   DCPS_IR_Subscription_Set::ITERATOR iter = subscriptionRefs_.begin();
   DCPS_IR_Subscription_Set::ITERATOR end = subscriptionRefs_.end();
 
   while (iter != end) {
     subscription = *iter;
     ++iter;
-    try_associate(publication, subscription);
+
+    if (try_associate(publication, subscription, BATCH_PUBLICATION)) {
+      matched.push_back(subscription);
+    }
 
     // Check the subscriptions QOS status
     qosStatus = subscription->get_incompatibleQosStatus();
@@ -226,6 +254,26 @@ void DCPS_IR_Topic_Description::try_associate_publication(DCPS_IR_Publication* p
     }
   }
 
+  // The publication must be told first, see associate().
+  if (publication->flush_associations() != -1) {
+    ParticipantGroups<DCPS_IR_Subscription>::Map groups;
+    group_by_participant(matched, groups);
+
+    typedef ParticipantGroups<DCPS_IR_Subscription>::Map::iterator GroupIter;
+    for (GroupIter group = groups.begin(); group != groups.end(); ++group) {
+      std::vector<DCPS_IR_Subscription*>& subscriptions = group->second;
+      for (size_t i = 0; i < subscriptions.size(); ++i) {
+        subscriptions[i]->add_associated_publication(publication, false, true);
+      }
+
+      const std::vector<DCPS_IR_Subscription*> others(subscriptions.begin() + 1,
+                                                      subscriptions.end());
+      subscriptions.front()->flush_associations(others);
+    }
+  } else if (!matched.empty()) {
+    ACE_DEBUG((LM_INFO, ACE_TEXT("Invalid publication detected, NOT notifying subscriptions of association\n")));
+  }
+
   // Check the publications QOS status
   qosStatus = publication->get_incompatibleQosStatus();
 
@@ -240,6 +288,8 @@ void DCPS_IR_Topic_Description::try_associate_subscription(DCPS_IR_Subscription*
 
   DCPS_IR_Topic* topic = 0;
 
+  std::vector<DCPS_IR_Publication*> matched;
+
   DCPS_IR_Topic_Set::ITERATOR iter = topics_.begin();
   DCPS_IR_Topic_Set::ITERATOR end = topics_.end();
 
@@ -247,9 +297,30 @@ void DCPS_IR_Topic_Description::try_associate_subscription(DCPS_IR_Subscription*
     topic = *iter;
     ++iter;
 
-    topic->try_associate(subscription);
+    topic->try_associate(subscription, BATCH_SUBSCRIPTION, &matched);
+  }
+
+  ParticipantGroups<DCPS_IR_Publication>::Map groups;
+  group_by_participant(matched, groups);
+
+  typedef ParticipantGroups<DCPS_IR_Publication>::Map::iterator GroupIter;
+  for (GroupIter group = groups.begin(); group != groups.end(); ++group) {
+    const std::vector<DCPS_IR_Publication*>& publications = group->second;
+    const std::vector<DCPS_IR_Publication*> others(publications.begin() + 1,
+                                                   publications.end());
+
+    // The publications must be told first, see associate().
+    if (publications.front()->flush_associations(others) != -1) {
+      for (size_t i = 0; i < publications.size(); ++i) {
+        subscription->add_associated_publication(publications[i], false, true);
+      }
+    } else {
+      ACE_DEBUG((LM_INFO, ACE_TEXT("Invalid publication detected, NOT notifying subscription of association\n")));
+    }
   }
 
+  subscription->flush_associations();
+
   // Check the subscriptions QOS status
   OpenDDS::DCPS::IncompatibleQosStatus* qosStatus =
     subscription->get_incompatibleQosStatus();
@@ -272,7 +343,8 @@ void DCPS_IR_Topic_Description::try_associate_subscription(DCPS_IR_Subscription*
 
 bool
 DCPS_IR_Topic_Description::try_associate(DCPS_IR_Publication* publication,
-                                         DCPS_IR_Subscription* subscription)
+                                         DCPS_IR_Subscription* subscription,
+                                         DCPS_IR_Association_Batch batch)
 {
   if (publication->is_subscription_ignored(subscription->get_participant_id(),
                                            subscription->get_topic_id(),
@@ -324,7 +396,7 @@ DCPS_IR_Topic_Description::try_associate(DCPS_IR_Publication* publication,
                                      subscription->get_datareader_qos(),
                                      publication->get_publisher_qos(),
                                      subscription->get_subscriber_qos())) {
-      associate(publication, subscription);
+      associate(publication, subscription, batch);
       return true;
     }
 
@@ -337,7 +409,8 @@ DCPS_IR_Topic_Description::try_associate(DCPS_IR_Publication* publication,
 }
 
 void DCPS_IR_Topic_Description::associate(DCPS_IR_Publication* publication,
-                                          DCPS_IR_Subscription* subscription)
+                                          DCPS_IR_Subscription* subscription,
+                                          DCPS_IR_Association_Batch batch)
 {
   if (OpenDDS::DCPS::DCPS_debug_level > 0) {
     OpenDDS::DCPS::RepoIdConverter pub_converter(publication->get_id());
@@ -359,6 +432,14 @@ void DCPS_IR_Topic_Description::associate(DCPS_IR_Publication* publication,
   // Note: the client thread may process the add_associations() oneway
   //       call instead of the ORB thread because it is currently
   //       in a two-way call to the Repo.
+  // When a new endpoint is matched against many existing ones the
+  // notifications are queued and sent together once matching is done, one
+  // call for the new endpoint and one for each participant of the others.
+  if (batch != BATCH_NONE) {
+    publication->add_associated_subscription(subscription, true, true);
+    return;
+  }
+
   int error = publication->add_associated_subscription(subscription, true);
 
   // If there was no TAO error contacting the publication (This can happen if
@@ -34,6 +34,15 @@ typedef ACE_Unbounded_Set<DCPS_IR_Subscription*> DCPS_IR_Subscription_Set;
 class DCPS_IR_Topic;
 typedef ACE_Unbounded_Set<DCPS_IR_Topic*> DCPS_IR_Topic_Set;
 
+/// Which side of an association is the new endpoint when its notifications
+///  are queued, to be sent together by flush_associations() once matching
+///  is done
+enum DCPS_IR_Association_Batch {
+  BATCH_NONE,
+  BATCH_PUBLICATION,
+  BATCH_SUBSCRIPTION
+};
+
 /**
  * @class DCPS_IR_Topic_Description
  *
@@ -77,20 +86,29 @@ public:
 
   /// Tries to associate the publication will each of
   ///  the subscriptions in the subscription list
+  /// The datawriter is told about all of its matches in one call, and
+  ///  the datareaders in one call for each of their participants
   void try_associate_publication(DCPS_IR_Publication* publication);
 
   /// Tries to associate the subscription will each of
   ///  the publications in each topic in the topic list
+  /// The datareader is told about all of its matches in one call, and
+  ///  the datawriters in one call for each of their participants
   void try_associate_subscription(DCPS_IR_Subscription* subscription);
 
   /// Checks to see if the publication and subscription can
   ///  be associated.
   bool try_associate(DCPS_IR_Publication* publication,
-                     DCPS_IR_Subscription* subscription);
+                     DCPS_IR_Subscription* subscription,
+                     DCPS_IR_Association_Batch batch = BATCH_NONE);
 
   /// Associate the publication and subscription
+  /// When batching only the publication's notification is queued, the
+  ///  caller flushes it and then notifies the subscription, see
+  ///  try_associate_publication() and try_associate_subscription()
   void associate(DCPS_IR_Publication* publication,
-                 DCPS_IR_Subscription* subscription);
+                 DCPS_IR_Subscription* subscription,
+                 DCPS_IR_Association_Batch batch = BATCH_NONE);
 
   /// Re-evaluate the association between the provided publication and
   /// the subscriptions it maintains.
@@ -57,6 +57,26 @@ DRMonitorImpl::report() {
       report.associations[length].state = iter->second;
       length++;
     }
+#ifndef OPENDDS_SAFETY_PROFILE
+    if (dr_->statistics_enabled()) {
+      LatencyStatisticsSeq stats;
+      dr_->get_latency_stats(stats);
+      report.latencies.length(stats.length());
+      for (CORBA::ULong i = 0; i < stats.length(); ++i) {
+        DataReaderLatency& latency = report.latencies[i];
+        latency.dw_id = stats[i].publication;
+        latency.stats.n = stats[i].n;
+        latency.stats.maximum = stats[i].maximum;
+        latency.stats.minimum = stats[i].minimum;
+        latency.stats.mean = stats[i].mean;
+        latency.stats.variance = stats[i].variance;
+        latency.median = stats[i].median;
+        latency.percentile_90 = stats[i].percentile_90;
+        latency.percentile_99 = stats[i].percentile_99;
+        latency.percentile_99_9 = stats[i].percentile_99_9;
+      }
+    }
+#endif
     dr_writer_->write(report, DDS::HANDLE_NIL);
   }
 }
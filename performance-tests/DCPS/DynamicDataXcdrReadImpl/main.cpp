@@ -0,0 +1,187 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+// Measures reading every member of a wide struct and every element of a long
+// sequence of strings from a DynamicDataXcdrReadImpl, which has to find where
+// each member or element starts in the serialized sample.
+
+#include <dds/DCPS/Serializer.h>
+#include <dds/DCPS/TimeTypes.h>
+#include <dds/DCPS/XTypes/DynamicDataXcdrReadImpl.h>
+#include <dds/DCPS/XTypes/DynamicTypeImpl.h>
+#include <dds/DCPS/XTypes/DynamicTypeMemberImpl.h>
+#include <dds/DCPS/XTypes/MemberDescriptorImpl.h>
+#include <dds/DCPS/XTypes/TypeDescriptorImpl.h>
+
+#include <ace/Arg_Shifter.h>
+#include <ace/Log_Msg.h>
+#include <ace/OS_NS_stdlib.h>
+
+using namespace OpenDDS;
+using namespace OpenDDS::DCPS;
+
+namespace {
+  const char element[] = "element";
+
+  struct Options {
+    Options()
+      : members(200)
+      , elements(2000)
+      , iterations(10)
+    {}
+
+    int members;
+    int elements;
+    int iterations;
+  };
+
+  DDS::DynamicType_var make_type(XTypes::TypeKind kind, const char* name,
+                                 DDS::ExtensibilityKind extensibility = DDS::FINAL,
+                                 DDS::DynamicType_ptr element_type = 0)
+  {
+    XTypes::DynamicTypeImpl* const type = new XTypes::DynamicTypeImpl();
+    DDS::DynamicType_var type_var = type;
+    DDS::TypeDescriptor_var td = new XTypes::TypeDescriptorImpl();
+    td->kind(kind);
+    td->name(name);
+    td->extensibility_kind(extensibility);
+    if (kind == XTypes::TK_STRING8 || kind == XTypes::TK_SEQUENCE) {
+      td->bound().length(1);
+      td->bound()[0] = 0;
+    }
+    if (element_type) {
+      td->element_type(element_type);
+    }
+    type->set_descriptor(td);
+    return type_var;
+  }
+
+  DDS::DynamicType_var make_struct(const char* name, DDS::ExtensibilityKind extensibility,
+                                   DDS::DynamicType_ptr member_type, int members)
+  {
+    DDS::DynamicType_var type_var = make_type(XTypes::TK_STRUCTURE, name, extensibility);
+    XTypes::DynamicTypeImpl* const type = dynamic_cast<XTypes::DynamicTypeImpl*>(type_var.in());
+    for (int i = 0; i < members; ++i) {
+      XTypes::DynamicTypeMemberImpl* const dtm = new XTypes::DynamicTypeMemberImpl();
+      DDS::DynamicTypeMember_var dtm_var = dtm;
+      DDS::MemberDescriptor_var md = new XTypes::MemberDescriptorImpl("m", false);
+      md->id(i);
+      md->index(i);
+      md->type(member_type);
+      dtm->set_descriptor(md);
+      type->insert_dynamic_member(dtm);
+    }
+    return type_var;
+  }
+
+  double read_strings(ACE_Message_Block& msg, const Encoding& encoding,
+                      DDS::DynamicType_ptr type, int count, int iterations)
+  {
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int n = 0; n < iterations; ++n) {
+      XTypes::DynamicDataXcdrReadImpl data(&msg, encoding, type);
+      char* value = 0;
+      for (int i = 0; i < count; ++i) {
+        if (data.get_string_value(value, i) != DDS::RETCODE_OK) {
+          ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: read_strings: failed to read %d\n", i));
+        }
+      }
+      CORBA::string_free(value);
+    }
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+    return elapsed.to_double() * 1e9 / (double(count) * iterations);
+  }
+
+  double read_int32s(ACE_Message_Block& msg, const Encoding& encoding,
+                     DDS::DynamicType_ptr type, int count, int iterations)
+  {
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int n = 0; n < iterations; ++n) {
+      XTypes::DynamicDataXcdrReadImpl data(&msg, encoding, type);
+      for (int i = 0; i < count; ++i) {
+        ACE_CDR::Long value;
+        if (data.get_int32_value(value, i) != DDS::RETCODE_OK) {
+          ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: read_int32s: failed to read %d\n", i));
+        }
+      }
+    }
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+    return elapsed.to_double() * 1e9 / (double(count) * iterations);
+  }
+}
+
+int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
+{
+  Options options;
+  ACE_Arg_Shifter args(argc, argv);
+  while (args.is_anything_left()) {
+    const ACE_TCHAR* arg = 0;
+    if ((arg = args.get_the_parameter(ACE_TEXT("-m")))) {
+      options.members = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-e")))) {
+      options.elements = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-i")))) {
+      options.iterations = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else {
+      args.ignore_arg();
+    }
+  }
+
+  if (options.members <= 0 || options.elements <= 0 || options.iterations <= 0) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: usage: %s [-m members] [-e elements] [-i iterations]\n",
+               argv[0]));
+    return 1;
+  }
+
+  ACE_DEBUG((LM_INFO, "(%P|%t) members: %d elements: %d iterations: %d\n",
+             options.members, options.elements, options.iterations));
+
+  const Encoding encoding(Encoding::KIND_XCDR2, ENDIAN_BIG);
+  const DDS::DynamicType_var string_type = make_type(XTypes::TK_STRING8, "String8");
+  const DDS::DynamicType_var int32_type = make_type(XTypes::TK_INT32, "Int32");
+  const ACE_CDR::ULong string_size = 4 + sizeof element;
+
+  {
+    const DDS::DynamicType_var type = make_struct("FinalStrings", DDS::FINAL, string_type, options.members);
+    ACE_Message_Block msg(options.members * string_size);
+    Serializer ser(&msg, encoding);
+    for (int i = 0; i < options.members; ++i) {
+      ser << element;
+    }
+    ACE_DEBUG((LM_INFO, "(%P|%t) final struct of strings: %.1f ns/member\n",
+               read_strings(msg, encoding, type, options.members, options.iterations)));
+  }
+
+  {
+    const DDS::DynamicType_var type = make_struct("MutableInt32s", DDS::MUTABLE, int32_type, options.members);
+    ACE_Message_Block msg(4 + options.members * 8);
+    Serializer ser(&msg, encoding);
+    ser.write_delimiter(options.members * 8);
+    for (int i = 0; i < options.members; ++i) {
+      ser.write_parameter_id(i, 4);
+      ser << ACE_CDR::Long(i);
+    }
+    ACE_DEBUG((LM_INFO, "(%P|%t) mutable struct of int32s: %.1f ns/member\n",
+               read_int32s(msg, encoding, type, options.members, options.iterations)));
+  }
+
+  {
+    const DDS::DynamicType_var type = make_type(XTypes::TK_SEQUENCE, "Sequence", DDS::FINAL, string_type);
+    ACE_Message_Block msg(8 + options.elements * string_size);
+    Serializer ser(&msg, encoding);
+    ser.write_delimiter(4 + options.elements * string_size);
+    ser << ACE_CDR::ULong(options.elements);
+    for (int i = 0; i < options.elements; ++i) {
+      ser << element;
+    }
+    ACE_DEBUG((LM_INFO, "(%P|%t) sequence of strings: %.1f ns/element\n",
+               read_strings(msg, encoding, type, options.elements, options.iterations)));
+  }
+
+  return 0;
+}
@@ -0,0 +1,22 @@
+eval '(exit $?0)' && eval 'exec perl -S $0 ${1+"$@"}'
+    & eval 'exec perl -S $0 $argv:q'
+    if 0;
+
+# -*- perl -*-
+
+use Env (DDS_ROOT);
+use lib "$DDS_ROOT/bin";
+use Env (ACE_ROOT);
+use lib "$ACE_ROOT/bin";
+use PerlDDS::Run_Test;
+use strict;
+
+my $test = new PerlDDS::TestFramework();
+$test->process("bench", "DynamicDataXcdrReadImpl", join(' ', @ARGV));
+$test->start_process("bench");
+my $retcode = $test->finish(300);
+if ($retcode != 0) {
+    exit 1;
+}
+
+exit 0;
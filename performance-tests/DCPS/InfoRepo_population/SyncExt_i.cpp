@@ -66,4 +66,17 @@ SyncExt_i::print_results (void)
                     << entities_data[count].msecs << " milliseconds." << std::endl;
         }
     }
+
+  // Publisher and Subscriber times cover creating the data writers and
+  // readers and waiting for them to be matched by the repository.
+  const int endpoints = entities_data[SyncExt::Publisher].instances
+    + entities_data[SyncExt::Subscriber].instances;
+  const int msecs = entities_data[SyncExt::Publisher].msecs
+    + entities_data[SyncExt::Subscriber].msecs;
+  if (msecs > 0)
+    {
+      std::cout << "Endpoints: " << endpoints << " in " << msecs
+                << " milliseconds, " << endpoints * 1000.0 / msecs
+                << " endpoints per second." << std::endl;
+    }
 }
@@ -0,0 +1,131 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+// Measures JobQueue::enqueue with 1 to 32 producer threads enqueuing jobs
+// for a single reactor thread to execute.
+
+#include <dds/DCPS/Atomic.h>
+#include <dds/DCPS/JobQueue.h>
+#include <dds/DCPS/TimeTypes.h>
+
+#include <ace/Arg_Shifter.h>
+#include <ace/Log_Msg.h>
+#include <ace/OS_NS_stdlib.h>
+#include <ace/OS_NS_unistd.h>
+#include <ace/Reactor.h>
+#include <ace/Thread_Manager.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct Options {
+    Options()
+      : jobs(100000)
+      , max_producers(32)
+    {}
+
+    int jobs;
+    int max_producers;
+  };
+
+  class CountJob : public Job {
+  public:
+    explicit CountJob(Atomic<long>& executed)
+      : executed_(executed)
+    {}
+
+    void execute() { ++executed_; }
+
+  private:
+    Atomic<long>& executed_;
+  };
+
+  struct Producer {
+    JobQueue_rch job_queue;
+    JobPtr job;
+    int jobs;
+  };
+
+  ACE_THR_FUNC_RETURN produce(void* arg)
+  {
+    Producer* const producer = static_cast<Producer*>(arg);
+    for (int i = 0; i < producer->jobs; ++i) {
+      producer->job_queue->enqueue(producer->job);
+    }
+    return 0;
+  }
+
+  ACE_THR_FUNC_RETURN run_reactor(void* arg)
+  {
+    ACE_Reactor* const reactor = static_cast<ACE_Reactor*>(arg);
+    reactor->owner(ACE_Thread::self());
+    reactor->run_reactor_event_loop();
+    return 0;
+  }
+
+  double run(ACE_Reactor& reactor, int producers, int jobs)
+  {
+    Atomic<long> executed(0);
+    const JobQueue_rch job_queue = make_rch<JobQueue>(&reactor);
+    OPENDDS_VECTOR(Producer) args(producers);
+    for (int i = 0; i < producers; ++i) {
+      args[i].job_queue = job_queue;
+      args[i].job = make_rch<CountJob>(ref(executed));
+      args[i].jobs = jobs / producers;
+    }
+    const long total = long(jobs / producers) * producers;
+
+    ACE_Thread_Manager threads;
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int i = 0; i < producers; ++i) {
+      threads.spawn(produce, &args[i]);
+    }
+    threads.wait();
+    while (executed < total) {
+      ACE_OS::thr_yield();
+    }
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+
+    return elapsed.to_double() * 1e9 / total;
+  }
+}
+
+int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
+{
+  Options options;
+  ACE_Arg_Shifter args(argc, argv);
+  while (args.is_anything_left()) {
+    const ACE_TCHAR* arg = 0;
+    if ((arg = args.get_the_parameter(ACE_TEXT("-n")))) {
+      options.jobs = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-p")))) {
+      options.max_producers = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else {
+      args.ignore_arg();
+    }
+  }
+
+  if (options.jobs <= 0 || options.max_producers <= 0) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: usage: %s [-n jobs] [-p max_producers]\n", argv[0]));
+    return 1;
+  }
+
+  ACE_DEBUG((LM_INFO, "(%P|%t) jobs: %d max producers: %d\n", options.jobs, options.max_producers));
+
+  ACE_Reactor reactor;
+  ACE_Thread_Manager reactor_thread;
+  reactor_thread.spawn(run_reactor, &reactor);
+
+  for (int producers = 1; producers <= options.max_producers; producers *= 2) {
+    ACE_DEBUG((LM_INFO, "(%P|%t) %d producers: %.1f ns/job\n",
+               producers, run(reactor, producers, options.jobs)));
+  }
+
+  reactor.end_reactor_event_loop();
+  reactor_thread.wait();
+  return 0;
+}
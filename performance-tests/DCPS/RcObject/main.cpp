@@ -0,0 +1,199 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+// Measures the heap allocations and time per reference counted event, with
+// and without a weak reference, from 1 to 16 threads creating and releasing
+// them, and per event dispatched through a ServiceEventDispatcher like the
+// transport and discovery timers.
+
+#include <dds/DCPS/Atomic.h>
+#include <dds/DCPS/ServiceEventDispatcher.h>
+#include <dds/DCPS/TimeTypes.h>
+
+#include <ace/Arg_Shifter.h>
+#include <ace/Log_Msg.h>
+#include <ace/OS_NS_stdlib.h>
+#include <ace/OS_NS_unistd.h>
+#include <ace/Thread_Manager.h>
+
+#ifdef ACE_HAS_CPP11
+#  include <atomic>
+#  include <cstdlib>
+#  include <new>
+
+namespace {
+  std::atomic<unsigned long> allocations(0);
+}
+
+// Count every allocation made by the process.
+void* operator new(std::size_t size)
+{
+  ++allocations;
+  if (void* const ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct Options {
+    Options()
+      : events(1000000)
+      , max_threads(16)
+    {}
+
+    int events;
+    int max_threads;
+  };
+
+  class CountEvent : public EventBase {
+  public:
+    explicit CountEvent(Atomic<long>& executed)
+      : executed_(executed)
+    {}
+
+    void handle_event() { ++executed_; }
+
+  private:
+    Atomic<long>& executed_;
+  };
+
+  struct Creator {
+    Atomic<long>* executed;
+    int events;
+    bool weak;
+  };
+
+  ACE_THR_FUNC_RETURN create(void* arg)
+  {
+    Creator* const creator = static_cast<Creator*>(arg);
+    for (int i = 0; i < creator->events; ++i) {
+      const RcHandle<CountEvent> event = make_rch<CountEvent>(ref(*creator->executed));
+      if (creator->weak) {
+        const WeakRcHandle<CountEvent> weak(event);
+        weak.lock()->handle_event();
+      } else {
+        event->handle_event();
+      }
+    }
+    return 0;
+  }
+
+  struct Result {
+    double ns;
+    double allocations;
+  };
+
+  Result run_create(int threads, int events, bool weak)
+  {
+    Atomic<long> executed(0);
+    OPENDDS_VECTOR(Creator) args(threads);
+    for (int i = 0; i < threads; ++i) {
+      args[i].executed = &executed;
+      args[i].events = events / threads;
+      args[i].weak = weak;
+    }
+    const long total = long(events / threads) * threads;
+
+    ACE_Thread_Manager thread_manager;
+    const unsigned long allocations_before = allocations;
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int i = 0; i < threads; ++i) {
+      thread_manager.spawn(create, &args[i]);
+    }
+    thread_manager.wait();
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+    const unsigned long allocated = allocations - allocations_before;
+
+    const Result result = {elapsed.to_double() * 1e9 / total, double(allocated) / total};
+    return result;
+  }
+
+  Result run_dispatch(int events)
+  {
+    Atomic<long> executed(0);
+    const ServiceEventDispatcher_rch dispatcher = make_rch<ServiceEventDispatcher>(1);
+
+    const unsigned long allocations_before = allocations;
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int i = 0; i < events; ++i) {
+      dispatcher->dispatch(make_rch<CountEvent>(ref(executed)));
+    }
+    while (executed < events) {
+      ACE_OS::thr_yield();
+    }
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+    const unsigned long allocated = allocations - allocations_before;
+    dispatcher->shutdown();
+
+    const Result result = {elapsed.to_double() * 1e9 / events, double(allocated) / events};
+    return result;
+  }
+}
+
+int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
+{
+  Options options;
+  ACE_Arg_Shifter args(argc, argv);
+  while (args.is_anything_left()) {
+    const ACE_TCHAR* arg = 0;
+    if ((arg = args.get_the_parameter(ACE_TEXT("-n")))) {
+      options.events = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-t")))) {
+      options.max_threads = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else {
+      args.ignore_arg();
+    }
+  }
+
+  if (options.events <= 0 || options.max_threads <= 0) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: usage: %s [-n events] [-t max_threads]\n", argv[0]));
+    return 1;
+  }
+
+  ACE_DEBUG((LM_INFO, "(%P|%t) events: %d max threads: %d\n", options.events, options.max_threads));
+
+  for (int threads = 1; threads <= options.max_threads; threads *= 2) {
+    const Result strong = run_create(threads, options.events, false);
+    const Result weak = run_create(threads, options.events, true);
+    ACE_DEBUG((LM_INFO, "(%P|%t) %d threads: %.1f ns/event, %.2f allocations/event, "
+               "with weak reference: %.1f ns/event, %.2f allocations/event\n",
+               threads, strong.ns, strong.allocations, weak.ns, weak.allocations));
+  }
+
+  const Result dispatched = run_dispatch(options.events);
+  ACE_DEBUG((LM_INFO, "(%P|%t) dispatched: %.1f ns/event, %.2f allocations/event\n",
+             dispatched.ns, dispatched.allocations));
+  return 0;
+}
+
+#else
+
+int ACE_TMAIN(int, ACE_TCHAR*[])
+{
+  ACE_DEBUG((LM_INFO, "(%P|%t) RcObject is only measured with C++11 atomics\n"));
+  return 0;
+}
+
+#endif
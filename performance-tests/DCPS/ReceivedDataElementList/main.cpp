@@ -0,0 +1,109 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+// Measures ReceivedDataElementList::add_by_timestamp, which is used for
+// BY_SOURCE_TIMESTAMP destination order, with samples from several writers
+// whose clocks are offset from each other arriving interleaved in one
+// instance.
+
+#include <dds/DCPS/DataReaderImpl.h>
+#include <dds/DCPS/ReceivedDataElementList.h>
+#include <dds/DCPS/TimeTypes.h>
+
+#include <ace/Arg_Shifter.h>
+#include <ace/Log_Msg.h>
+#include <ace/OS_NS_stdlib.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct Options {
+    Options()
+      : samples(10000)
+      , writers(4)
+      , skew_msec(50)
+      , period_msec(1)
+    {}
+
+    int samples;
+    int writers;
+    int skew_msec;
+    int period_msec;
+  };
+
+  double run(const Options& options)
+  {
+    ACE_New_Allocator allocator;
+    ACE_Recursive_Thread_Mutex mutex;
+    ReceivedDataElementList list((DataReaderImpl_rch()));
+    static int data = 0;
+
+    DataSampleHeader header;
+    header.message_id_ = SAMPLE_DATA;
+
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int i = 0; i < options.samples; ++i) {
+      // Writers take turns, but each one's clock is behind the previous.
+      const int writer = i % options.writers;
+      const long msec = long(i / options.writers) * options.period_msec - long(writer) * options.skew_msec + 1000000;
+      header.source_timestamp_sec_ = static_cast<ACE_INT32>(msec / 1000);
+      header.source_timestamp_nanosec_ = static_cast<ACE_UINT32>(msec % 1000) * 1000000;
+      list.add_by_timestamp(new (allocator) ReceivedDataElement(header, &data, &mutex));
+    }
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+
+    while (ReceivedDataElement* const head = list.remove_head()) {
+      head->dec_ref();
+    }
+
+    return elapsed.to_double() * 1e9 / options.samples;
+  }
+}
+
+int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
+{
+  Options options;
+  ACE_Arg_Shifter args(argc, argv);
+  while (args.is_anything_left()) {
+    const ACE_TCHAR* arg = 0;
+    if ((arg = args.get_the_parameter(ACE_TEXT("-n")))) {
+      options.samples = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-w")))) {
+      options.writers = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-s")))) {
+      options.skew_msec = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-p")))) {
+      options.period_msec = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else {
+      args.ignore_arg();
+    }
+  }
+
+  if (options.samples <= 0 || options.writers <= 0 || options.period_msec <= 0) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: usage: %s [-n samples] [-w writers] [-s skew_msec] [-p period_msec]\n",
+               argv[0]));
+    return 1;
+  }
+
+  ACE_DEBUG((LM_INFO, "(%P|%t) samples: %d writers: %d skew: %d ms period: %d ms\n",
+             options.samples, options.writers, options.skew_msec, options.period_msec));
+
+  // The first writer alone is always in order.
+  Options in_order = options;
+  in_order.writers = 1;
+  ACE_DEBUG((LM_INFO, "(%P|%t) in order: %.1f ns/sample\n", run(in_order)));
+
+  for (int writers = 2; writers <= options.writers; writers *= 2) {
+    Options interleaved = options;
+    interleaved.writers = writers;
+    ACE_DEBUG((LM_INFO, "(%P|%t) %d interleaved writers: %.1f ns/sample\n", writers, run(interleaved)));
+  }
+
+  return 0;
+}
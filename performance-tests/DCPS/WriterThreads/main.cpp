@@ -0,0 +1,243 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+// Measures DataWriter::write with 1 to 16 application threads writing
+// different instances of one DataWriter.  The DataWriter is matched with a
+// DataReader and, unless -c 0 is given, one more through a content filter
+// that excludes most samples, so writes track the readers' expected sequence
+// numbers both while the readers share it and after the filter splits them.
+
+#include "WriterThreadsTypeSupportImpl.h"
+
+#include <dds/DCPS/Marked_Default_Qos.h>
+#include <dds/DCPS/Service_Participant.h>
+#include <dds/DCPS/TimeTypes.h>
+#include <dds/DCPS/WaitSet.h>
+#ifdef ACE_AS_STATIC_LIBS
+#  include <dds/DCPS/RTPS/RtpsDiscovery.h>
+#  include <dds/DCPS/transport/rtps_udp/RtpsUdp.h>
+#endif
+
+#include <ace/Arg_Shifter.h>
+#include <ace/Log_Msg.h>
+#include <ace/OS_NS_stdlib.h>
+#include <ace/Thread_Manager.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct Options {
+    Options()
+      : samples(200000)
+      , instances(16)
+      , max_threads(16)
+      , content_filter(true)
+    {}
+
+    int samples;
+    int instances;
+    int max_threads;
+    bool content_filter;
+  };
+
+  struct Writer {
+    WriterThreads::SampleDataWriter_var writer;
+    int first_id;
+    int instances;
+    int samples;
+    int errors;
+  };
+
+  ACE_THR_FUNC_RETURN write_samples(void* arg)
+  {
+    Writer* const w = static_cast<Writer*>(arg);
+    WriterThreads::Sample sample;
+    for (int i = 0; i < w->samples; ++i) {
+      sample.id = w->first_id + i % w->instances;
+      sample.value = i;
+      if (w->writer->write(sample, DDS::HANDLE_NIL) != DDS::RETCODE_OK) {
+        ++w->errors;
+      }
+    }
+    return 0;
+  }
+
+  bool wait_for_readers(DDS::DataWriter* dw, CORBA::Long readers)
+  {
+    DDS::StatusCondition_var condition = dw->get_statuscondition();
+    condition->set_enabled_statuses(DDS::PUBLICATION_MATCHED_STATUS);
+    DDS::WaitSet_var ws = new DDS::WaitSet;
+    ws->attach_condition(condition);
+
+    const DDS::Duration_t timeout = { 30, 0 };
+    DDS::ConditionSeq conditions;
+    DDS::PublicationMatchedStatus matches = { 0, 0, 0, 0, 0 };
+    bool matched = true;
+    while (matches.current_count < readers) {
+      if (ws->wait(conditions, timeout) != DDS::RETCODE_OK ||
+          dw->get_publication_matched_status(matches) != DDS::RETCODE_OK) {
+        matched = false;
+        break;
+      }
+    }
+    ws->detach_condition(condition);
+    return matched;
+  }
+
+  // Each thread writes its own instances of a new DataWriter.
+  double run(DDS::Publisher* publisher, DDS::Topic* topic, CORBA::Long readers,
+             const Options& options, int threads, int& errors)
+  {
+    DDS::DataWriterQos qos;
+    publisher->get_default_datawriter_qos(qos);
+    qos.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+    qos.history.kind = DDS::KEEP_LAST_HISTORY_QOS;
+    qos.history.depth = 1;
+    DDS::DataWriter_var dw = publisher->create_datawriter(topic, qos, 0, DEFAULT_STATUS_MASK);
+    if (CORBA::is_nil(dw)) {
+      ++errors;
+      return 0;
+    }
+    if (!wait_for_readers(dw, readers)) {
+      ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: DataWriter didn't match %d readers\n", readers));
+      ++errors;
+      publisher->delete_datawriter(dw);
+      return 0;
+    }
+
+    OPENDDS_VECTOR(Writer) args(threads);
+    for (int i = 0; i < threads; ++i) {
+      args[i].writer = WriterThreads::SampleDataWriter::_narrow(dw);
+      args[i].first_id = i * options.instances;
+      args[i].instances = options.instances;
+      args[i].samples = options.samples / threads;
+      args[i].errors = 0;
+    }
+    const long total = long(options.samples / threads) * threads;
+
+    ACE_Thread_Manager thread_manager;
+    const MonotonicTimePoint start = MonotonicTimePoint::now();
+    for (int i = 0; i < threads; ++i) {
+      thread_manager.spawn(write_samples, &args[i]);
+    }
+    thread_manager.wait();
+    const TimeDuration elapsed = MonotonicTimePoint::now() - start;
+
+    for (int i = 0; i < threads; ++i) {
+      errors += args[i].errors;
+    }
+    publisher->delete_datawriter(dw);
+    return elapsed.to_double() * 1e9 / total;
+  }
+}
+
+int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
+{
+  DDS::DomainParticipantFactory_var dpf = TheParticipantFactoryWithArgs(argc, argv);
+
+  Options options;
+  ACE_Arg_Shifter args(argc, argv);
+  while (args.is_anything_left()) {
+    const ACE_TCHAR* arg = 0;
+    if ((arg = args.get_the_parameter(ACE_TEXT("-n")))) {
+      options.samples = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-i")))) {
+      options.instances = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-t")))) {
+      options.max_threads = ACE_OS::atoi(arg);
+      args.consume_arg();
+    } else if ((arg = args.get_the_parameter(ACE_TEXT("-c")))) {
+      options.content_filter = ACE_OS::atoi(arg) != 0;
+      args.consume_arg();
+    } else {
+      args.ignore_arg();
+    }
+  }
+
+  if (options.samples <= 0 || options.instances <= 0 || options.max_threads <= 0) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: usage: %s [-n samples] [-i instances_per_thread] [-t max_threads] [-c content_filter]\n", argv[0]));
+    return 1;
+  }
+
+  DDS::DomainParticipant_var participant =
+    dpf->create_participant(42, PARTICIPANT_QOS_DEFAULT, 0, DEFAULT_STATUS_MASK);
+  WriterThreads::SampleTypeSupport_var ts = new WriterThreads::SampleTypeSupportImpl;
+  if (CORBA::is_nil(participant) || ts->register_type(participant, "") != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: failed to create participant or register type\n"));
+    return 1;
+  }
+  CORBA::String_var type_name = ts->get_type_name();
+  DDS::Topic_var topic = participant->create_topic("WriterThreads", type_name, TOPIC_QOS_DEFAULT, 0, DEFAULT_STATUS_MASK);
+  DDS::Publisher_var publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT, 0, DEFAULT_STATUS_MASK);
+  if (CORBA::is_nil(topic) || CORBA::is_nil(publisher)) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: failed to create topic or publisher\n"));
+    return 1;
+  }
+
+  // The readers get their own participant, as they would in another process.
+  DDS::DomainParticipant_var sub_participant =
+    dpf->create_participant(42, PARTICIPANT_QOS_DEFAULT, 0, DEFAULT_STATUS_MASK);
+  if (CORBA::is_nil(sub_participant) || ts->register_type(sub_participant, "") != DDS::RETCODE_OK) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: failed to create reader participant or register type\n"));
+    return 1;
+  }
+  DDS::Topic_var sub_topic = sub_participant->create_topic("WriterThreads", type_name, TOPIC_QOS_DEFAULT, 0, DEFAULT_STATUS_MASK);
+  DDS::Subscriber_var subscriber = sub_participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT, 0, DEFAULT_STATUS_MASK);
+  if (CORBA::is_nil(sub_topic) || CORBA::is_nil(subscriber)) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: failed to create reader topic or subscriber\n"));
+    return 1;
+  }
+
+  DDS::DataReaderQos reader_qos;
+  subscriber->get_default_datareader_qos(reader_qos);
+  reader_qos.history.kind = DDS::KEEP_LAST_HISTORY_QOS;
+  reader_qos.history.depth = 1;
+  DDS::DataReader_var reader = subscriber->create_datareader(sub_topic, reader_qos, 0, DEFAULT_STATUS_MASK);
+  if (CORBA::is_nil(reader)) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: failed to create reader\n"));
+    return 1;
+  }
+  CORBA::Long readers = 1;
+
+#ifndef OPENDDS_NO_CONTENT_FILTERED_TOPIC
+  if (options.content_filter) {
+    // Only the first sample of each thread passes, so the writer leaves
+    // this reader out of the others.
+    DDS::ContentFilteredTopic_var cft = sub_participant->create_contentfilteredtopic(
+      "WriterThreadsFiltered", sub_topic, "value < 1", DDS::StringSeq());
+    DDS::DataReader_var filtered = CORBA::is_nil(cft) ? 0 :
+      subscriber->create_datareader(cft, reader_qos, 0, DEFAULT_STATUS_MASK);
+    if (CORBA::is_nil(filtered)) {
+      ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: failed to create content filtered reader\n"));
+      return 1;
+    }
+    ++readers;
+  }
+#endif
+
+  ACE_DEBUG((LM_INFO, "(%P|%t) samples: %d instances per thread: %d max threads: %d readers: %d\n",
+             options.samples, options.instances, options.max_threads, readers));
+
+  int errors = 0;
+  for (int threads = 1; threads <= options.max_threads; threads *= 2) {
+    const double ns = run(publisher, topic, readers, options, threads, errors);
+    ACE_DEBUG((LM_INFO, "(%P|%t) %d threads: %.1f ns/write, %.0f writes/s\n",
+               threads, ns, ns > 0 ? 1e9 / ns : 0.0));
+  }
+
+  participant->delete_contained_entities();
+  dpf->delete_participant(participant);
+  sub_participant->delete_contained_entities();
+  dpf->delete_participant(sub_participant);
+  TheServiceParticipant->shutdown();
+
+  if (errors) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: %d writes failed\n", errors));
+    return 1;
+  }
+  return 0;
+}
@@ -20,6 +20,10 @@ SimpleStatBlock::SimpleStatBlock()
  , median_sample_overflow_(0)
  , median_(0.0)
  , median_absolute_deviation_(0.0)
+ , histogram_()
+ , percentile_90_(0.0)
+ , percentile_99_(0.0)
+ , percentile_99_9_(0.0)
 {
 }
 
@@ -28,6 +32,30 @@ char my_toupper(char ch)
 {
   return static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
 }
+
+ACE_UINT64 to_histogram_value(double value)
+{
+  const double scaled = value / STAT_BLOCK_HISTOGRAM_RESOLUTION;
+  if (!(scaled > 0.0)) {
+    return 0;
+  }
+  if (scaled >= static_cast<double>(std::numeric_limits<ACE_UINT64>::max())) {
+    return std::numeric_limits<ACE_UINT64>::max();
+  }
+  return static_cast<ACE_UINT64>(scaled + 0.5);
+}
+
+double from_histogram_value(ACE_UINT64 value)
+{
+  return static_cast<double>(value) * STAT_BLOCK_HISTOGRAM_RESOLUTION;
+}
+}
+
+void SimpleStatBlock::update_percentiles()
+{
+  percentile_90_ = from_histogram_value(histogram_.value_at_percentile(90.0));
+  percentile_99_ = from_histogram_value(histogram_.value_at_percentile(99.0));
+  percentile_99_9_ = from_histogram_value(histogram_.value_at_percentile(99.9));
 }
 
 void SimpleStatBlock::pretty_print(std::ostream& os, const std::string& name, const std::string& indent, size_t indent_level) const
@@ -56,6 +84,11 @@ void SimpleStatBlock::pretty_print(std::ostream& os, const std::string& name, co
     os << i2 << name << std::setw(my_w) << std::setfill(' ') << " stdev" << " = " << std::fixed << std::setprecision(6) << stdev << std::endl;
     os << i2 << name << std::setw(my_w) << std::setfill(' ') << " median" << " = " << std::fixed << std::setprecision(6) << median_ << std::endl;
     os << i2 << name << std::setw(my_w) << std::setfill(' ') << " madev" << " = " << std::fixed << std::setprecision(6) << median_absolute_deviation_ << std::endl;
+    if (histogram_.count()) {
+      os << i2 << name << std::setw(my_w) << std::setfill(' ') << " p90" << " = " << std::fixed << std::setprecision(6) << percentile_90_ << std::endl;
+      os << i2 << name << std::setw(my_w) << std::setfill(' ') << " p99" << " = " << std::fixed << std::setprecision(6) << percentile_99_ << std::endl;
+      os << i2 << name << std::setw(my_w) << std::setfill(' ') << " p99.9" << " = " << std::fixed << std::setprecision(6) << percentile_99_9_ << std::endl;
+    }
     if (median_sample_overflow_) {
       os << i2 << name << std::setw(my_w) << std::setfill(' ') << " overflow" << " = " << median_sample_overflow_ << std::endl;
     }
@@ -76,6 +109,11 @@ void SimpleStatBlock::to_json_summary(const std::string& name, rapidjson::Value&
     stat_val.AddMember("madev", rapidjson::Value(median_absolute_deviation_).Move(), alloc);
     stat_val.AddMember("median_sample_count", rapidjson::Value(static_cast<uint64_t>(median_sample_count_)).Move(), alloc);
     stat_val.AddMember("median_sample_overflow", rapidjson::Value(static_cast<uint64_t>(median_sample_overflow_)).Move(), alloc);
+    if (histogram_.count()) {
+      stat_val.AddMember("percentile_90", rapidjson::Value(percentile_90_).Move(), alloc);
+      stat_val.AddMember("percentile_99", rapidjson::Value(percentile_99_).Move(), alloc);
+      stat_val.AddMember("percentile_99_9", rapidjson::Value(percentile_99_9_).Move(), alloc);
+    }
   }
 }
 
@@ -111,6 +149,11 @@ SimpleStatBlock consolidate(const SimpleStatBlock& sb1, const SimpleStatBlock& s
   }
   result.median_sample_overflow_ = result.sample_count_ - result.median_sample_count_;
 
+  // Consolidate percentile histograms
+  result.histogram_ = sb1.histogram_;
+  result.histogram_.merge(sb2.histogram_);
+  result.update_percentiles();
+
   // Consolidate timestamp buffers
   result.timestamp_buffer_.resize(result.median_sample_count_);
   if (sb1.timestamp_buffer_.size()) {
@@ -190,6 +233,11 @@ SimpleStatBlock consolidate(const std::vector<SimpleStatBlock>& vec)
 
   result.timestamp_buffer_.resize(result.median_sample_count_);
 
+  for (auto it = vec.begin(); it != vec.end(); ++it) {
+    result.histogram_.merge(it->histogram_);
+  }
+  result.update_percentiles();
+
   size_t median_buffer_pos = 0;
 
   if (result.median_sample_count_) {
@@ -273,6 +321,17 @@ PropertyStatBlock::PropertyStatBlock(Builder::PropertySeq& seq, const std::strin
 
   median_absolute_deviation_ = get_or_create_property(seq, prefix + "_median_absolute_deviation", Builder::PVK_DOUBLE);
   median_absolute_deviation_->value.double_prop(0.0);
+
+  histogram_ = OpenDDS::DCPS::make_rch<OpenDDS::DCPS::Histogram>();
+
+  percentile_90_ = get_or_create_property(seq, prefix + "_percentile_90", Builder::PVK_DOUBLE);
+  percentile_90_->value.double_prop(0.0);
+
+  percentile_99_ = get_or_create_property(seq, prefix + "_percentile_99", Builder::PVK_DOUBLE);
+  percentile_99_->value.double_prop(0.0);
+
+  percentile_99_9_ = get_or_create_property(seq, prefix + "_percentile_99_9", Builder::PVK_DOUBLE);
+  percentile_99_9_->value.double_prop(0.0);
 }
 
 void PropertyStatBlock::update(double value, const Builder::TimeStamp& time)
@@ -304,6 +363,7 @@ void PropertyStatBlock::update(double value, const Builder::TimeStamp& time)
   }
 
   median_buffer_[next_median_buffer_index] = value;
+  histogram_->record(to_histogram_value(value));
 
   if (timestamp_buffer_.size()) {
     timestamp_buffer_[next_median_buffer_index] = time == Builder::ZERO ? Builder::get_sys_time() : time;
@@ -358,6 +418,25 @@ void PropertyStatBlock::finalize()
   }
   median_->value.double_prop(median_result);
   median_absolute_deviation_->value.double_prop(mad_result);
+
+  // write histogram as (bucket index, count) pairs of the non-empty buckets
+  OpenDDS::DCPS::HistogramSnapshot snapshot;
+  histogram_->snapshot(snapshot);
+  Builder::PropertyIndex hist_prop = get_or_create_property(*(median_.get_seq()), std::string(median_->name) + "_histogram_buffer", Builder::PVK_DOUBLE_SEQ);
+  Builder::DoubleSeq hs;
+  for (size_t i = 0; i < snapshot.counts().size(); ++i) {
+    if (snapshot.counts()[i]) {
+      const CORBA::ULong len = hs.length();
+      hs.length(len + 2);
+      hs[len] = static_cast<double>(i);
+      hs[len + 1] = static_cast<double>(snapshot.counts()[i]);
+    }
+  }
+  hist_prop->value.double_seq_prop(hs);
+
+  percentile_90_->value.double_prop(from_histogram_value(snapshot.value_at_percentile(90.0)));
+  percentile_99_->value.double_prop(from_histogram_value(snapshot.value_at_percentile(99.0)));
+  percentile_99_9_->value.double_prop(from_histogram_value(snapshot.value_at_percentile(99.9)));
 }
 
 SimpleStatBlock PropertyStatBlock::to_simple_stat_block() const
@@ -380,6 +459,9 @@ void PropertyStatBlock::to_simple_stat_block(SimpleStatBlock& result) const
   result.median_sample_count_ = static_cast<size_t>(median_sample_count_->value.ull_prop());
   result.median_ = median_->value.double_prop();
   result.median_absolute_deviation_ = median_absolute_deviation_->value.double_prop();
+
+  histogram_->snapshot(result.histogram_);
+  result.update_percentiles();
 }
 
 ConstPropertyStatBlock::ConstPropertyStatBlock(const Builder::PropertySeq& seq, const std::string& prefix)
@@ -417,6 +499,22 @@ ConstPropertyStatBlock::ConstPropertyStatBlock(const Builder::PropertySeq& seq,
   median_ = get_property(seq, prefix + "_median", Builder::PVK_DOUBLE);
 
   median_absolute_deviation_ = get_property(seq, prefix + "_median_absolute_deviation", Builder::PVK_DOUBLE);
+
+  Builder::ConstPropertyIndex histogram_buffer = get_property(seq, prefix + "_median_histogram_buffer", Builder::PVK_DOUBLE_SEQ);
+
+  if (histogram_buffer) {
+    const Builder::DoubleSeq& hs = histogram_buffer->value.double_seq_prop();
+    histogram_ = OpenDDS::DCPS::HistogramSnapshot(OpenDDS::DCPS::Histogram::DEFAULT_SUB_BUCKET_BITS, 64);
+    for (CORBA::ULong i = 0; i + 1 < hs.length(); i += 2) {
+      histogram_.add_bucket(static_cast<size_t>(hs[i]), static_cast<ACE_UINT64>(hs[i + 1]));
+    }
+  }
+
+  percentile_90_ = get_property(seq, prefix + "_percentile_90", Builder::PVK_DOUBLE);
+
+  percentile_99_ = get_property(seq, prefix + "_percentile_99", Builder::PVK_DOUBLE);
+
+  percentile_99_9_ = get_property(seq, prefix + "_percentile_99_9", Builder::PVK_DOUBLE);
 }
 
 SimpleStatBlock ConstPropertyStatBlock::to_simple_stat_block() const
@@ -440,6 +538,15 @@ void ConstPropertyStatBlock::to_simple_stat_block(SimpleStatBlock& result) const
     result.median_sample_count_ = static_cast<size_t>(median_sample_count_->value.ull_prop());
     result.median_ = median_->value.double_prop();
     result.median_absolute_deviation_ = median_absolute_deviation_->value.double_prop();
+
+    result.histogram_ = histogram_;
+    if (percentile_90_ && percentile_99_ && percentile_99_9_) {
+      result.percentile_90_ = percentile_90_->value.double_prop();
+      result.percentile_99_ = percentile_99_->value.double_prop();
+      result.percentile_99_9_ = percentile_99_9_->value.double_prop();
+    } else {
+      result.update_percentiles();
+    }
   } else {
     result = SimpleStatBlock();
   }
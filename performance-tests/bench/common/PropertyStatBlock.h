@@ -4,6 +4,7 @@
 #include "Common.h"
 #include "BenchTypeSupportImpl.h"
 
+#include <dds/DCPS/Histogram.h>
 #include <dds/DCPS/RapidJsonWrapper.h>
 
 #include <vector>
@@ -12,6 +13,10 @@ namespace Bench {
 
 constexpr size_t DEFAULT_STAT_BLOCK_BUFFER_SIZE = 1000u;
 
+// Values are recorded into the percentile histogram in units of this size,
+// so values in seconds get nanosecond resolution. Negative values count as 0.
+constexpr double STAT_BLOCK_HISTOGRAM_RESOLUTION = 1e-9;
+
 struct Bench_Common_Export SimpleStatBlock {
   SimpleStatBlock();
 
@@ -28,6 +33,13 @@ struct Bench_Common_Export SimpleStatBlock {
   double median_;
   double median_absolute_deviation_;
 
+  OpenDDS::DCPS::HistogramSnapshot histogram_;
+  double percentile_90_;
+  double percentile_99_;
+  double percentile_99_9_;
+
+  void update_percentiles();
+
   void pretty_print(std::ostream& os, const std::string& prefix, const std::string& indentation = "  ", size_t indentation_level = 0) const;
   void to_json_summary(const std::string& name, rapidjson::Value& dst, rapidjson::Value::AllocatorType& alloc) const;
 };
@@ -59,6 +71,11 @@ private:
   Builder::PropertyIndex median_sample_count_;
   Builder::PropertyIndex median_;
   Builder::PropertyIndex median_absolute_deviation_;
+
+  OpenDDS::DCPS::Histogram_rch histogram_;
+  Builder::PropertyIndex percentile_90_;
+  Builder::PropertyIndex percentile_99_;
+  Builder::PropertyIndex percentile_99_9_;
 };
 
 class Bench_Common_Export ConstPropertyStatBlock {
@@ -85,6 +102,11 @@ private:
   Builder::ConstPropertyIndex median_sample_count_;
   Builder::ConstPropertyIndex median_;
   Builder::ConstPropertyIndex median_absolute_deviation_;
+
+  OpenDDS::DCPS::HistogramSnapshot histogram_;
+  Builder::ConstPropertyIndex percentile_90_;
+  Builder::ConstPropertyIndex percentile_99_;
+  Builder::ConstPropertyIndex percentile_99_9_;
 };
 
 }
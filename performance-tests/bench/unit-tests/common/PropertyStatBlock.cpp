@@ -192,5 +192,30 @@ TEST(PropertyStatBlock, ConsolidateVector_CountOne)
   EXPECT_EQ(ssb3.median_absolute_deviation_, 5.0);
 }
 
+TEST(PropertyStatBlock, Percentiles)
+{
+  Builder::PropertySeq ps1;
+  Bench::PropertyStatBlock psb1(ps1, "test1", Bench::DEFAULT_STAT_BLOCK_BUFFER_SIZE);
+  Builder::PropertySeq ps2;
+  Bench::PropertyStatBlock psb2(ps2, "test2", Bench::DEFAULT_STAT_BLOCK_BUFFER_SIZE);
+
+  for (int i = 1; i <= 1000; ++i) {
+    (i % 2 ? psb1 : psb2).update(i / 1000.0);
+  }
+
+  psb1.finalize();
+  psb2.finalize();
+
+  const Bench::SimpleStatBlock ssb = consolidate(
+    Bench::ConstPropertyStatBlock(ps1, "test1").to_simple_stat_block(),
+    Bench::ConstPropertyStatBlock(ps2, "test2").to_simple_stat_block());
+
+  EXPECT_EQ(ssb.histogram_.count(), 1000u);
+  EXPECT_NEAR(ssb.percentile_90_, 0.900, 0.900 / 32);
+  EXPECT_NEAR(ssb.percentile_99_, 0.990, 0.990 / 32);
+  EXPECT_NEAR(ssb.percentile_99_9_, 0.999, 0.999 / 32);
+  EXPECT_GE(ssb.percentile_99_9_, ssb.percentile_99_);
+  EXPECT_GE(ssb.percentile_99_, ssb.percentile_90_);
 }
 
+}
@@ -419,6 +419,122 @@ bool pubsub(OpenDDS::DCPS::Discovery_rch disc, CORBA::ORB_var orb)
     }
 
   disc->remove_publication(domain, pubPartId, dwIncQosImpl.guid());
+
+  // A new endpoint that matches several existing ones is told about all of
+  // them at once, and each of those is still told about the new endpoint,
+  // with one call for all of the ones in the same participant.
+  ACE_DEBUG((LM_DEBUG,
+             ACE_TEXT("adding second matching subscription\n")));
+  TAO_DDS_DCPSDataReader_i drImpl2;
+  if (use_rtps)
+    drImpl2.disco_ = disc.in();
+  drImpl2.domainId_ = domain;
+  drImpl2.participantId_ = subPartId;
+
+  disc->add_subscription(domain,
+                         subPartId,
+                         subTopicId,
+                         rchandle_from(&drImpl2),
+                         drQos.in(),
+                         tii,
+                         subQos.in(),
+                         "", "", DDS::StringSeq(),
+                         type_info);
+  if (OpenDDS::DCPS::GUID_UNKNOWN == drImpl2.guid())
+    {
+      failed = true;
+      ACE_ERROR((LM_ERROR, ACE_TEXT("ERROR: add_subscription failed!\n") ));
+    }
+
+  expected.clear();
+  expected.push_back(DiscReceivedCalls::ADD_ASSOC);
+
+  if (!drImpl2.received().expect(orb, max_delay, expected))
+    {
+      failed = true;
+    }
+
+  if (!dwImpl->received().expect(orb, max_delay, expected))
+    {
+      failed = true;
+    }
+
+  ACE_DEBUG((LM_DEBUG,
+             ACE_TEXT("adding publication matching two subscriptions\n")));
+  TAO_DDS_DCPSDataWriter_i dwImpl2;
+
+  disc->add_publication(domain,
+                        pubPartId,
+                        pubTopicId,
+                        rchandle_from(&dwImpl2),
+                        dwQos.in(),
+                        tii,
+                        pQos.in(),
+                        type_info);
+  if (OpenDDS::DCPS::GUID_UNKNOWN == dwImpl2.guid())
+    {
+      failed = true;
+      ACE_ERROR((LM_ERROR, ACE_TEXT("ERROR: add_publication failed!\n") ));
+    }
+
+  std::vector<DiscReceivedCalls::Called> expectedBatch(2, DiscReceivedCalls::ADD_ASSOC);
+
+  if (!dwImpl2.received().expect(orb, max_delay, expectedBatch))
+    {
+      failed = true;
+    }
+
+  if (!drImpl.received().expect(orb, max_delay, expected))
+    {
+      failed = true;
+    }
+
+  if (!drImpl2.received().expect(orb, max_delay, expected))
+    {
+      failed = true;
+    }
+
+  ACE_DEBUG((LM_DEBUG,
+             ACE_TEXT("adding subscription matching two publications\n")));
+  TAO_DDS_DCPSDataReader_i drImpl3;
+  if (use_rtps)
+    drImpl3.disco_ = disc.in();
+  drImpl3.domainId_ = domain;
+  drImpl3.participantId_ = subPartId;
+
+  disc->add_subscription(domain,
+                         subPartId,
+                         subTopicId,
+                         rchandle_from(&drImpl3),
+                         drQos.in(),
+                         tii,
+                         subQos.in(),
+                         "", "", DDS::StringSeq(),
+                         type_info);
+  if (OpenDDS::DCPS::GUID_UNKNOWN == drImpl3.guid())
+    {
+      failed = true;
+      ACE_ERROR((LM_ERROR, ACE_TEXT("ERROR: add_subscription failed!\n") ));
+    }
+
+  if (!drImpl3.received().expect(orb, max_delay, expectedBatch))
+    {
+      failed = true;
+    }
+
+  if (!dwImpl->received().expect(orb, max_delay, expected))
+    {
+      failed = true;
+    }
+
+  if (!dwImpl2.received().expect(orb, max_delay, expected))
+    {
+      failed = true;
+    }
+
+  disc->remove_subscription(domain, subPartId, drImpl3.guid());
+  disc->remove_subscription(domain, subPartId, drImpl2.guid());
+  disc->remove_publication(domain, pubPartId, dwImpl2.guid());
   disc->remove_subscription(domain, subPartId, drImpl.guid());
   disc->remove_publication(domain, pubPartId, dwImpl->guid());
   disc->remove_topic(domain, pubPartId, pubTopicId);
@@ -20,10 +20,17 @@
 
 const size_t num_messages = 40;
 
+/// Set by -a when both participants use security, so they authenticate each other.
+inline bool& authenticated()
+{
+  static bool value = false;
+  return value;
+}
+
 inline
 int parse_args(int argc, ACE_TCHAR* argv[])
 {
-  ACE_Get_Opt get_opts(argc, argv, ACE_TEXT("t:pw"));
+  ACE_Get_Opt get_opts(argc, argv, ACE_TEXT("t:pwa"));
 
   OpenDDS::DCPS::String transport_type;
   int c;
@@ -46,6 +53,9 @@ int parse_args(int argc, ACE_TCHAR* argv[])
     case 'p':
       thread_per_connection = true;
       break;
+    case 'a':
+      authenticated() = true;
+      break;
     case '?':
     default:
       ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: parse_args: usage: %s [-t transport]\n", argv[0]));
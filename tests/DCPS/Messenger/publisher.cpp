@@ -9,6 +9,7 @@
 #include <tests/Utils/StatusMatching.h>
 
 #include <dds/DCPS/DCPS_Utils.h>
+#include <dds/DCPS/DomainParticipantImpl.h>
 #include <dds/DCPS/Marked_Default_Qos.h>
 #include <dds/DCPS/PublisherImpl.h>
 #include <dds/DCPS/Service_Participant.h>
@@ -16,6 +17,7 @@
 #include <dds/OpenDDSConfigWrapper.h>
 
 #if OPENDDS_CONFIG_SECURITY
+#  include <dds/DCPS/RTPS/RtpsDiscovery.h>
 #  include <dds/DCPS/security/framework/Properties.h>
 #endif
 #include <dds/DCPS/StaticIncludes.h>
@@ -56,6 +58,37 @@ void append(DDS::PropertySeq& props, const String& name, const String& value, bo
   props[len] = prop;
 }
 
+#if OPENDDS_CONFIG_SECURITY
+bool check_handshake_latency(DDS::DomainParticipant* participant)
+{
+  using namespace OpenDDS::DCPS;
+  const DDS::DomainId_t domain = participant->get_domain_id();
+  const OpenDDS::RTPS::RtpsDiscovery_rch disc =
+    dynamic_rchandle_cast<OpenDDS::RTPS::RtpsDiscovery>(TheServiceParticipant->get_discovery(domain));
+  DomainParticipantImpl* const impl = dynamic_cast<DomainParticipantImpl*>(participant);
+  if (!disc || !impl) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: check_handshake_latency: not using RTPS discovery\n"));
+    return false;
+  }
+
+  // The subscriber's participant was authenticated before the writer matched.
+  HistogramSnapshot latency;
+  HistogramSnapshot crypto_latency;
+  disc->get_handshake_latency(domain, impl->get_id(), latency);
+  disc->get_handshake_crypto_latency(domain, impl->get_id(), crypto_latency);
+  if (latency.count() == 0 || crypto_latency.count() == 0) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: check_handshake_latency: "
+               "%Q handshakes and %Q handshake calls recorded\n",
+               latency.count(), crypto_latency.count()));
+    return false;
+  }
+  ACE_DEBUG((LM_DEBUG, "(%P|%t) DEBUG: check_handshake_latency: "
+             "%Q handshakes, at most %Q us, %Q handshake calls, at most %Q us\n",
+             latency.count(), latency.maximum(), crypto_latency.count(), crypto_latency.maximum()));
+  return true;
+}
+#endif
+
 int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
 {
   int status = EXIT_SUCCESS;
@@ -172,6 +205,12 @@ int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
         return EXIT_FAILURE;
       }
 
+#if OPENDDS_CONFIG_SECURITY
+      if (authenticated() && !check_handshake_latency(participant)) {
+        return EXIT_FAILURE;
+      }
+#endif
+
       std::cout << "Start Writing Samples" << std::endl;
 
       // Write samples
@@ -97,10 +97,15 @@ elsif ($test->flag('rtps_disc_half_sec_sub')) {
     $is_rtps_disc = 1;
 }
 elsif ($test->flag('rtps_disc_sec')) {
-    $pub_opts .= " -DCPSConfigFile rtps_disc_sec.ini";
+    $pub_opts .= " -DCPSConfigFile rtps_disc_sec.ini -a";
     $sub_opts .= " -DCPSConfigFile rtps_disc_sec.ini";
     $is_rtps_disc = 1;
 }
+elsif ($test->flag('rtps_disc_sec_auth_workers')) {
+    $pub_opts .= " -DCPSConfigFile rtps_disc_sec_auth_workers.ini -a";
+    $sub_opts .= " -DCPSConfigFile rtps_disc_sec_auth_workers.ini";
+    $is_rtps_disc = 1;
+}
 elsif ($test->flag('rtps_disc_tcp')) {
     $pub_opts .= " -DCPSConfigFile rtps_disc_tcp.ini";
     $sub_opts .= " -DCPSConfigFile rtps_disc_tcp.ini";
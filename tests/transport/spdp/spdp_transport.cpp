@@ -528,6 +528,41 @@ bool run_test()
     }
   }
 
+  spdp_friend.remove_participant();
+
+  // An announcement that is the same as the last one is skipped and counted.
+  ACE_DEBUG((LM_DEBUG, ACE_TEXT("Unchanged Announcement Test\n")));
+  OpenDDS::RTPS::SPDPdiscoveredParticipantData changed_pdata = pdata;
+  changed_pdata.ddsParticipantData.user_data.value.length(1);
+  changed_pdata.ddsParticipantData.user_data.value[0] = 1;
+  OpenDDS::RTPS::ParameterList changed_plist;
+  if (!OpenDDS::RTPS::ParameterListConverter::to_param_list(changed_pdata, changed_plist)) {
+    ACE_ERROR((LM_ERROR, ACE_TEXT("(%P|%t) ERROR: ")
+      ACE_TEXT("spdp_transport - run_test - ")
+      ACE_TEXT("failed to convert from SPDPdiscoveredParticipantData ")
+      ACE_TEXT("to ParameterList\n")));
+    return false;
+  }
+  OpenDDS::RTPS::ParameterList* const plists[] = {&plist, &plist, &changed_plist, &changed_plist};
+  const size_t expected_unchanged[] = {0, 1, 1, 2};
+  const size_t unchanged_before = spdp->unchanged_announcements();
+  for (seq = first_seq; seq.low <= 4; ++seq.low) {
+    ACE_DEBUG((LM_DEBUG, ACE_TEXT("seq: %d\n"), seq.low));
+    if (!part1.send_data(test_part_guid.entityId, seq, *plists[seq.low - 1], send_addr)) {
+      return false;
+    }
+    reactor_wait();
+    if (spdp_friend.check_for_participant(true)) {
+      return false;
+    }
+    const size_t unchanged = spdp->unchanged_announcements() - unchanged_before;
+    if (unchanged != expected_unchanged[seq.low - 1]) {
+      ACE_ERROR((LM_ERROR, ACE_TEXT("ERROR: run_test() expected %B unchanged announcements, got %B\n"),
+                 expected_unchanged[seq.low - 1], unchanged));
+      return false;
+    }
+  }
+
   spdp->shutdown();
 
   return true;
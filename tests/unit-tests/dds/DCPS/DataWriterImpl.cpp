@@ -0,0 +1,136 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <dds/DCPS/DataWriterImpl.h>
+
+#include <dds/DCPS/GuidBuilder.h>
+#include <dds/DCPS/Service_Participant.h>
+
+#include <gtest/gtest.h>
+
+using namespace OpenDDS::DCPS;
+
+class DDS_TEST {
+public:
+  static void add_reader(DataWriterImpl& dw, const GUID_t& id)
+  {
+    ACE_GUARD(ACE_Thread_Mutex, guard, dw.reader_info_lock_);
+    dw.unshare_expected_sequence_i();
+    dw.reader_info_.insert(std::make_pair(id,
+      DataWriterImpl::ReaderInfo("", "", DDS::StringSeq(), WeakRcHandle<DomainParticipantImpl>(), false)));
+  }
+
+  /// Number the next sample and record which readers it went to, like write().
+  static void send(DataWriterImpl& dw, GUIDSeq* filter_out = 0)
+  {
+    dw.get_next_sn();
+    dw.track_sequence_number(filter_out);
+  }
+
+  /// Number the next sample without sending it to any reader.
+  static void drop(DataWriterImpl& dw)
+  {
+    dw.get_next_sn();
+  }
+
+  static bool need_sequence_repair(DataWriterImpl& dw)
+  {
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, dw.reader_info_lock_, false);
+    return dw.need_sequence_repair_i();
+  }
+
+  static bool shared(DataWriterImpl& dw)
+  {
+    ACE_GUARD_RETURN(ACE_Thread_Mutex, guard, dw.reader_info_lock_, false);
+    return dw.readers_share_expected_sequence_;
+  }
+};
+
+namespace {
+  GUID_t make_reader(long key)
+  {
+    GUID_t id = GUID_UNKNOWN;
+    GuidBuilder builder(id);
+    builder.guidPrefix0(1);
+    builder.entityKey(key);
+    builder.entityKind(ENTITYKIND_USER_READER_WITH_KEY);
+    return id;
+  }
+}
+
+TEST(dds_DCPS_DataWriterImpl, need_sequence_repair_shared)
+{
+  // Initialize the Service Participant for the DataWriterImpl ctor.
+  DDS::DomainParticipantFactory_var dpf = TheServiceParticipant->get_domain_participant_factory();
+  {
+    const RcHandle<DataWriterImpl> dw = make_rch<DataWriterImpl>();
+
+    // Nothing to repair without readers.
+    EXPECT_TRUE(DDS_TEST::shared(*dw));
+    EXPECT_FALSE(DDS_TEST::need_sequence_repair(*dw));
+    DDS_TEST::drop(*dw);
+    EXPECT_FALSE(DDS_TEST::need_sequence_repair(*dw));
+
+    DDS_TEST::add_reader(*dw, make_reader(1));
+    DDS_TEST::add_reader(*dw, make_reader(2));
+    EXPECT_FALSE(DDS_TEST::shared(*dw));
+
+    // A sample sent to every reader shares its sequence number again.
+    DDS_TEST::send(*dw);
+    EXPECT_TRUE(DDS_TEST::shared(*dw));
+    EXPECT_FALSE(DDS_TEST::need_sequence_repair(*dw));
+
+    // The readers missed a sequence number.
+    DDS_TEST::drop(*dw);
+    EXPECT_TRUE(DDS_TEST::shared(*dw));
+    EXPECT_TRUE(DDS_TEST::need_sequence_repair(*dw));
+
+    DDS_TEST::send(*dw);
+    EXPECT_FALSE(DDS_TEST::need_sequence_repair(*dw));
+  }
+  TheServiceParticipant->shutdown();
+}
+
+#ifndef OPENDDS_NO_CONTENT_FILTERED_TOPIC
+TEST(dds_DCPS_DataWriterImpl, need_sequence_repair_unshared)
+{
+  // Initialize the Service Participant for the DataWriterImpl ctor.
+  DDS::DomainParticipantFactory_var dpf = TheServiceParticipant->get_domain_participant_factory();
+  {
+    const RcHandle<DataWriterImpl> dw = make_rch<DataWriterImpl>();
+    const GUID_t reader1 = make_reader(1);
+    const GUID_t reader2 = make_reader(2);
+    DDS_TEST::add_reader(*dw, reader1);
+    DDS_TEST::add_reader(*dw, reader2);
+    DDS_TEST::send(*dw);
+    EXPECT_TRUE(DDS_TEST::shared(*dw));
+
+    // Filtering out a reader that isn't associated doesn't leave anyone behind.
+    GUIDSeq filter_out;
+    filter_out.length(1);
+    filter_out[0] = make_reader(3);
+    DDS_TEST::send(*dw, &filter_out);
+    EXPECT_FALSE(DDS_TEST::shared(*dw));
+    EXPECT_FALSE(DDS_TEST::need_sequence_repair(*dw));
+
+    // reader2 filtered out the sample, so it expects an older sequence number.
+    filter_out[0] = reader2;
+    DDS_TEST::send(*dw, &filter_out);
+    EXPECT_FALSE(DDS_TEST::shared(*dw));
+    EXPECT_TRUE(DDS_TEST::need_sequence_repair(*dw));
+
+    // So does reader1 once reader2 gets one it doesn't.
+    filter_out[0] = reader1;
+    DDS_TEST::send(*dw, &filter_out);
+    EXPECT_TRUE(DDS_TEST::need_sequence_repair(*dw));
+
+    // A sample sent to every reader catches them all up.
+    DDS_TEST::send(*dw);
+    EXPECT_TRUE(DDS_TEST::shared(*dw));
+    EXPECT_FALSE(DDS_TEST::need_sequence_repair(*dw));
+  }
+  TheServiceParticipant->shutdown();
+}
+#endif
@@ -0,0 +1,45 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/Hash.h>
+
+#include <ace/Message_Block.h>
+
+#include <cstring>
+
+using namespace OpenDDS::DCPS;
+
+TEST(dds_DCPS_Hash, MD5Hash_message_block_chain)
+{
+  const char text[] = "The quick brown fox jumps over the lazy dog";
+  const size_t size = sizeof text - 1;
+
+  MD5Result expected;
+  MD5Hash(expected, text, size);
+
+  ACE_Message_Block first(10);
+  ACE_Message_Block second(size);
+  first.copy(text, 10);
+  second.copy(text + 10, size - 10);
+  first.cont(&second);
+
+  MD5Result result;
+  MD5Hash(result, first, size);
+  EXPECT_EQ(std::memcmp(result, expected, sizeof result), 0);
+
+  // Only size bytes are hashed.
+  MD5Hash(expected, text, 20);
+  MD5Hash(result, first, 20);
+  EXPECT_EQ(std::memcmp(result, expected, sizeof result), 0);
+
+  // A short chain hashes what it has.
+  MD5Hash(result, first, size + 10);
+  MD5Hash(expected, text, size);
+  EXPECT_EQ(std::memcmp(result, expected, sizeof result), 0);
+
+  first.cont(0);
+}
@@ -0,0 +1,118 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/Histogram.h>
+
+using namespace OpenDDS::DCPS;
+
+TEST(dds_DCPS_Histogram, bucket_layout)
+{
+  const unsigned int bits = 3;
+  // Values below 2^bits get a bucket each.
+  for (ACE_UINT64 value = 0; value < 8; ++value) {
+    EXPECT_EQ(Histogram::bucket_index(value, bits, 64), value);
+  }
+
+  // Every value lands in a bucket that contains it, and buckets are
+  // contiguous.
+  ACE_UINT64 expected_low = 0;
+  for (size_t index = 0; index < Histogram::bucket_count(bits, 16); ++index) {
+    const ACE_UINT64 low = Histogram::bucket_lowest(index, bits);
+    const ACE_UINT64 high = Histogram::bucket_highest(index, bits);
+    EXPECT_EQ(low, expected_low);
+    EXPECT_LE(low, high);
+    EXPECT_EQ(Histogram::bucket_index(low, bits, 16), index);
+    EXPECT_EQ(Histogram::bucket_index(high, bits, 16), index);
+    // Relative width is bounded by the sub bucket bits.
+    EXPECT_LE((high - low) * 8, low);
+    expected_low = high + 1;
+  }
+  EXPECT_EQ(expected_low, ACE_UINT64(1) << 16);
+
+  // Values that are too large are counted in the last bucket.
+  EXPECT_EQ(Histogram::bucket_index(ACE_UINT64(1) << 20, bits, 16), Histogram::bucket_count(bits, 16) - 1);
+  EXPECT_EQ(Histogram::bucket_index(~ACE_UINT64(0), bits, 64), Histogram::bucket_count(bits, 64) - 1);
+}
+
+TEST(dds_DCPS_Histogram, empty)
+{
+  Histogram histogram;
+  HistogramSnapshot snapshot;
+  histogram.snapshot(snapshot);
+
+  EXPECT_EQ(snapshot.count(), 0u);
+  EXPECT_EQ(snapshot.minimum(), 0u);
+  EXPECT_EQ(snapshot.maximum(), 0u);
+  EXPECT_EQ(snapshot.mean(), 0.0);
+  EXPECT_EQ(snapshot.variance(), 0.0);
+  EXPECT_EQ(snapshot.value_at_percentile(99.0), 0u);
+}
+
+TEST(dds_DCPS_Histogram, percentiles)
+{
+  Histogram histogram;
+  for (ACE_UINT64 value = 1; value <= 10000; ++value) {
+    histogram.record(value);
+  }
+
+  HistogramSnapshot snapshot;
+  histogram.snapshot(snapshot);
+
+  EXPECT_EQ(snapshot.count(), 10000u);
+  EXPECT_EQ(snapshot.minimum(), 1u);
+  EXPECT_EQ(snapshot.maximum(), 10000u);
+  EXPECT_EQ(snapshot.mean(), 5000.5);
+  EXPECT_NEAR(snapshot.variance(), (10000.0 * 10000.0 - 1) / 12, 0.05 * (10000.0 * 10000.0) / 12);
+
+  EXPECT_NEAR(static_cast<double>(snapshot.value_at_percentile(50.0)), 5000.0, 5000.0 / 32);
+  EXPECT_NEAR(static_cast<double>(snapshot.value_at_percentile(90.0)), 9000.0, 9000.0 / 32);
+  EXPECT_NEAR(static_cast<double>(snapshot.value_at_percentile(99.0)), 9900.0, 9900.0 / 32);
+  EXPECT_GE(snapshot.value_at_percentile(99.9), snapshot.value_at_percentile(99.0));
+  EXPECT_EQ(snapshot.value_at_percentile(100.0), 10000u);
+  EXPECT_EQ(snapshot.value_at_percentile(0.0), 1u);
+
+  histogram.reset();
+  histogram.snapshot(snapshot);
+  EXPECT_EQ(snapshot.count(), 0u);
+}
+
+TEST(dds_DCPS_Histogram, merge)
+{
+  Histogram low;
+  Histogram high;
+  for (ACE_UINT64 value = 1; value <= 100; ++value) {
+    low.record(value);
+    high.record(value + 1000);
+  }
+
+  HistogramSnapshot merged;
+  HistogramSnapshot snapshot;
+  low.snapshot(snapshot);
+  EXPECT_TRUE(merged.merge(snapshot));
+  high.snapshot(snapshot);
+  EXPECT_TRUE(merged.merge(snapshot));
+
+  EXPECT_EQ(merged.count(), 200u);
+  EXPECT_EQ(merged.minimum(), 1u);
+  EXPECT_EQ(merged.maximum(), 1100u);
+  EXPECT_LT(merged.value_at_percentile(50.0), 1000u);
+  EXPECT_GE(merged.value_at_percentile(51.0), 1000u);
+
+  Histogram other_layout(4, 32);
+  other_layout.record(1);
+  other_layout.snapshot(snapshot);
+  EXPECT_FALSE(merged.merge(snapshot));
+  EXPECT_EQ(merged.count(), 200u);
+
+  HistogramSnapshot rebuilt(Histogram::DEFAULT_SUB_BUCKET_BITS, 64);
+  for (size_t i = 0; i < merged.counts().size(); ++i) {
+    EXPECT_TRUE(rebuilt.add_bucket(i, merged.counts()[i]));
+  }
+  EXPECT_FALSE(rebuilt.add_bucket(merged.counts().size(), 1));
+  EXPECT_EQ(rebuilt.count(), merged.count());
+  EXPECT_EQ(rebuilt.value_at_percentile(90.0), merged.value_at_percentile(90.0));
+}
@@ -0,0 +1,96 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/IntrusiveList.h>
+#include <dds/DCPS/RcObject.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct Element : RcObject {
+    explicit Element(int v)
+      : value(v)
+    {}
+
+    int value;
+    IntrusiveListLinks<Element> links;
+  };
+
+  typedef IntrusiveList<Element, &Element::links> List;
+
+  struct ValueLess {
+    bool operator()(const Element& a, const Element& b) const
+    {
+      return a.value < b.value;
+    }
+  };
+
+  void expect_values(const List& list, const int* values, size_t count)
+  {
+    ASSERT_EQ(list.size(), count);
+    const Element* e = list.front();
+    for (size_t i = 0; i < count; ++i, e = List::next(e)) {
+      ASSERT_TRUE(e);
+      EXPECT_EQ(e->value, values[i]);
+    }
+    EXPECT_FALSE(e);
+
+    e = list.back();
+    for (size_t i = count; i > 0; --i, e = List::prev(e)) {
+      ASSERT_TRUE(e);
+      EXPECT_EQ(e->value, values[i - 1]);
+    }
+    EXPECT_FALSE(e);
+  }
+}
+
+TEST(dds_DCPS_IntrusiveList, push_remove)
+{
+  const RcHandle<Element> one = make_rch<Element>(1);
+  const RcHandle<Element> two = make_rch<Element>(2);
+  const RcHandle<Element> three = make_rch<Element>(3);
+
+  List list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_FALSE(list.pop_front());
+
+  list.push_back(one);
+  list.push_back(two);
+  list.push_back(three);
+  EXPECT_TRUE(List::is_linked(two.in()));
+  // The list holds a reference to each element.
+  EXPECT_EQ(two->ref_count(), 2);
+  const int all[] = { 1, 2, 3 };
+  expect_values(list, all, 3);
+
+  EXPECT_EQ(list.remove(two.in()), two);
+  EXPECT_FALSE(List::is_linked(two.in()));
+  EXPECT_EQ(two->ref_count(), 1);
+  EXPECT_FALSE(list.remove(two.in()));
+  const int ends[] = { 1, 3 };
+  expect_values(list, ends, 2);
+
+  list.move_to_back(one.in());
+  const int moved[] = { 3, 1 };
+  expect_values(list, moved, 2);
+
+  EXPECT_EQ(list.pop_front(), three);
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(one->ref_count(), 1);
+}
+
+TEST(dds_DCPS_IntrusiveList, insert_sorted)
+{
+  List list;
+  const int inserted[] = { 2, 4, 3, 5, 1, 4 };
+  for (size_t i = 0; i < sizeof inserted / sizeof inserted[0]; ++i) {
+    list.insert_sorted(make_rch<Element>(inserted[i]), ValueLess());
+  }
+  const int sorted[] = { 1, 2, 3, 4, 4, 5 };
+  expect_values(list, sorted, 6);
+}
@@ -0,0 +1,89 @@
+#include <dds/DCPS/MpscQueue.h>
+
+#include <gtest/gtest.h>
+
+#ifdef ACE_HAS_CPP11
+#include <thread>
+#include <vector>
+#endif
+
+using namespace OpenDDS::DCPS;
+
+TEST(dds_DCPS_MpscQueue, push_take_all)
+{
+  MpscQueue<int> queue;
+  MpscQueue<int>::Batch batch;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.take_all(batch));
+
+  // Only the first push after the queue is emptied reports it was empty.
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_FALSE(queue.push(2));
+  EXPECT_FALSE(queue.push(3));
+  EXPECT_FALSE(queue.empty());
+
+  batch.push_back(0);
+  EXPECT_TRUE(queue.take_all(batch));
+  ASSERT_EQ(batch.size(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(batch[i], i);
+  }
+  EXPECT_TRUE(queue.empty());
+
+  EXPECT_TRUE(queue.push(4));
+  batch.clear();
+  EXPECT_TRUE(queue.take_all(batch));
+  ASSERT_EQ(batch.size(), 1u);
+  EXPECT_EQ(batch[0], 4);
+
+  // Whatever is left is released with the queue.
+  queue.push(5);
+}
+
+#ifdef ACE_HAS_CPP11
+TEST(dds_DCPS_MpscQueue, concurrent_producers)
+{
+  const int producers = 4;
+  const int count = 10000;
+  MpscQueue<int> queue;
+
+  std::vector<std::thread> threads;
+  std::vector<int> edges(producers);
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p]() {
+      for (int i = 0; i < count; ++i) {
+        if (queue.push(p * count + i)) {
+          ++edges[p];
+        }
+      }
+    });
+  }
+
+  // Each producer's values come out in the order they were pushed and a
+  // batch is taken after every push that found the queue empty.
+  std::vector<int> next(producers);
+  int total = 0;
+  int batches = 0;
+  while (total < producers * count) {
+    MpscQueue<int>::Batch batch;
+    if (queue.take_all(batch)) {
+      ++batches;
+    }
+    for (size_t i = 0; i < batch.size(); ++i) {
+      const int p = batch[i] / count;
+      EXPECT_EQ(batch[i] % count, next[p]++);
+    }
+    total += static_cast<int>(batch.size());
+  }
+
+  for (size_t t = 0; t < threads.size(); ++t) {
+    threads[t].join();
+  }
+  int total_edges = 0;
+  for (int p = 0; p < producers; ++p) {
+    total_edges += edges[p];
+  }
+  EXPECT_EQ(total_edges, batches);
+  EXPECT_TRUE(queue.empty());
+}
+#endif
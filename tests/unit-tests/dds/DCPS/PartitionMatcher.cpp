@@ -0,0 +1,163 @@
+#include <dds/DCPS/PartitionMatcher.h>
+
+#include <dds/DCPS/DCPS_Utils.h>
+
+#include <ace/ACE.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  bool wild(const char* pattern, const char* name)
+  {
+    return PartitionPattern(pattern).matches(name);
+  }
+
+  // How partition names were matched before PartitionPattern.
+  bool baseline(const char* pattern, const char* name)
+  {
+    return is_wildcard(pattern) ? ACE::wild_match(name, pattern, true, true) : std::strcmp(pattern, name) == 0;
+  }
+
+  void append_all(OPENDDS_VECTOR(String)& out, const char* const parts[], size_t count, size_t max_parts)
+  {
+    OPENDDS_VECTOR(String) last(1);
+    out.push_back(String());
+    for (size_t n = 0; n < max_parts; ++n) {
+      OPENDDS_VECTOR(String) next;
+      for (size_t i = 0; i < last.size(); ++i) {
+        for (size_t j = 0; j < count; ++j) {
+          next.push_back(last[i] + parts[j]);
+        }
+      }
+      out.insert(out.end(), next.begin(), next.end());
+      last.swap(next);
+    }
+  }
+
+  DDS::PartitionQosPolicy make_partition(const char* a = 0, const char* b = 0)
+  {
+    DDS::PartitionQosPolicy partition;
+    if (a) {
+      partition.name.length(1);
+      partition.name[0] = a;
+    }
+    if (b) {
+      partition.name.length(2);
+      partition.name[1] = b;
+    }
+    return partition;
+  }
+}
+
+TEST(dds_DCPS_PartitionMatcher, literal)
+{
+  const PartitionPattern pattern("abc");
+  EXPECT_FALSE(pattern.wildcard());
+  EXPECT_TRUE(pattern.matches("abc"));
+  EXPECT_FALSE(pattern.matches("ab"));
+  EXPECT_FALSE(pattern.matches("abcd"));
+  // Escaped wildcards aren't wildcards and the name is compared as is.
+  EXPECT_TRUE(wild("a\\*", "a\\*"));
+  EXPECT_FALSE(wild("a\\*", "a*"));
+}
+
+TEST(dds_DCPS_PartitionMatcher, star_and_question_mark)
+{
+  EXPECT_TRUE(wild("*", ""));
+  EXPECT_TRUE(wild("*", "anything"));
+  EXPECT_TRUE(wild("a*", "a"));
+  EXPECT_TRUE(wild("a*c", "abbbc"));
+  EXPECT_FALSE(wild("a*c", "abbbd"));
+  EXPECT_TRUE(wild("*ab*ab", "xabyabab"));
+  EXPECT_TRUE(wild("a**b", "ab"));
+  EXPECT_TRUE(wild("a?c", "abc"));
+  EXPECT_FALSE(wild("a?c", "ac"));
+  EXPECT_TRUE(wild("?*?", "ab"));
+  EXPECT_FALSE(wild("?*?", "a"));
+  EXPECT_TRUE(wild("a\\?*", "a?b"));
+  EXPECT_FALSE(wild("a\\?*", "ab"));
+}
+
+TEST(dds_DCPS_PartitionMatcher, character_classes)
+{
+  EXPECT_TRUE(wild("[abc]x", "bx"));
+  EXPECT_FALSE(wild("[abc]x", "dx"));
+  EXPECT_TRUE(wild("[a-c]*", "c1"));
+  EXPECT_FALSE(wild("[a-c]*", "d1"));
+  EXPECT_TRUE(wild("[!a-c]*", "d1"));
+  EXPECT_FALSE(wild("[!a-c]*", "a1"));
+  EXPECT_TRUE(wild("[]]", "]"));
+  EXPECT_TRUE(wild("[a-]", "-"));
+}
+
+TEST(dds_DCPS_PartitionMatcher, malformed)
+{
+  // Left to ACE::wild_match().
+  EXPECT_TRUE(PartitionPattern("[ab*").malformed());
+  EXPECT_TRUE(PartitionPattern("a*[").malformed());
+  EXPECT_TRUE(PartitionPattern("a*\\").malformed());
+  EXPECT_FALSE(PartitionPattern("a*\\[").malformed());
+  EXPECT_FALSE(PartitionPattern("[ab]*").malformed());
+  EXPECT_FALSE(PartitionPattern("a\\").malformed());
+  EXPECT_EQ(wild("[ab*", "[abc"), baseline("[ab*", "[abc"));
+  EXPECT_EQ(wild("[ab*", "abc"), baseline("[ab*", "abc"));
+}
+
+TEST(dds_DCPS_PartitionMatcher, same_as_wild_match)
+{
+  // Every pattern of up to three of these parts, against every name of up to
+  // four characters, including patterns with a "[" without a "]" or a
+  // trailing "\\".
+  static const char* const pattern_parts[] = {
+    "a", "b", "*", "?", "[ab]", "[!a]", "[a-b]", "[]a]", "\\*", "\\?", "\\[", "\\a",
+    "[", "[a", "\\"
+  };
+  static const char* const name_parts[] = {"a", "b", "c", "*", "?", "["};
+
+  OPENDDS_VECTOR(String) patterns;
+  append_all(patterns, pattern_parts, sizeof pattern_parts / sizeof pattern_parts[0], 3);
+  OPENDDS_VECTOR(String) names;
+  append_all(names, name_parts, sizeof name_parts / sizeof name_parts[0], 4);
+
+  size_t wildcards = 0;
+  for (size_t p = 0; p < patterns.size(); ++p) {
+    const PartitionPattern pattern(patterns[p].c_str());
+    wildcards += pattern.wildcard();
+    for (size_t n = 0; n < names.size(); ++n) {
+      ASSERT_EQ(pattern.matches(names[n].c_str()), baseline(patterns[p].c_str(), names[n].c_str()))
+        << "pattern \"" << patterns[p] << "\" name \"" << names[n] << '"';
+    }
+  }
+  EXPECT_GT(wildcards, patterns.size() / 2);
+}
+
+TEST(dds_DCPS_PartitionMatcher, pairs)
+{
+  const PartitionPattern wildcard("a*");
+  EXPECT_TRUE(wildcard.matches(PartitionPattern("ab")));
+  EXPECT_TRUE(PartitionPattern("ab").matches(wildcard));
+  EXPECT_FALSE(wildcard.matches(PartitionPattern("a?")));
+}
+
+TEST(dds_DCPS_PartitionMatcher, partitions)
+{
+  PartitionMatcher matcher;
+  EXPECT_TRUE(matcher.matches(make_partition(), make_partition()));
+  EXPECT_TRUE(matcher.matches(make_partition(), make_partition("")));
+  EXPECT_TRUE(matcher.matches(make_partition(""), make_partition("x", "")));
+  EXPECT_TRUE(matcher.matches(make_partition(), make_partition("*")));
+  EXPECT_FALSE(matcher.matches(make_partition(), make_partition("x")));
+  EXPECT_FALSE(matcher.matches(make_partition("x"), make_partition()));
+  EXPECT_TRUE(matcher.matches(make_partition("x", "y"), make_partition("y")));
+  EXPECT_TRUE(matcher.matches(make_partition("a*"), make_partition("z", "abc")));
+  EXPECT_FALSE(matcher.matches(make_partition("a*"), make_partition("a?")));
+  EXPECT_EQ(matcher.verdict_hits(), 0u);
+
+  EXPECT_TRUE(matcher.matches(make_partition("a*"), make_partition("z", "abc")));
+  EXPECT_EQ(matcher.verdict_hits(), 1u);
+  EXPECT_EQ(matcher.verdict_misses(), 9u);
+}
@@ -0,0 +1,116 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/RTPS/DiscoveryCache.h>
+
+#include <ace/OS_NS_stdio.h>
+#include <ace/OS_NS_unistd.h>
+
+#include <fstream>
+
+using namespace OpenDDS;
+using namespace OpenDDS::DCPS;
+using OpenDDS::RTPS::DiscoveryCache;
+
+namespace {
+  const char path[] = "DiscoveryCache.test";
+
+  GUID_t make_guid(unsigned char participant)
+  {
+    GUID_t id = GUID_UNKNOWN;
+    id.guidPrefix[0] = participant;
+    id.entityId = ENTITYID_PARTICIPANT;
+    return id;
+  }
+
+  XTypes::TypeObject make_type_object(XTypes::MemberId id)
+  {
+    return XTypes::TypeObject(XTypes::MinimalTypeObject(XTypes::MinimalStructType(XTypes::IS_APPENDABLE, XTypes::MinimalStructHeader(XTypes::TypeIdentifier(XTypes::TK_NONE), XTypes::MinimalTypeDetail()), XTypes::MinimalStructMemberSeq().append(XTypes::MinimalStructMember(XTypes::CommonStructMember(id, XTypes::TRY_CONSTRUCT1, XTypes::TypeIdentifier(XTypes::TK_INT32)), XTypes::MinimalMemberDetail(60, 110, 11, 138))))));
+  }
+}
+
+TEST(dds_DCPS_RTPS_DiscoveryCache, round_trip)
+{
+  const SystemTimePoint now = SystemTimePoint::now();
+  ACE_OS::unlink(path);
+
+  DiscoveryCache saved;
+  DiscoveryCache::Participant& live = saved.participants[make_guid(1)];
+  live.address = NetworkAddress(7410, "127.0.0.1");
+  live.expires = now + TimeDuration(100);
+  DiscoveryCache::Participant& expired = saved.participants[make_guid(2)];
+  expired.address = NetworkAddress(7412, "127.0.0.1");
+  expired.expires = now - TimeDuration(1);
+
+  const XTypes::TypeObject good = make_type_object(0);
+  saved.types.append(XTypes::TypeIdentifierTypeObjectPair(XTypes::makeTypeIdentifier(good), good));
+  // Identifier of a different type object, as if the type had changed.
+  saved.types.append(XTypes::TypeIdentifierTypeObjectPair(XTypes::makeTypeIdentifier(make_type_object(1)), good));
+
+  ASSERT_TRUE(saved.save(path, now, make_guid(9)));
+
+  DiscoveryCache loaded;
+  ASSERT_TRUE(loaded.load(path, now));
+  ACE_OS::unlink(path);
+
+  ASSERT_EQ(loaded.participants.size(), 1u);
+  const DiscoveryCache::ParticipantMap::const_iterator it = loaded.participants.find(make_guid(1));
+  ASSERT_TRUE(it != loaded.participants.end());
+  EXPECT_EQ(it->second.address, live.address);
+  EXPECT_EQ(it->second.expires.to_dds_time().sec, live.expires.to_dds_time().sec);
+
+  ASSERT_EQ(loaded.types.length(), 1u);
+  EXPECT_EQ(loaded.types[0].type_identifier, saved.types[0].type_identifier);
+  EXPECT_EQ(loaded.types[0].type_object, good);
+}
+
+TEST(dds_DCPS_RTPS_DiscoveryCache, missing_or_invalid)
+{
+  DiscoveryCache cache;
+  cache.participants[make_guid(1)].expires = SystemTimePoint::now() + TimeDuration(100);
+  EXPECT_FALSE(cache.load("DiscoveryCache.missing", SystemTimePoint::now()));
+  EXPECT_TRUE(cache.participants.empty());
+
+  FILE* const file = ACE_OS::fopen(path, "wb");
+  ASSERT_TRUE(file);
+  ACE_OS::fputs("not a cache", file);
+  ACE_OS::fclose(file);
+  EXPECT_FALSE(cache.load(path, SystemTimePoint::now()));
+  ACE_OS::unlink(path);
+}
+
+TEST(dds_DCPS_RTPS_DiscoveryCache, shared_file)
+{
+  const SystemTimePoint now = SystemTimePoint::now();
+  ACE_OS::unlink(path);
+
+  // Two participants save to the same file.
+  DiscoveryCache first;
+  first.participants[make_guid(1)].address = NetworkAddress(7410, "127.0.0.1");
+  first.participants[make_guid(1)].expires = now + TimeDuration(100);
+  first.participants[make_guid(3)].address = NetworkAddress(7414, "127.0.0.1");
+  first.participants[make_guid(3)].expires = now + TimeDuration(10);
+  ASSERT_TRUE(first.save(path, now, make_guid(1)));
+
+  DiscoveryCache second;
+  second.participants[make_guid(2)].address = NetworkAddress(7412, "127.0.0.1");
+  second.participants[make_guid(2)].expires = now + TimeDuration(100);
+  second.participants[make_guid(3)].address = NetworkAddress(7416, "127.0.0.1");
+  second.participants[make_guid(3)].expires = now + TimeDuration(50);
+  ASSERT_TRUE(second.save(path, now, make_guid(2)));
+
+  // The file has both, with the later lease for the participant they share.
+  DiscoveryCache loaded;
+  ASSERT_TRUE(loaded.load(path, now));
+  ACE_OS::unlink(path);
+  EXPECT_EQ(loaded.participants.size(), 3u);
+  EXPECT_EQ(loaded.participants[make_guid(3)].address, NetworkAddress(7416, "127.0.0.1"));
+
+  // The temporary files were renamed.
+  EXPECT_FALSE(std::ifstream("DiscoveryCache.test.010000000000000000000000"));
+  EXPECT_FALSE(std::ifstream("DiscoveryCache.test.020000000000000000000000"));
+}
@@ -0,0 +1,372 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/RTPS/EndpointMatchIndex.h>
+
+#include <dds/DCPS/DCPS_Utils.h>
+#include <dds/DCPS/Service_Participant.h>
+
+using namespace OpenDDS::DCPS;
+using OpenDDS::RTPS::EndpointMatchIndex;
+
+namespace {
+  GUID_t make_guid(unsigned char participant, unsigned char key, bool reader)
+  {
+    GUID_t id = GUID_UNKNOWN;
+    id.guidPrefix[0] = participant;
+    id.entityId.entityKey[2] = key;
+    id.entityId.entityKind = reader ? ENTITYKIND_USER_READER_WITH_KEY : ENTITYKIND_USER_WRITER_WITH_KEY;
+    return id;
+  }
+
+  DDS::PartitionQosPolicy make_partition(const char* a = 0, const char* b = 0)
+  {
+    DDS::PartitionQosPolicy partition;
+    if (a) {
+      partition.name.length(1);
+      partition.name[0] = a;
+    }
+    if (b) {
+      partition.name.length(2);
+      partition.name[1] = b;
+    }
+    return partition;
+  }
+
+  TransportLocatorSeq make_locators(const char* transport_type)
+  {
+    TransportLocatorSeq tls;
+    tls.length(1);
+    tls[0].transport_type = transport_type;
+    return tls;
+  }
+
+  IncompatibleQosStatus make_status()
+  {
+    IncompatibleQosStatus status = {0, 0, 0, DDS::QosPolicyCountSeq()};
+    return status;
+  }
+
+  struct Endpoints {
+    Endpoints()
+      : writer_qos(TheServiceParticipant->initial_DataWriterQos())
+      , reader_qos(TheServiceParticipant->initial_DataReaderQos())
+      , pub_qos(TheServiceParticipant->initial_PublisherQos())
+      , sub_qos(TheServiceParticipant->initial_SubscriberQos())
+      , rtps(make_locators("rtps_udp"))
+    {
+      writer_qos.representation.value.length(1);
+      writer_qos.representation.value[0] = DDS::XCDR2_DATA_REPRESENTATION;
+      reader_qos.representation.value = writer_qos.representation.value;
+    }
+
+    void writer(const GUID_t& id, const char* topic, bool local,
+                const DDS::PartitionQosPolicy& partition)
+    {
+      pub_qos.partition = partition;
+      index.insert(id, topic, local, writer_qos, pub_qos, rtps);
+    }
+
+    void reader(const GUID_t& id, const char* topic, bool local,
+                const DDS::PartitionQosPolicy& partition)
+    {
+      sub_qos.partition = partition;
+      index.insert(id, topic, local, reader_qos, sub_qos, rtps);
+    }
+
+    EndpointMatchIndex index;
+    DDS::DataWriterQos writer_qos;
+    DDS::DataReaderQos reader_qos;
+    DDS::PublisherQos pub_qos;
+    DDS::SubscriberQos sub_qos;
+    TransportLocatorSeq rtps;
+  };
+}
+
+TEST(dds_DCPS_RTPS_EndpointMatchIndex, candidates)
+{
+  Endpoints e;
+  const GUID_t w_default = make_guid(1, 1, false);
+  const GUID_t w_a = make_guid(1, 2, false);
+  const GUID_t w_wild = make_guid(1, 3, false);
+  const GUID_t w_ab = make_guid(1, 4, false);
+  const GUID_t w_remote = make_guid(2, 1, false);
+  const GUID_t w_other_topic = make_guid(1, 5, false);
+  const GUID_t reader = make_guid(1, 6, true);
+
+  e.writer(w_default, "T", true, make_partition());
+  e.writer(w_a, "T", true, make_partition("A"));
+  e.writer(w_wild, "T", true, make_partition("B", "A*"));
+  e.writer(w_ab, "T", true, make_partition("AB"));
+  e.writer(w_remote, "T", false, make_partition("A"));
+  e.writer(w_other_topic, "U", true, make_partition("A"));
+
+  EXPECT_EQ(e.index.count("T", false, true), 4u);
+  EXPECT_EQ(e.index.count("T", false, false), 1u);
+  EXPECT_EQ(e.index.count("T", true, true), 0u);
+
+  e.reader(reader, "T", true, make_partition("A"));
+  EXPECT_EQ(e.index.count("T", true, true), 1u);
+  RepoIdSet result;
+  e.index.candidates(reader, true, result);
+  EXPECT_EQ(result.size(), 2u);
+  EXPECT_TRUE(result.count(w_a));
+  EXPECT_TRUE(result.count(w_wild));
+
+  e.reader(reader, "T", true, make_partition(""));
+  result.clear();
+  e.index.candidates(reader, true, result);
+  EXPECT_EQ(result.size(), 1u);
+  EXPECT_TRUE(result.count(w_default));
+
+  e.reader(reader, "T", true, make_partition("A?"));
+  result.clear();
+  e.index.candidates(reader, true, result);
+  EXPECT_EQ(result.size(), 1u);
+  EXPECT_TRUE(result.count(w_ab));
+
+  e.reader(reader, "T", true, make_partition("A"));
+  result.clear();
+  e.index.candidates(reader, false, result);
+  EXPECT_EQ(result.size(), 1u);
+  EXPECT_TRUE(result.count(w_remote));
+
+  // Moving to another partition replaces the old one.
+  e.writer(w_a, "T", true, make_partition("C"));
+  result.clear();
+  e.index.candidates(reader, true, result);
+  EXPECT_EQ(result.size(), 1u);
+  EXPECT_TRUE(result.count(w_wild));
+  EXPECT_EQ(e.index.count("T", false, true), 4u);
+
+  e.index.remove(w_wild);
+  e.index.remove(w_wild);
+  result.clear();
+  e.index.candidates(reader, true, result);
+  EXPECT_TRUE(result.empty());
+  EXPECT_EQ(e.index.count("T", false, true), 3u);
+}
+
+TEST(dds_DCPS_RTPS_EndpointMatchIndex, candidates_superset_of_matching_partitions)
+{
+  const char* names[] = {0, "", "A", "B", "A*", "?", "[AB]", "*"};
+  const size_t count = sizeof names / sizeof names[0];
+
+  for (size_t w = 0; w < count; ++w) {
+    for (size_t r = 0; r < count; ++r) {
+      Endpoints e;
+      const GUID_t writer = make_guid(1, 1, false);
+      const GUID_t reader = make_guid(1, 2, true);
+      const DDS::PartitionQosPolicy pub = names[w] ? make_partition(names[w]) : make_partition();
+      const DDS::PartitionQosPolicy sub = names[r] ? make_partition(names[r]) : make_partition();
+      e.writer(writer, "T", true, pub);
+      e.reader(reader, "T", true, sub);
+
+      RepoIdSet result;
+      e.index.candidates(reader, true, result);
+      if (matching_partitions(pub, sub)) {
+        EXPECT_EQ(result.size(), 1u) << w << ' ' << r;
+      }
+      result.clear();
+      e.index.candidates(writer, true, result);
+      if (matching_partitions(pub, sub)) {
+        EXPECT_EQ(result.size(), 1u) << w << ' ' << r;
+      }
+    }
+  }
+}
+
+TEST(dds_DCPS_RTPS_EndpointMatchIndex, candidates_with_incompatible_qos)
+{
+  // Endpoints in other partitions are still candidates if their QoS or
+  // transports are incompatible, so that it is reported.
+  Endpoints e;
+  const GUID_t compatible = make_guid(1, 1, false);
+  const GUID_t best_effort = make_guid(1, 2, false);
+  const GUID_t tcp = make_guid(1, 3, false);
+  const GUID_t reader = make_guid(2, 1, true);
+
+  e.writer(compatible, "T", true, make_partition("A"));
+  e.writer_qos.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+  e.writer(best_effort, "T", true, make_partition("A"));
+  e.writer_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  e.pub_qos.partition = make_partition("A");
+  e.index.insert(tcp, "T", true, e.writer_qos, e.pub_qos, make_locators("tcp"));
+
+  e.reader_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  e.reader(reader, "T", false, make_partition("B"));
+
+  RepoIdSet result;
+  e.index.candidates(reader, true, result);
+  EXPECT_EQ(result.size(), 2u);
+  EXPECT_TRUE(result.count(best_effort));
+  EXPECT_TRUE(result.count(tcp));
+
+  // Matching them reports the same status as DCPS::compatibleQOS().
+  DDS::PublisherQos pub_qos = e.pub_qos;
+  DDS::DataWriterQos writer_qos = e.writer_qos;
+  writer_qos.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+  IncompatibleQosStatus expected_writer = make_status();
+  IncompatibleQosStatus expected_reader = make_status();
+  EXPECT_FALSE(compatibleQOS(&expected_writer, &expected_reader, e.rtps, e.rtps,
+                             &writer_qos, &e.reader_qos, &pub_qos, &e.sub_qos));
+  IncompatibleQosStatus writer_status = make_status();
+  IncompatibleQosStatus reader_status = make_status();
+  EXPECT_FALSE(e.index.compatible(best_effort, reader, writer_status, reader_status, e.rtps, e.rtps,
+                                  writer_qos, e.reader_qos, pub_qos, e.sub_qos));
+  EXPECT_EQ(writer_status.total_count, expected_writer.total_count);
+  EXPECT_EQ(reader_status.total_count, expected_reader.total_count);
+  EXPECT_EQ(reader_status.last_policy_id, DDS::RELIABILITY_QOS_POLICY_ID);
+
+  // The writer's side sees the reader the same way.
+  result.clear();
+  e.index.candidates(best_effort, false, result);
+  EXPECT_TRUE(result.count(reader));
+  result.clear();
+  e.index.candidates(compatible, false, result);
+  EXPECT_TRUE(result.empty());
+}
+
+TEST(dds_DCPS_RTPS_EndpointMatchIndex, candidates_checked_per_group)
+{
+  // Endpoints in other partitions are checked once per profile and
+  // transports, not once per endpoint.
+  Endpoints e;
+  const unsigned char writers = 100;
+  for (unsigned char key = 1; key <= writers; ++key) {
+    e.writer(make_guid(1, key, false), "T", true, make_partition("A"));
+  }
+  const GUID_t reader = make_guid(2, 1, true);
+  e.reader(reader, "T", false, make_partition("B"));
+
+  RepoIdSet result;
+  e.index.candidates(reader, true, result);
+  EXPECT_TRUE(result.empty());
+  EXPECT_EQ(e.index.verdict_hits() + e.index.verdict_misses(), 1u);
+
+  // A writer whose transports changed is in a group of its own.
+  const GUID_t tcp = make_guid(1, 1, false);
+  IncompatibleQosStatus writer_status = make_status();
+  IncompatibleQosStatus reader_status = make_status();
+  EXPECT_FALSE(e.index.compatible(tcp, reader, writer_status, reader_status,
+                                  make_locators("tcp"), e.rtps,
+                                  e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos));
+  e.index.candidates(reader, true, result);
+  EXPECT_EQ(result.size(), 1u);
+  EXPECT_TRUE(result.count(tcp));
+
+  // And goes back when they do.
+  e.index.compatible(tcp, reader, writer_status, reader_status, e.rtps, e.rtps,
+                     e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos);
+  result.clear();
+  e.index.candidates(reader, true, result);
+  EXPECT_TRUE(result.empty());
+  e.index.remove(tcp);
+  EXPECT_EQ(e.index.count("T", false, true), writers - 1u);
+}
+
+TEST(dds_DCPS_RTPS_EndpointMatchIndex, compatible)
+{
+  Endpoints e;
+  const GUID_t writer1 = make_guid(1, 1, false);
+  const GUID_t writer2 = make_guid(1, 2, false);
+  const GUID_t reader = make_guid(2, 1, true);
+  e.writer(writer1, "T", true, make_partition());
+  e.writer(writer2, "T", true, make_partition());
+  e.reader(reader, "T", false, make_partition());
+
+  IncompatibleQosStatus writer_status = make_status();
+  IncompatibleQosStatus reader_status = make_status();
+  EXPECT_TRUE(e.index.compatible(writer1, reader, writer_status, reader_status, e.rtps, e.rtps,
+                                 e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos));
+  EXPECT_TRUE(e.index.compatible(writer2, reader, writer_status, reader_status, e.rtps, e.rtps,
+                                 e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos));
+  EXPECT_EQ(e.index.verdict_misses(), 1u);
+  EXPECT_EQ(e.index.verdict_hits(), 1u);
+  EXPECT_EQ(writer_status.total_count, 0);
+
+  // A new QoS is picked up when the endpoint is inserted again.
+  e.reader_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  e.writer_qos.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+  e.reader(reader, "T", false, make_partition());
+  e.writer(writer1, "T", true, make_partition());
+  e.writer(writer2, "T", true, make_partition());
+  for (int i = 0; i < 2; ++i) {
+    IncompatibleQosStatus expected_writer = make_status();
+    IncompatibleQosStatus expected_reader = make_status();
+    const bool expected = compatibleQOS(&expected_writer, &expected_reader, e.rtps, e.rtps,
+                                        &e.writer_qos, &e.reader_qos, &e.pub_qos, &e.sub_qos);
+
+    writer_status = make_status();
+    reader_status = make_status();
+    EXPECT_EQ(e.index.compatible(i ? writer2 : writer1, reader, writer_status, reader_status,
+                                 e.rtps, e.rtps, e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos),
+              expected);
+    EXPECT_FALSE(expected);
+    EXPECT_EQ(writer_status.total_count, expected_writer.total_count);
+    EXPECT_EQ(reader_status.total_count, expected_reader.total_count);
+    EXPECT_EQ(writer_status.last_policy_id, DDS::RELIABILITY_QOS_POLICY_ID);
+    ASSERT_EQ(writer_status.policies.length(), expected_writer.policies.length());
+  }
+  EXPECT_EQ(e.index.verdict_misses(), 2u);
+  EXPECT_EQ(e.index.verdict_hits(), 2u);
+
+  // Transports are not cached.
+  writer_status = make_status();
+  reader_status = make_status();
+  EXPECT_FALSE(e.index.compatible(writer1, reader, writer_status, reader_status,
+                                  make_locators("tcp"), e.rtps,
+                                  e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos));
+  EXPECT_EQ(writer_status.last_policy_id, OpenDDS::TRANSPORTTYPE_QOS_POLICY_ID);
+
+  // Partitions that don't match aren't incompatible QoS.
+  e.reader_qos.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+  e.writer(writer1, "T", true, make_partition("A"));
+  e.reader(reader, "T", false, make_partition());
+  writer_status = make_status();
+  reader_status = make_status();
+  EXPECT_FALSE(e.index.compatible(writer1, reader, writer_status, reader_status, e.rtps, e.rtps,
+                                  e.writer_qos, e.reader_qos, e.pub_qos, e.sub_qos));
+  EXPECT_EQ(writer_status.total_count, 0);
+}
+
+TEST(dds_DCPS_RTPS_EndpointMatchIndex, discovered_endpoints)
+{
+  EndpointMatchIndex index;
+  const GUID_t writer = make_guid(2, 1, false);
+  const GUID_t reader = make_guid(1, 1, true);
+
+  DDS::PublicationBuiltinTopicData pub_data;
+  pub_data.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+  pub_data.durability.kind = DDS::VOLATILE_DURABILITY_QOS;
+  pub_data.liveliness = TheServiceParticipant->initial_LivelinessQosPolicy();
+  pub_data.deadline = TheServiceParticipant->initial_DeadlineQosPolicy();
+  pub_data.latency_budget = TheServiceParticipant->initial_LatencyBudgetQosPolicy();
+  pub_data.ownership = TheServiceParticipant->initial_OwnershipQosPolicy();
+  pub_data.presentation = TheServiceParticipant->initial_PresentationQosPolicy();
+  pub_data.representation.value.length(1);
+  pub_data.representation.value[0] = DDS::XCDR2_DATA_REPRESENTATION;
+  pub_data.partition = make_partition("A");
+  index.insert(writer, "T", false, pub_data, make_locators("rtps_udp"));
+
+  DDS::DataReaderQos reader_qos = TheServiceParticipant->initial_DataReaderQos();
+  reader_qos.reliability.kind = DDS::RELIABLE_RELIABILITY_QOS;
+  reader_qos.representation.value = pub_data.representation.value;
+  DDS::SubscriberQos sub_qos = TheServiceParticipant->initial_SubscriberQos();
+  sub_qos.partition = make_partition("B");
+  index.insert(reader, "T", true, reader_qos, sub_qos, make_locators("rtps_udp"));
+
+  RepoIdSet result;
+  index.candidates(reader, false, result);
+  EXPECT_TRUE(result.count(writer));
+
+  reader_qos.reliability.kind = DDS::BEST_EFFORT_RELIABILITY_QOS;
+  index.insert(reader, "T", true, reader_qos, sub_qos, make_locators("rtps_udp"));
+  result.clear();
+  index.candidates(reader, false, result);
+  EXPECT_TRUE(result.empty());
+}
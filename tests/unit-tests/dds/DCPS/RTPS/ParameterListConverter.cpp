@@ -30,6 +30,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <string>
 
 using namespace DDS;
 using namespace OpenDDS::DCPS;
@@ -3756,3 +3757,277 @@ TEST(dds_DCPS_RTPS_ParameterListConverter, dont_encode_reader_default_data)
   EXPECT_TRUE(!is_present(param_list, PID_GROUP_DATA));
   EXPECT_TRUE(!is_present(param_list, PID_CONTENT_FILTER_PROPERTY));
 }
+
+namespace {
+  void stream_param_list(const ParameterList& param_list, ACE_Message_Block& mb)
+  {
+    Serializer ser(&mb, Encoding(Encoding::KIND_XCDR1, ENDIAN_LITTLE));
+    ASSERT_TRUE(ser << param_list);
+  }
+
+  // Compares complete values by their encoding
+  template <typename T>
+  std::string encode(const T& value)
+  {
+    const Encoding encoding(Encoding::KIND_XCDR1, ENDIAN_LITTLE);
+    ACE_Message_Block mb(serialized_size(encoding, value));
+    Serializer ser(&mb, encoding);
+    EXPECT_TRUE(ser << value);
+    return std::string(mb.rd_ptr(), mb.length());
+  }
+
+  void set_octets(DDS::OctetSeq& seq, const char* value)
+  {
+    const CORBA::ULong len = static_cast<CORBA::ULong>(std::strlen(value));
+    seq.length(len);
+    std::memcpy(seq.get_buffer(), value, len);
+  }
+
+  void every_pid_locators(TransportLocatorSeq& all_locators)
+  {
+    LocatorSeq rtps_locators;
+    rtps_locators.length(2);
+    rtps_locators[0] = Factory::locator(OpenDDS::RTPS::LOCATOR_KIND_UDPv4, 1234, 127, 0, 0, 1);
+    rtps_locators[1] = Factory::locator(OpenDDS::RTPS::LOCATOR_KIND_UDPv4, 7400, 239, 255, 0, 1);
+    all_locators.length(3);
+    all_locators[0].transport_type = "rtps_udp";
+    locators_to_blob(rtps_locators, all_locators[0].data);
+    all_locators[1].transport_type = "tcp";
+    set_octets(all_locators[1].data, "127.0.0.1:4321");
+    rtps_locators.length(1);
+    rtps_locators[0] = Factory::locator(OpenDDS::RTPS::LOCATOR_KIND_UDPv4, 5678, 127, 0, 0, 2);
+    all_locators[2].transport_type = "rtps_udp";
+    locators_to_blob(rtps_locators, all_locators[2].data);
+  }
+
+  void every_pid_type_info(OpenDDS::XTypes::TypeInformation& type_info)
+  {
+    type_info.minimal.typeid_with_size.type_id = OpenDDS::XTypes::TypeIdentifier(OpenDDS::XTypes::TK_INT32);
+    type_info.minimal.typeid_with_size.typeobject_serialized_size = 0;
+    type_info.minimal.dependent_typeid_count = 0;
+    type_info.complete.typeid_with_size.type_id = OpenDDS::XTypes::TypeIdentifier(OpenDDS::XTypes::TK_INT64);
+    type_info.complete.typeid_with_size.typeobject_serialized_size = 0;
+    type_info.complete.dependent_typeid_count = 0;
+  }
+
+  void push_back_vendor_param(ParameterList& param_list)
+  {
+    Parameter vs_param;
+    DDS::OctetSeq vs_data(3);
+    vs_data.length(3);
+    vs_param.unknown_data(vs_data);
+    vs_param._d(0x8001);
+    OpenDDS::DCPS::push_back(param_list, vs_param);
+  }
+}
+
+TEST(dds_DCPS_RTPS_ParameterListConverter, stream_decode_writer_data)
+{ // Should decode serialized writer data the same as from_param_list
+  DiscoveredWriterData writer_data =
+    Factory::writer_data("TOPIC NAME TEST", "TYPE NAME TEST");
+  writer_data.writerProxy.remoteWriterGuid.guidPrefix[0] = 17;
+  writer_data.ddsPublicationData.deadline.period.sec = 5;
+  writer_data.ddsPublicationData.partition.name.length(1);
+  writer_data.ddsPublicationData.partition.name[0] = "PARTITION";
+  ParameterList param_list;
+  OpenDDS::XTypes::TypeInformation type_info;
+  type_info.minimal.typeid_with_size.typeobject_serialized_size = 0;
+  type_info.minimal.dependent_typeid_count = 0;
+  type_info.complete.dependent_typeid_count = 0;
+  EXPECT_TRUE(to_param_list(writer_data, param_list, false, type_info));
+
+  // Vendor-specific parameter that is skipped
+  Parameter vs_param;
+  DDS::OctetSeq vs_data(3);
+  vs_data.length(3);
+  vs_param.unknown_data(vs_data);
+  vs_param._d(0x8001);
+  OpenDDS::DCPS::push_back(param_list, vs_param);
+
+  ACE_Message_Block mb(1024);
+  stream_param_list(param_list, mb);
+
+  DiscoveredWriterData expected;
+  EXPECT_TRUE(from_param_list(param_list, expected, false, type_info));
+
+  DiscoveredWriterData writer_data_out;
+  Serializer ser(&mb, Encoding(Encoding::KIND_XCDR1, ENDIAN_LITTLE));
+  EXPECT_TRUE(from_param_list(ser, writer_data_out, false, type_info));
+  EXPECT_EQ(ser.length(), 0u);
+  EXPECT_STREQ(expected.ddsPublicationData.topic_name, writer_data_out.ddsPublicationData.topic_name);
+  EXPECT_STREQ(expected.ddsPublicationData.type_name, writer_data_out.ddsPublicationData.type_name);
+  EXPECT_EQ(expected.ddsPublicationData.deadline.period.sec, writer_data_out.ddsPublicationData.deadline.period.sec);
+  EXPECT_EQ(expected.ddsPublicationData.reliability.kind, writer_data_out.ddsPublicationData.reliability.kind);
+  ASSERT_EQ(writer_data_out.ddsPublicationData.partition.name.length(), 1u);
+  EXPECT_STREQ(writer_data_out.ddsPublicationData.partition.name[0], "PARTITION");
+  EXPECT_EQ(expected.writerProxy.remoteWriterGuid, writer_data_out.writerProxy.remoteWriterGuid);
+}
+
+TEST(dds_DCPS_RTPS_ParameterListConverter, stream_decode_fail_on_reader_required_parameters)
+{ // Should fail on reader required parameters
+  ParameterList param_list;
+  Parameter vs_param;
+  DDS::OctetSeq vs_data(4);
+  vs_data.length(4);
+  vs_param.unknown_data(vs_data);
+  vs_param._d(0x4001);
+  OpenDDS::DCPS::push_back(param_list, vs_param);
+
+  ACE_Message_Block mb(1024);
+  stream_param_list(param_list, mb);
+
+  DiscoveredReaderData reader_data_out;
+  OpenDDS::XTypes::TypeInformation type_info;
+  Serializer ser(&mb, Encoding(Encoding::KIND_XCDR1, ENDIAN_LITTLE));
+  EXPECT_FALSE(from_param_list(ser, reader_data_out, false, type_info));
+}
+
+TEST(dds_DCPS_RTPS_ParameterListConverter, stream_decode_writer_data_every_pid)
+{ // Should decode every writer parameter the same as from_param_list
+  DiscoveredWriterData writer_data =
+    Factory::writer_data("TOPIC NAME TEST", "TYPE NAME TEST");
+  PublicationBuiltinTopicData& pub = writer_data.ddsPublicationData;
+  pub.durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+  pub.durability_service.service_cleanup_delay.sec = 4;
+  pub.durability_service.history_kind = KEEP_ALL_HISTORY_QOS;
+  pub.durability_service.max_samples = 100;
+  pub.deadline.period.sec = 5;
+  pub.latency_budget.duration.nanosec = 2000;
+  pub.liveliness.kind = MANUAL_BY_TOPIC_LIVELINESS_QOS;
+  pub.liveliness.lease_duration.sec = 3;
+  pub.reliability.kind = RELIABLE_RELIABILITY_QOS;
+  pub.reliability.max_blocking_time.sec = 1;
+  pub.lifespan.duration.sec = 7;
+  set_octets(pub.user_data.value, "user data");
+  pub.ownership.kind = EXCLUSIVE_OWNERSHIP_QOS;
+  pub.ownership_strength.value = 12;
+  pub.destination_order.kind = BY_SOURCE_TIMESTAMP_DESTINATIONORDER_QOS;
+  pub.presentation.access_scope = GROUP_PRESENTATION_QOS;
+  pub.presentation.coherent_access = true;
+  pub.presentation.ordered_access = true;
+  pub.partition.name.length(2);
+  pub.partition.name[0] = "PARTITION";
+  pub.partition.name[1] = "OTHER*";
+  set_octets(pub.topic_data.value, "topic data");
+  set_octets(pub.group_data.value, "group data");
+  pub.representation.value.length(1);
+  pub.representation.value[0] = XCDR2_DATA_REPRESENTATION;
+  every_pid_locators(writer_data.writerProxy.allLocators);
+  OpenDDS::XTypes::TypeInformation type_info;
+  every_pid_type_info(type_info);
+
+  ParameterList param_list;
+  EXPECT_TRUE(to_param_list(writer_data, param_list, true, type_info));
+  push_back_vendor_param(param_list);
+  const ParameterId_t pids[] = {
+    PID_TOPIC_NAME, PID_TYPE_NAME, PID_XTYPES_TYPE_INFORMATION, PID_DURABILITY,
+    PID_DURABILITY_SERVICE, PID_DEADLINE, PID_LATENCY_BUDGET, PID_LIVELINESS,
+    PID_RELIABILITY, PID_LIFESPAN, PID_USER_DATA, PID_OWNERSHIP,
+#ifndef OPENDDS_NO_OWNERSHIP_KIND_EXCLUSIVE
+    PID_OWNERSHIP_STRENGTH,
+#endif
+    PID_DESTINATION_ORDER, PID_PRESENTATION, PID_PARTITION, PID_TOPIC_DATA,
+    PID_GROUP_DATA, PID_DATA_REPRESENTATION, PID_ENDPOINT_GUID,
+    PID_UNICAST_LOCATOR, PID_MULTICAST_LOCATOR, PID_OPENDDS_LOCATOR, 0x8001
+  };
+  for (size_t i = 0; i < sizeof pids / sizeof pids[0]; ++i) {
+    EXPECT_TRUE(is_present(param_list, pids[i])) << "PID " << pids[i];
+  }
+
+  ACE_Message_Block mb(4096);
+  stream_param_list(param_list, mb);
+
+  DiscoveredWriterData expected;
+  OpenDDS::XTypes::TypeInformation expected_type_info;
+  EXPECT_TRUE(from_param_list(param_list, expected, true, expected_type_info));
+  EXPECT_EQ(expected.writerProxy.allLocators.length(), 3u);
+
+  DiscoveredWriterData writer_data_out;
+  OpenDDS::XTypes::TypeInformation type_info_out;
+  Serializer ser(&mb, Encoding(Encoding::KIND_XCDR1, ENDIAN_LITTLE));
+  EXPECT_TRUE(from_param_list(ser, writer_data_out, true, type_info_out));
+  EXPECT_EQ(ser.length(), 0u);
+  EXPECT_EQ(encode(expected), encode(writer_data_out));
+  EXPECT_EQ(encode(expected_type_info), encode(type_info_out));
+  EXPECT_EQ(encode(type_info), encode(type_info_out));
+}
+
+TEST(dds_DCPS_RTPS_ParameterListConverter, stream_decode_reader_data_every_pid)
+{ // Should decode every reader parameter the same as from_param_list
+  const char* params[] = {"17", "PARAM"};
+  DiscoveredReaderData reader_data =
+    Factory::reader_data("TOPIC NAME TEST", "TYPE NAME TEST");
+  SubscriptionBuiltinTopicData& sub = reader_data.ddsSubscriptionData;
+  sub.durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+  sub.deadline.period.sec = 5;
+  sub.latency_budget.duration.nanosec = 2000;
+  sub.liveliness.kind = MANUAL_BY_PARTICIPANT_LIVELINESS_QOS;
+  sub.liveliness.lease_duration.sec = 3;
+  sub.reliability.kind = RELIABLE_RELIABILITY_QOS;
+  sub.reliability.max_blocking_time.sec = 1;
+  set_octets(sub.user_data.value, "user data");
+  sub.ownership.kind = EXCLUSIVE_OWNERSHIP_QOS;
+  sub.destination_order.kind = BY_SOURCE_TIMESTAMP_DESTINATIONORDER_QOS;
+  sub.time_based_filter.minimum_separation.sec = 1;
+  sub.presentation.access_scope = TOPIC_PRESENTATION_QOS;
+  sub.presentation.coherent_access = true;
+  sub.partition.name.length(2);
+  sub.partition.name[0] = "PARTITION";
+  sub.partition.name[1] = "OTHER*";
+  set_octets(sub.topic_data.value, "topic data");
+  set_octets(sub.group_data.value, "group data");
+  sub.representation.value.length(1);
+  sub.representation.value[0] = XCDR2_DATA_REPRESENTATION;
+  sub.type_consistency.ignore_member_names = true;
+  sub.type_consistency.force_type_validation = true;
+  reader_data.contentFilterProperty.contentFilteredTopicName = "CFT";
+  reader_data.contentFilterProperty.relatedTopicName = "TOPIC NAME TEST";
+  reader_data.contentFilterProperty.filterClassName = "DDSSQL";
+  reader_data.contentFilterProperty.filterExpression = "a = %0 AND b = %1";
+  reader_data.contentFilterProperty.expressionParameters.length(2);
+  reader_data.contentFilterProperty.expressionParameters[0] = params[0];
+  reader_data.contentFilterProperty.expressionParameters[1] = params[1];
+  every_pid_locators(reader_data.readerProxy.allLocators);
+  reader_data.readerProxy.associatedWriters.length(2);
+  reader_data.readerProxy.associatedWriters[0] = reader_data.readerProxy.remoteReaderGuid;
+  reader_data.readerProxy.associatedWriters[0].entityId = ENTITYID_SEDP_BUILTIN_PUBLICATIONS_WRITER;
+  reader_data.readerProxy.associatedWriters[1] = reader_data.readerProxy.remoteReaderGuid;
+  reader_data.readerProxy.associatedWriters[1].entityId.entityKey[2] = 42;
+  reader_data.readerProxy.associatedWriters[1].entityId.entityKind = ENTITYKIND_USER_WRITER_WITH_KEY;
+  OpenDDS::XTypes::TypeInformation type_info;
+  every_pid_type_info(type_info);
+
+  ParameterList param_list;
+  EXPECT_TRUE(to_param_list(reader_data, param_list, true, type_info));
+  push_back_vendor_param(param_list);
+  const ParameterId_t pids[] = {
+    PID_TOPIC_NAME, PID_XTYPES_TYPE_INFORMATION, PID_TYPE_NAME, PID_DURABILITY,
+    PID_DEADLINE, PID_LATENCY_BUDGET, PID_LIVELINESS, PID_RELIABILITY,
+    PID_OWNERSHIP, PID_DESTINATION_ORDER, PID_USER_DATA, PID_TIME_BASED_FILTER,
+    PID_PRESENTATION, PID_PARTITION, PID_TOPIC_DATA, PID_GROUP_DATA,
+    PID_DATA_REPRESENTATION, PID_XTYPES_TYPE_CONSISTENCY, PID_ENDPOINT_GUID,
+    PID_CONTENT_FILTER_PROPERTY, PID_UNICAST_LOCATOR, PID_MULTICAST_LOCATOR,
+    PID_OPENDDS_LOCATOR, PID_OPENDDS_ASSOCIATED_WRITER, 0x8001
+  };
+  for (size_t i = 0; i < sizeof pids / sizeof pids[0]; ++i) {
+    EXPECT_TRUE(is_present(param_list, pids[i])) << "PID " << pids[i];
+  }
+
+  ACE_Message_Block mb(4096);
+  stream_param_list(param_list, mb);
+
+  DiscoveredReaderData expected;
+  OpenDDS::XTypes::TypeInformation expected_type_info;
+  EXPECT_TRUE(from_param_list(param_list, expected, true, expected_type_info));
+  EXPECT_EQ(expected.readerProxy.allLocators.length(), 3u);
+  EXPECT_EQ(expected.readerProxy.associatedWriters.length(), 2u);
+
+  DiscoveredReaderData reader_data_out;
+  OpenDDS::XTypes::TypeInformation type_info_out;
+  Serializer ser(&mb, Encoding(Encoding::KIND_XCDR1, ENDIAN_LITTLE));
+  EXPECT_TRUE(from_param_list(ser, reader_data_out, true, type_info_out));
+  EXPECT_EQ(ser.length(), 0u);
+  EXPECT_EQ(encode(expected), encode(reader_data_out));
+  EXPECT_EQ(encode(expected_type_info), encode(type_info_out));
+  EXPECT_EQ(encode(type_info), encode(type_info_out));
+}
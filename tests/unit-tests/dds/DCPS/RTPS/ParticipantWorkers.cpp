@@ -0,0 +1,125 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <dds/DCPS/RTPS/ParticipantWorkers.h>
+
+#include <dds/DCPS/GuidUtils.h>
+
+#include <ace/Thread.h>
+#include <ace/Thread_Mutex.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace OpenDDS::DCPS;
+using OpenDDS::RTPS::ParticipantWorkers;
+
+namespace {
+  const size_t PARTICIPANTS = 8;
+  const size_t EVENTS = 200;
+
+  struct Record {
+    Record()
+    {
+      for (size_t p = 0; p < PARTICIPANTS; ++p) {
+        thread_set[p] = false;
+        mixed[p] = false;
+      }
+    }
+    ACE_Thread_Mutex mutex;
+    OPENDDS_VECTOR(size_t) order[PARTICIPANTS];
+    ACE_thread_t threads[PARTICIPANTS];
+    bool thread_set[PARTICIPANTS];
+    bool mixed[PARTICIPANTS];
+  };
+
+  class OrderEvent : public EventBase {
+  public:
+    OrderEvent(Record& record, size_t participant, size_t sequence)
+      : record_(record)
+      , participant_(participant)
+      , sequence_(sequence)
+    {}
+
+    void handle_event()
+    {
+      ACE_Guard<ACE_Thread_Mutex> guard(record_.mutex);
+      record_.order[participant_].push_back(sequence_);
+      if (!record_.thread_set[participant_]) {
+        record_.thread_set[participant_] = true;
+        record_.threads[participant_] = ACE_Thread::self();
+      } else if (!ACE_OS::thr_equal(record_.threads[participant_], ACE_Thread::self())) {
+        record_.mixed[participant_] = true;
+      }
+    }
+
+  private:
+    Record& record_;
+    const size_t participant_;
+    const size_t sequence_;
+  };
+
+  GuidPrefix_t make_prefix(size_t participant)
+  {
+    GuidPrefix_t prefix;
+    std::memset(prefix, 0, sizeof prefix);
+    prefix[0] = 0x01;
+    prefix[1] = 0x03;
+    prefix[11] = static_cast<CORBA::Octet>(participant);
+    return prefix;
+  }
+}
+
+TEST(dds_DCPS_RTPS_ParticipantWorkers, no_workers)
+{
+  ParticipantWorkers workers;
+  Record record;
+  EXPECT_EQ(workers.size(), 0u);
+  EXPECT_FALSE(workers.dispatch(make_prefix(1), make_rch<OrderEvent>(ref(record), 1, 0)));
+}
+
+TEST(dds_DCPS_RTPS_ParticipantWorkers, ordered_per_participant)
+{
+  ParticipantWorkers workers(3);
+  Record record;
+
+  // Interleave the participants like announcements arriving on one socket.
+  for (size_t e = 0; e < EVENTS; ++e) {
+    for (size_t p = 0; p < PARTICIPANTS; ++p) {
+      ASSERT_TRUE(workers.dispatch(make_prefix(p), make_rch<OrderEvent>(ref(record), p, e)));
+    }
+  }
+  workers.shutdown(false);
+
+  for (size_t p = 0; p < PARTICIPANTS; ++p) {
+    ASSERT_EQ(record.order[p].size(), EVENTS) << p;
+    for (size_t e = 0; e < EVENTS; ++e) {
+      EXPECT_EQ(record.order[p][e], e) << p;
+    }
+    // All of a participant's events ran on the same worker thread.
+    EXPECT_TRUE(record.thread_set[p]);
+    EXPECT_FALSE(record.mixed[p]) << p;
+  }
+
+  // Once shut down, nothing else is accepted.
+  EXPECT_FALSE(workers.dispatch(make_prefix(0), make_rch<OrderEvent>(ref(record), 0, EVENTS)));
+}
+
+TEST(dds_DCPS_RTPS_ParticipantWorkers, index)
+{
+  ParticipantWorkers workers(4);
+  bool used[4] = {false, false, false, false};
+  for (size_t p = 0; p < 64; ++p) {
+    const size_t i = workers.index(make_prefix(p));
+    ASSERT_LT(i, 4u);
+    EXPECT_EQ(workers.index(make_prefix(p)), i);
+    used[i] = true;
+  }
+  // Participants are spread over the workers.
+  for (size_t i = 0; i < 4; ++i) {
+    EXPECT_TRUE(used[i]) << i;
+  }
+}
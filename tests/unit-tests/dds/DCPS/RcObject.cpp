@@ -3,12 +3,23 @@
 
 #include <gtest/gtest.h>
 
+#ifdef ACE_HAS_CPP11
+#include <thread>
+#include <vector>
+#endif
+
 using namespace OpenDDS::DCPS;
 
 namespace {
   struct Counted : RcObject {
     Counted() {}
   };
+
+  struct Tracked : RcObject {
+    explicit Tracked(int& live) : live_(live) { ++live_; }
+    ~Tracked() { --live_; }
+    int& live_;
+  };
 }
 
 TEST(dds_DCPS_RcObject, ctors_weak)
@@ -80,3 +91,56 @@ TEST(dds_DCPS_RcObject, compare_weak)
   EXPECT_FALSE(w1 < w2);
   EXPECT_FALSE(w2 < w1);
 }
+
+TEST(dds_DCPS_RcObject, weak_after_strong_refs)
+{
+  int live = 0;
+  RcHandle<Tracked> h1 = make_rch<Tracked>(ref(live));
+  RcHandle<Tracked> h2 = h1;
+  h2.reset();
+  EXPECT_EQ(h1->ref_count(), 1);
+
+  WeakRcHandle<Tracked> w1(h1);
+  WeakRcHandle<Tracked> w2(*h1);
+  EXPECT_EQ(w1, w2);
+  EXPECT_EQ(w2.lock(), h1);
+  EXPECT_EQ(h1->ref_count(), 1);
+
+  h1.reset();
+  EXPECT_EQ(live, 0);
+  EXPECT_TRUE(w1.lock().is_nil());
+}
+
+#ifdef ACE_HAS_CPP11
+TEST(dds_DCPS_RcObject, concurrent_weak)
+{
+  int live = 0;
+  for (int i = 0; i < 100; ++i) {
+    RcHandle<Tracked> h = make_rch<Tracked>(ref(live));
+    std::vector<WeakRcHandle<Tracked> > weak(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < weak.size(); ++t) {
+      threads.emplace_back([&, t]() {
+        weak[t] = h;
+      });
+    }
+    for (size_t t = 0; t < threads.size(); ++t) {
+      threads[t].join();
+    }
+    for (size_t t = 1; t < weak.size(); ++t) {
+      EXPECT_EQ(weak[0], weak[t]);
+    }
+
+    // Locking races with releasing the last strong reference.
+    std::thread locker([&]() {
+      for (int j = 0; j < 100; ++j) {
+        weak[1].lock();
+      }
+    });
+    h.reset();
+    locker.join();
+    EXPECT_EQ(live, 0);
+    EXPECT_TRUE(weak[0].lock().is_nil());
+  }
+}
+#endif
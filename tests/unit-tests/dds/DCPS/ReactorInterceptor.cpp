@@ -0,0 +1,96 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtestWrapper.h>
+
+#include <dds/DCPS/ReactorInterceptor.h>
+
+#include <ace/Thread_Manager.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  class MyReactor : public ACE_Reactor {
+  public:
+    MOCK_METHOD3(notify, int(ACE_Event_Handler*, ACE_Reactor_Mask, ACE_Time_Value*));
+  };
+
+  class MyReactorInterceptor : public ReactorInterceptor {
+  public:
+    MyReactorInterceptor(ACE_Reactor* reactor, ACE_thread_t owner)
+      : ReactorInterceptor(reactor, owner)
+      , shut_down_(false)
+    {}
+
+    bool reactor_is_shut_down() const { return shut_down_; }
+    void shut_down() { shut_down_ = true; }
+
+    // What handle_exception does on the reactor thread.
+    void run_reactor() { process_command_queue(); }
+
+  private:
+    bool shut_down_;
+  };
+
+  class RecordCommand : public ReactorInterceptor::Command {
+  public:
+    RecordCommand(OPENDDS_VECTOR(int)& executed, int id)
+      : executed_(executed)
+      , id_(id)
+    {}
+
+    void execute() { executed_.push_back(id_); }
+
+  private:
+    OPENDDS_VECTOR(int)& executed_;
+    const int id_;
+  };
+}
+
+TEST(dds_DCPS_ReactorInterceptor, owner_executes_immediately)
+{
+  MyReactor reactor;
+  RcHandle<MyReactorInterceptor> interceptor =
+    make_rch<MyReactorInterceptor>(&reactor, ACE_Thread_Manager::instance()->thr_self());
+  OPENDDS_VECTOR(int) executed;
+
+  EXPECT_CALL(reactor, notify(testing::_, testing::_, testing::_)).Times(0);
+  interceptor->execute_or_enqueue(make_rch<RecordCommand>(ref(executed), 1));
+  ASSERT_EQ(executed.size(), 1u);
+  EXPECT_EQ(executed[0], 1);
+}
+
+TEST(dds_DCPS_ReactorInterceptor, other_thread_after_shut_down)
+{
+  MyReactor reactor;
+  RcHandle<MyReactorInterceptor> interceptor =
+    make_rch<MyReactorInterceptor>(&reactor, ACE_OS::NULL_thread);
+  OPENDDS_VECTOR(int) executed;
+
+  // Only the command that finds the queue empty notifies the reactor.
+  EXPECT_CALL(reactor, notify(interceptor.get(), testing::_, testing::_))
+    .Times(1)
+    .WillOnce(testing::Return(0));
+  interceptor->execute_or_enqueue(make_rch<RecordCommand>(ref(executed), 1));
+  interceptor->execute_or_enqueue(make_rch<RecordCommand>(ref(executed), 2));
+  EXPECT_TRUE(executed.empty());
+
+  // After the reactor is shut down, a caller off the reactor thread executes the queued commands
+  // before its own, without notifying.
+  interceptor->shut_down();
+  interceptor->execute_or_enqueue(make_rch<RecordCommand>(ref(executed), 3));
+  ASSERT_EQ(executed.size(), 3u);
+  EXPECT_EQ(executed[0], 1);
+  EXPECT_EQ(executed[1], 2);
+  EXPECT_EQ(executed[2], 3);
+
+  // Nothing is left for the reactor thread.
+  interceptor->run_reactor();
+  EXPECT_EQ(executed.size(), 3u);
+
+  interceptor->execute_or_enqueue(make_rch<RecordCommand>(ref(executed), 4));
+  ASSERT_EQ(executed.size(), 4u);
+  EXPECT_EQ(executed[3], 4);
+}
@@ -0,0 +1,108 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/ReceivedDataElementList.h>
+
+#include <dds/DCPS/DataReaderImpl.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  ReceivedDataElement* make_element(ACE_New_Allocator& allocator, ACE_Recursive_Thread_Mutex& mutex,
+                                    bool valid_data, int sec = 0)
+  {
+    static int data = 0;
+    DataSampleHeader header;
+    header.message_id_ = valid_data ? SAMPLE_DATA : DISPOSE_INSTANCE;
+    header.source_timestamp_sec_ = sec;
+    return new (allocator) ReceivedDataElement(header, valid_data ? &data : 0, &mutex);
+  }
+}
+
+TEST(dds_DCPS_ReceivedDataElementList, sample_counts)
+{
+  ACE_New_Allocator allocator;
+  ACE_Recursive_Thread_Mutex mutex;
+  const ReceivedSampleCounts_rch counts = make_rch<ReceivedSampleCounts>();
+  ReceivedDataElementList first(DataReaderImpl_rch(), InstanceState_rch(), counts);
+  ReceivedDataElementList second(DataReaderImpl_rch(), InstanceState_rch(), counts);
+
+  ReceivedDataElement* const a = make_element(allocator, mutex, true, 2);
+  ReceivedDataElement* const b = make_element(allocator, mutex, false, 1);
+  ReceivedDataElement* const c = make_element(allocator, mutex, true);
+  first.add(a);
+  first.add_by_timestamp(b);
+  second.add(c);
+
+  EXPECT_EQ(first.size(), 2u);
+  EXPECT_EQ(first.valid_data_size(), 1u);
+  EXPECT_EQ(second.size(), 1u);
+  EXPECT_EQ(second.valid_data_size(), 1u);
+  EXPECT_EQ(size_t(counts->total), 3u);
+  EXPECT_EQ(size_t(counts->valid_data), 2u);
+
+  ReceivedDataElement* const head = first.remove_head();
+  EXPECT_EQ(head, b);
+  head->dec_ref();
+  EXPECT_EQ(first.valid_data_size(), 1u);
+  EXPECT_EQ(size_t(counts->total), 2u);
+  EXPECT_EQ(size_t(counts->valid_data), 2u);
+
+  first.remove(a);
+  a->dec_ref();
+  second.remove_tail()->dec_ref();
+  EXPECT_EQ(first.size(), 0u);
+  EXPECT_EQ(second.valid_data_size(), 0u);
+  EXPECT_EQ(size_t(counts->total), 0u);
+  EXPECT_EQ(size_t(counts->valid_data), 0u);
+}
+
+TEST(dds_DCPS_ReceivedDataElementList, add_by_timestamp)
+{
+  ACE_New_Allocator allocator;
+  ACE_Recursive_Thread_Mutex mutex;
+  ReceivedDataElementList list(DataReaderImpl_rch());
+
+  // Two writers with interleaved clocks, including equal timestamps.
+  const int seconds[] = {10, 20, 30, 15, 25, 35, 20, 5, 40, 20};
+  const size_t count = sizeof seconds / sizeof seconds[0];
+  ReceivedDataElement* elements[count];
+  for (size_t i = 0; i < count; ++i) {
+    elements[i] = make_element(allocator, mutex, true, seconds[i]);
+    list.add_by_timestamp(elements[i]);
+  }
+  ASSERT_EQ(list.size(), count);
+
+  // Samples with the same timestamp stay in the order they were added.
+  ReceivedDataElement* const twenties[] = {elements[1], elements[6], elements[9]};
+  size_t twenty = 0;
+  const ReceivedDataElement* previous = 0;
+  for (ReceivedDataElement* it = list.get_next_match(DDS::ANY_SAMPLE_STATE, 0); it;
+       it = list.get_next_match(DDS::ANY_SAMPLE_STATE, it)) {
+    if (previous) {
+      EXPECT_FALSE(it->source_timestamp_ < previous->source_timestamp_);
+    }
+    if (it->source_timestamp_.sec == 20) {
+      EXPECT_EQ(it, twenties[twenty++]);
+    }
+    previous = it;
+  }
+  EXPECT_EQ(twenty, 3u);
+  EXPECT_EQ(previous, elements[8]);
+
+  // Removing from the middle keeps the index consistent.
+  list.remove(elements[6]);
+  elements[6]->dec_ref();
+  ReceivedDataElement* const late = make_element(allocator, mutex, true, 20);
+  list.add_by_timestamp(late);
+  EXPECT_EQ(late->previous_data_sample_, elements[9]);
+  EXPECT_EQ(late->next_data_sample_, elements[4]);
+
+  while (ReceivedDataElement* const head = list.remove_head()) {
+    head->dec_ref();
+  }
+}
@@ -0,0 +1,67 @@
+#include <dds/DCPS/SampleArena.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct Body {
+    OPENDDS_VECTOR(int) values;
+    std::string name;
+  };
+}
+
+TEST(dds_DCPS_SampleArena, empty_arena_falls_back)
+{
+  SampleArena<Body> arena(2);
+  Body sample;
+  EXPECT_FALSE(arena.reuse(sample));
+  EXPECT_EQ(arena.statistics().fallback, 1u);
+  EXPECT_EQ(arena.statistics().reused, 0u);
+}
+
+#ifdef ACE_HAS_CPP11
+TEST(dds_DCPS_SampleArena, reuse_keeps_buffers)
+{
+  SampleArena<Body> arena(2);
+  Body released;
+  released.values.assign(100, 1);
+  released.name = "a name too long for the small string buffer";
+  const int* const values = released.values.data();
+  const char* const name = released.name.data();
+  arena.recycle(released);
+  EXPECT_EQ(arena.size(), 1u);
+
+  Body sample;
+  ASSERT_TRUE(arena.reuse(sample));
+  EXPECT_EQ(sample.values.data(), values);
+  EXPECT_EQ(sample.name.data(), name);
+  EXPECT_EQ(arena.size(), 0u);
+
+  // Writing a value no larger than the released one doesn't allocate.
+  sample.values.assign(50, 2);
+  sample.name = "short";
+  EXPECT_EQ(sample.values.data(), values);
+  EXPECT_EQ(sample.name.data(), name);
+
+  const SampleArena<Body>::Statistics stats = arena.statistics();
+  EXPECT_EQ(stats.reused, 1u);
+  EXPECT_EQ(stats.fallback, 0u);
+  EXPECT_EQ(stats.retained, 1u);
+  EXPECT_EQ(stats.discarded, 0u);
+}
+
+TEST(dds_DCPS_SampleArena, capacity)
+{
+  SampleArena<Body> arena(2);
+  for (int i = 0; i < 3; ++i) {
+    Body released;
+    arena.recycle(released);
+  }
+  EXPECT_EQ(arena.size(), 2u);
+  EXPECT_EQ(arena.statistics().retained, 2u);
+  EXPECT_EQ(arena.statistics().discarded, 1u);
+}
+#endif
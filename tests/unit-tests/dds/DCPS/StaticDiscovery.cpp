@@ -0,0 +1,184 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/Serializer.h>
+#include <dds/DCPS/Service_Participant.h>
+#include <dds/DCPS/StaticDiscovery.h>
+
+#include <ace/OS_NS_unistd.h>
+
+#include <cstring>
+#include <fstream>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  const char path[] = "StaticDiscovery.table";
+  const DDS::DomainId_t domain = 34;
+
+  GUID_t make_id(unsigned char participant, unsigned char entity, unsigned char kind)
+  {
+    const unsigned char participant_id[] = { 0, 0, 0, 0, 0, participant };
+    const unsigned char entity_key[] = { 0, 0, entity };
+    return EndpointRegistry::build_id(domain, participant_id, EndpointRegistry::build_id(entity_key, kind));
+  }
+
+  TransportLocatorSeq make_trans_info()
+  {
+    TransportLocatorSeq trans_info(1);
+    trans_info.length(1);
+    trans_info[0].transport_type = "rtps_udp";
+    return trans_info;
+  }
+
+  void add_reader(EndpointRegistry& registry, const GUID_t& id, DDS::ReliabilityQosPolicyKind reliability)
+  {
+    DDS::DataReaderQos qos = DDS::DataReaderQos();
+    qos.reliability.kind = reliability;
+    registry.reader_map.insert(std::make_pair(id,
+      EndpointRegistry::Reader("Topic", qos, DDS::SubscriberQos(), "config", make_trans_info())));
+  }
+}
+
+TEST(dds_DCPS_StaticDiscovery, table_round_trip)
+{
+  const GUID_t writer_id = make_id(1, 1, ENTITYKIND_USER_WRITER_WITH_KEY);
+  const GUID_t reliable_id = make_id(2, 1, ENTITYKIND_USER_READER_WITH_KEY);
+  const GUID_t best_effort_id = make_id(2, 2, ENTITYKIND_USER_READER_WITH_KEY);
+  const GUID_t unmatched_id = make_id(3, 1, ENTITYKIND_USER_READER_WITH_KEY);
+
+  EndpointRegistry saved;
+  EndpointRegistry::Topic& topic = saved.topic_map["section"];
+  topic.name = "Topic";
+  topic.type_name = "Type";
+  add_reader(saved, reliable_id, DDS::RELIABLE_RELIABILITY_QOS);
+  add_reader(saved, best_effort_id, DDS::BEST_EFFORT_RELIABILITY_QOS);
+  add_reader(saved, unmatched_id, DDS::RELIABLE_RELIABILITY_QOS);
+  DDS::DataWriterQos writer_qos = DDS::DataWriterQos();
+  writer_qos.user_data.value.length(3);
+  writer_qos.user_data.value[2] = 1;
+  EndpointRegistry::Writer& writer = saved.writer_map.insert(std::make_pair(writer_id,
+    EndpointRegistry::Writer("Topic", writer_qos, DDS::PublisherQos(), "config", make_trans_info()))).first->second;
+  writer.reliable_readers.insert(reliable_id);
+  writer.best_effort_readers.insert(best_effort_id);
+
+  MD5Result config;
+  std::memset(config, 1, sizeof config);
+  ASSERT_TRUE(saved.save_table(path, config));
+
+  EndpointRegistry loaded;
+  ASSERT_TRUE(loaded.load_table(path, config));
+
+  ASSERT_EQ(loaded.topic_map.size(), 1u);
+  EXPECT_EQ(loaded.topic_map["section"].type_name, "Type");
+
+  ASSERT_EQ(loaded.writer_map.size(), 1u);
+  const EndpointRegistry::Writer& loaded_writer = loaded.writer_map.begin()->second;
+  EXPECT_EQ(loaded.writer_map.begin()->first, writer_id);
+  EXPECT_EQ(loaded_writer.topic_name, "Topic");
+  EXPECT_EQ(loaded_writer.trans_cfg, "config");
+  ASSERT_EQ(loaded_writer.qos.user_data.value.length(), 3u);
+  EXPECT_EQ(loaded_writer.qos.user_data.value[2], 1);
+  ASSERT_EQ(loaded_writer.trans_info.length(), 1u);
+  EXPECT_STREQ(loaded_writer.trans_info[0].transport_type, "rtps_udp");
+  EXPECT_EQ(loaded_writer.reliable_readers, writer.reliable_readers);
+  EXPECT_EQ(loaded_writer.best_effort_readers, writer.best_effort_readers);
+
+  // The readers' side of the matches is rebuilt from the writers'.
+  ASSERT_EQ(loaded.reader_map.size(), 3u);
+  EXPECT_EQ(loaded.reader_map.find(reliable_id)->second.reliable_writers.count(writer_id), 1u);
+  EXPECT_EQ(loaded.reader_map.find(best_effort_id)->second.best_effort_writers.count(writer_id), 1u);
+  EXPECT_TRUE(loaded.reader_map.find(unmatched_id)->second.reliable_writers.empty());
+
+  // A table made from another configuration is not used.
+  MD5Result other;
+  std::memset(other, 2, sizeof other);
+  EXPECT_FALSE(loaded.load_table(path, other));
+  EXPECT_TRUE(loaded.topic_map.empty());
+  EXPECT_TRUE(loaded.writer_map.empty());
+  EXPECT_TRUE(loaded.reader_map.empty());
+
+  ACE_OS::unlink(path);
+  EXPECT_FALSE(loaded.load_table(path, config));
+}
+
+TEST(dds_DCPS_StaticDiscovery, table_other_byte_order)
+{
+  // Write a table the way a machine with the other byte order would.
+  MD5Result config;
+  std::memset(config, 1, sizeof config);
+  const ACE_CDR::ULong magic = EndpointRegistry::TABLE_MAGIC;
+  const ACE_CDR::ULong version = EndpointRegistry::TABLE_VERSION;
+  ACE_Message_Block buffer(1024);
+  Serializer ser(&buffer, Encoding(Encoding::KIND_XCDR2, ENDIAN_NONNATIVE));
+  ASSERT_TRUE(ser << ACE_OutputCDR::from_octet(static_cast<ACE_CDR::Octet>(ENDIAN_NONNATIVE)));
+  ASSERT_TRUE(ser << magic);
+  ASSERT_TRUE(ser << version);
+  ASSERT_TRUE(ser.write_octet_array(config, sizeof config));
+  ASSERT_TRUE(ser << ACE_CDR::ULong(1));
+  ASSERT_TRUE(ser << String("section"));
+  ASSERT_TRUE(ser << String("Topic"));
+  ASSERT_TRUE(ser << String("Type"));
+  ASSERT_TRUE(ser << ACE_CDR::ULong(0));
+  ASSERT_TRUE(ser << ACE_CDR::ULong(0));
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    ASSERT_TRUE(file.write(buffer.rd_ptr(), buffer.length()));
+  }
+
+  EndpointRegistry loaded;
+  ASSERT_TRUE(loaded.load_table(path, config));
+  ASSERT_EQ(loaded.topic_map.size(), 1u);
+  EXPECT_EQ(loaded.topic_map["section"].name, "Topic");
+  EXPECT_EQ(loaded.topic_map["section"].type_name, "Type");
+
+  ACE_OS::unlink(path);
+}
+
+TEST(dds_DCPS_StaticDiscovery, load_configuration)
+{
+  const RcHandle<ConfigStoreImpl> config_store = TheServiceParticipant->config_store();
+  config_store->set_string("TOPIC_ParsedTopic", "@ParsedTopic");
+  config_store->set_string("TOPIC_ParsedTopic_TYPE_NAME", "ParsedType");
+  config_store->set_string(COMMON_DCPS_STATIC_DISCOVERY_TABLE, path);
+
+  MD5Result digest;
+  make_rch<StaticDiscovery>("StaticDiscoveryTest")->config_digest(digest);
+
+  EndpointRegistry table;
+  table.topic_map["TableTopic"].name = "TableTopic";
+  table.topic_map["TableTopic"].type_name = "TableType";
+
+  // A table made from another configuration is ignored and the configuration
+  // is parsed instead.
+  MD5Result stale;
+  std::memset(stale, 1, sizeof stale);
+  ASSERT_TRUE(table.save_table(path, stale));
+  const RcHandle<StaticDiscovery> parsed = make_rch<StaticDiscovery>("StaticDiscoveryTest");
+  ASSERT_EQ(parsed->load_configuration(), 0);
+  ASSERT_EQ(parsed->registry.topic_map.size(), 1u);
+  EXPECT_EQ(parsed->registry.topic_map["ParsedTopic"].type_name, "ParsedType");
+
+  // A table made from this configuration is used without parsing it.
+  ASSERT_TRUE(table.save_table(path, digest));
+  const RcHandle<StaticDiscovery> loaded = make_rch<StaticDiscovery>("StaticDiscoveryTest");
+  ASSERT_EQ(loaded->load_configuration(), 0);
+  ASSERT_EQ(loaded->registry.topic_map.size(), 1u);
+  EXPECT_EQ(loaded->registry.topic_map["TableTopic"].type_name, "TableType");
+
+  // The default address changes the locators, so it's part of the digest.
+  config_store->set_string(COMMON_DCPS_DEFAULT_ADDRESS, "127.0.0.1");
+  MD5Result other;
+  loaded->config_digest(other);
+  EXPECT_NE(std::memcmp(digest, other, sizeof digest), 0);
+
+  config_store->unset(COMMON_DCPS_DEFAULT_ADDRESS);
+  config_store->unset(COMMON_DCPS_STATIC_DISCOVERY_TABLE);
+  config_store->unset("TOPIC_ParsedTopic_TYPE_NAME");
+  config_store->unset("TOPIC_ParsedTopic");
+  ACE_OS::unlink(path);
+}
@@ -0,0 +1,123 @@
+#ifndef OPENDDS_SAFETY_PROFILE
+#  include <dds/DCPS/XTypes/MemberIdMap.h>
+
+#  include <gtest/gtest.h>
+
+using OpenDDS::XTypes::MemberIdMap;
+
+TEST(dds_DCPS_XTypes_MemberIdMap, insert_find_erase)
+{
+  MemberIdMap<int> map;
+  map.reserve(4);
+  EXPECT_TRUE(map.insert(std::make_pair(2u, 20)).second);
+  EXPECT_TRUE(map.insert(std::make_pair(5u, 50)).second);
+  EXPECT_TRUE(map.insert(std::make_pair(1u, 10)).second);
+  EXPECT_FALSE(map.insert(std::make_pair(2u, 21)).second);
+  ASSERT_EQ(map.size(), 3u);
+
+  // Sorted by id, and inserting doesn't replace.
+  MemberIdMap<int>::const_iterator it = map.begin();
+  EXPECT_EQ(it->first, 1u);
+  EXPECT_EQ((++it)->second, 20);
+  EXPECT_EQ(map.rbegin()->first, 5u);
+
+  EXPECT_TRUE(map.find(3) == map.end());
+  ASSERT_TRUE(map.find(5) != map.end());
+  EXPECT_EQ(map.find(5)->second, 50);
+
+  EXPECT_EQ(map.erase(3), 0u);
+  EXPECT_EQ(map.erase(2), 1u);
+  EXPECT_TRUE(map.find(2) == map.end());
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(map.capacity(), 4u);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(dds_DCPS_XTypes_MemberIdMap, set)
+{
+  MemberIdMap<int> map;
+  map.set(3, 30);
+  map.set(1, 10);
+  map.set(3, 31);
+  map.set(7, 70);
+  ASSERT_EQ(map.size(), 3u);
+  EXPECT_EQ(map.begin()->first, 1u);
+  EXPECT_EQ(map.find(3)->second, 31);
+  EXPECT_EQ(map.rbegin()->second, 70);
+}
+
+TEST(dds_DCPS_XTypes_MemberIdMap, erase_keeps_slot)
+{
+  MemberIdMap<int> map;
+  map.set(1, 10);
+  map.set(2, 20);
+  map.set(3, 30);
+  map.set(4, 40);
+  const int* const three = &map.find(3)->second;
+
+  // Erasing doesn't move the other values.
+  EXPECT_EQ(map.erase(2), 1u);
+  EXPECT_EQ(map.erase(2), 0u);
+  EXPECT_EQ(map.erase(4), 1u);
+  EXPECT_EQ(&map.find(3)->second, three);
+  ASSERT_EQ(map.size(), 2u);
+  EXPECT_TRUE(map.find(2) == map.end());
+
+  // Iterating skips the erased values in both directions.
+  MemberIdMap<int>::const_iterator it = map.begin();
+  EXPECT_EQ(it->first, 1u);
+  EXPECT_EQ((++it)->first, 3u);
+  EXPECT_TRUE(++it == map.end());
+  EXPECT_EQ(map.rbegin()->first, 3u);
+  EXPECT_EQ(std::distance(map.rbegin(), map.rend()), 2);
+
+  // Setting an erased id reuses its slot.
+  EXPECT_TRUE(map.insert(std::make_pair(2u, 21)).second);
+  EXPECT_EQ(&map.find(3)->second, three);
+  EXPECT_EQ(map.find(2)->second, 21);
+  EXPECT_EQ(map.size(), 3u);
+
+  map.erase(1);
+  map.erase(2);
+  map.erase(3);
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  EXPECT_TRUE(map.rbegin() == map.rend());
+}
+
+TEST(dds_DCPS_XTypes_MemberIdMap, layout)
+{
+  OPENDDS_VECTOR(OpenDDS::XTypes::MemberId) ids;
+  ids.push_back(9);
+  ids.push_back(4);
+  ids.push_back(7);
+
+  MemberIdMap<int> map;
+  map.layout(ids);
+  EXPECT_TRUE(map.laid_out());
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.find(4) == map.end());
+
+  // Members set in any order land in their own slots.
+  map.set(9, 90);
+  const int* const nine = &map.find(9)->second;
+  map.set(4, 40);
+  map.set(7, 70);
+  EXPECT_EQ(&map.find(9)->second, nine);
+  EXPECT_EQ(map.capacity(), 3u);
+  EXPECT_EQ(map.begin()->first, 4u);
+  EXPECT_EQ(map.rbegin()->first, 9u);
+
+  // Clearing keeps the layout.
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.laid_out());
+  map.set(7, 71);
+  EXPECT_EQ(map.size(), 1u);
+  EXPECT_EQ(map.capacity(), 3u);
+  EXPECT_EQ(map.begin()->second, 71);
+}
+
+#endif // OPENDDS_SAFETY_PROFILE
@@ -0,0 +1,56 @@
+#include <dds/OpenDDSConfigWrapper.h>
+
+#if OPENDDS_CONFIG_SECURITY
+
+#include <dds/DCPS/security/AccessControl/NameMatcher.h>
+#include <dds/DCPS/security/AccessControlBuiltInImpl.h>
+
+#include <gtest/gtest.h>
+
+using namespace OpenDDS::Security;
+
+TEST(dds_DCPS_security_AccessControl_NameMatcher, find_first)
+{
+  NameMatcher matcher;
+  EXPECT_EQ(matcher.find_first("Square"), NameMatcher::npos);
+
+  matcher.add("Circle");
+  matcher.add("S*");
+  matcher.add("Square");
+  matcher.add("Tri[ae]ngle");
+  matcher.add("Circle");
+  EXPECT_EQ(matcher.size(), 5u);
+
+  EXPECT_EQ(matcher.find_first("Circle"), 0u);
+  // The pattern comes before the exact name.
+  EXPECT_EQ(matcher.find_first("Square"), 1u);
+  EXPECT_EQ(matcher.find_first("Sq"), 1u);
+  EXPECT_EQ(matcher.find_first("Triangle"), 3u);
+  EXPECT_EQ(matcher.find_first("Triengle"), 3u);
+  EXPECT_EQ(matcher.find_first("Trangle"), NameMatcher::npos);
+  EXPECT_FALSE(matcher.matches(""));
+}
+
+TEST(dds_DCPS_security_AccessControl_NameMatcher, same_as_pattern_match)
+{
+  const char* const expressions[] = {
+    "", "*", "?", "a*b", "a\\*", "\\?b", "[ab]*", "[!a]?", "*a*a*"
+  };
+  const char* const names[] = {
+    "", "a", "b", "ab", "a*", "?b", "aab", "ba", "bab", "aa"
+  };
+  const size_t n_expressions = sizeof expressions / sizeof expressions[0];
+  const size_t n_names = sizeof names / sizeof names[0];
+
+  for (size_t e = 0; e < n_expressions; ++e) {
+    NameMatcher matcher;
+    matcher.add(expressions[e]);
+    for (size_t n = 0; n < n_names; ++n) {
+      EXPECT_EQ(matcher.matches(names[n]),
+                AccessControlBuiltInImpl::pattern_match(names[n], expressions[e]))
+        << "expression \"" << expressions[e] << "\" name \"" << names[n] << '"';
+    }
+  }
+}
+
+#endif
@@ -662,6 +662,9 @@ TEST_F(dds_DCPS_security_AuthenticationBuiltInImpl, BeginHandshakeRequest_BeginH
                              ex);
 
   ASSERT_EQ(r, DDS::Security::VALIDATION_OK);
+
+  // Each side verified the other's certificate once.
+  EXPECT_EQ(2u, auth.validated_certificates());
 }
 
 TEST_F(dds_DCPS_security_AuthenticationBuiltInImpl, SeparateAuthImpls_BeginHandshakeRequest_BeginHandshakeReply_ProcessHandshake_Success)
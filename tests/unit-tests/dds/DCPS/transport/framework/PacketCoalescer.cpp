@@ -0,0 +1,92 @@
+#include <dds/DCPS/transport/framework/PacketCoalescer.h>
+
+#include <gtest/gtest.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  const TimeDuration window = TimeDuration::from_msec(10);
+  const size_t bytes = 1000;
+}
+
+TEST(dds_DCPS_transport_framework_PacketCoalescer, flush_on_window)
+{
+  const RcHandle<CoalesceStatistics> stats = make_rch<CoalesceStatistics>();
+  PacketCoalescer uut(window, bytes, stats);
+  const MonotonicTimePoint start = MonotonicTimePoint::now();
+
+  TimeDuration remaining;
+  ASSERT_TRUE(uut.hold(start, 100, 1, remaining));
+  EXPECT_TRUE(uut.holding());
+  EXPECT_EQ(remaining, window);
+
+  // Later writes keep the packet for the rest of the original window.
+  ASSERT_TRUE(uut.hold(start + TimeDuration::from_msec(4), 200, 2, remaining));
+  EXPECT_EQ(remaining, TimeDuration::from_msec(6));
+
+  // The window ran out.
+  EXPECT_FALSE(uut.hold(start + window, 300, 3, remaining));
+  EXPECT_FALSE(uut.holding());
+
+  CoalesceCount count;
+  stats->take(count);
+  EXPECT_EQ(count.packets, 1u);
+  EXPECT_EQ(count.samples, 3u);
+  EXPECT_EQ(count.window_flushes, 1u);
+  EXPECT_EQ(count.size_flushes, 0u);
+  EXPECT_EQ(count.delay_usec, 10000u);
+
+  // Taking the counts resets them.
+  stats->take(count);
+  EXPECT_EQ(count.packets, 0u);
+  EXPECT_EQ(count.delay_usec, 0u);
+}
+
+TEST(dds_DCPS_transport_framework_PacketCoalescer, flush_on_bytes)
+{
+  const RcHandle<CoalesceStatistics> stats = make_rch<CoalesceStatistics>();
+  PacketCoalescer uut(window, bytes, stats);
+  const MonotonicTimePoint start = MonotonicTimePoint::now();
+
+  TimeDuration remaining;
+  ASSERT_TRUE(uut.hold(start, 600, 1, remaining));
+  EXPECT_FALSE(uut.full(900));
+  EXPECT_TRUE(uut.full(bytes));
+
+  // The send strategy sends a full packet as soon as a write fills it.
+  uut.release(start + TimeDuration::from_msec(2), 2, false);
+  EXPECT_FALSE(uut.holding());
+  EXPECT_FALSE(uut.full(bytes));
+
+  // A packet that is already full when the writer stops isn't held.
+  EXPECT_FALSE(uut.hold(start, bytes, 5, remaining));
+
+  CoalesceCount count;
+  stats->take(count);
+  EXPECT_EQ(count.packets, 1u);
+  EXPECT_EQ(count.samples, 2u);
+  EXPECT_EQ(count.window_flushes, 0u);
+  EXPECT_EQ(count.size_flushes, 1u);
+  EXPECT_EQ(count.delay_usec, 2000u);
+}
+
+TEST(dds_DCPS_transport_framework_PacketCoalescer, reset)
+{
+  const RcHandle<CoalesceStatistics> stats = make_rch<CoalesceStatistics>();
+  PacketCoalescer uut(window, bytes, stats);
+  const MonotonicTimePoint start = MonotonicTimePoint::now();
+
+  TimeDuration remaining;
+  ASSERT_TRUE(uut.hold(start, 100, 1, remaining));
+  uut.reset();
+  EXPECT_FALSE(uut.holding());
+
+  // Releasing when nothing is held, or an empty packet, counts nothing.
+  uut.release(start, 1, true);
+  ASSERT_TRUE(uut.hold(start, 100, 1, remaining));
+  uut.release(start, 0, true);
+
+  CoalesceCount count;
+  stats->take(count);
+  EXPECT_EQ(count.packets, 0u);
+}
@@ -1,5 +1,7 @@
 #include <dds/DCPS/transport/framework/TransportInst.h>
 
+#include <dds/DCPS/Service_Participant.h>
+
 #include <gtest/gtest.h>
 
 using namespace OpenDDS::DCPS;
@@ -92,3 +94,69 @@ TEST(dds_DCPS_transport_framework_ConfigValueRef, assign_read)
   const String c_string = mtt.my_string2_;
   EXPECT_EQ(c_string, a_string);
 }
+
+namespace {
+  class TestTransportInst : public TransportInst {
+  public:
+    explicit TestTransportInst(const OPENDDS_STRING& name)
+      : TransportInst("test", name)
+    {}
+
+    bool is_reliable() const { return true; }
+
+    size_t populate_locator(TransportLocator&, ConnectionInfoFlags, DDS::DomainId_t) const
+    {
+      return 0;
+    }
+
+  private:
+    TransportImpl_rch new_impl(DDS::DomainId_t)
+    {
+      return TransportImpl_rch();
+    }
+  };
+
+  struct TestTransport {
+    RcHandle<ConfigStoreImpl> store;
+    RcHandle<TestTransportInst> inst;
+
+    TestTransport()
+      : store(make_rch<ConfigStoreImpl>(TheServiceParticipant->config_topic()))
+      , inst(make_rch<TestTransportInst>("TRANSPORT_INST_UNIT_TEST"))
+    {
+      store->unset_section(inst->config_prefix());
+    }
+
+    ~TestTransport()
+    {
+      store->unset_section(inst->config_prefix());
+    }
+  };
+}
+
+TEST(dds_DCPS_transport_framework_TransportInst, coalesce_window)
+{
+  TestTransport t;
+  EXPECT_EQ(t.inst->coalesce_window(), 0u);
+
+  t.inst->coalesce_window(500);
+  EXPECT_EQ(t.inst->coalesce_window(), 500u);
+
+  // Configuration files set the same key.
+  t.store->set_uint32(t.inst->config_key("COALESCE_WINDOW").c_str(), 2000);
+  EXPECT_EQ(t.inst->coalesce_window(), 2000u);
+  EXPECT_NE(t.inst->dump_to_str(0).find("coalesce_window"), String::npos);
+}
+
+TEST(dds_DCPS_transport_framework_TransportInst, coalesce_bytes)
+{
+  TestTransport t;
+  EXPECT_EQ(t.inst->coalesce_bytes(), 0u);
+
+  t.inst->coalesce_bytes(1024);
+  EXPECT_EQ(t.inst->coalesce_bytes(), 1024u);
+
+  t.store->set_uint32(t.inst->config_key("COALESCE_BYTES").c_str(), 4096);
+  EXPECT_EQ(t.inst->coalesce_bytes(), 4096u);
+  EXPECT_NE(t.inst->dump_to_str(0).find("coalesce_bytes"), String::npos);
+}
@@ -0,0 +1,133 @@
+#include <dds/DCPS/transport/framework/TransportQueueElementPool.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#ifdef ACE_HAS_CPP11
+#include <thread>
+#include <vector>
+#endif
+
+using namespace OpenDDS::DCPS;
+
+TEST(dds_DCPS_transport_framework_TransportQueueElementPool, reuse)
+{
+  TransportQueueElementPool uut("reuse", 64);
+
+  void* const a = uut.allocate(64);
+  ASSERT_TRUE(a);
+  uut.deallocate(a, 64);
+  EXPECT_EQ(uut.allocate(64), a);
+  EXPECT_EQ(uut.allocations(), 1u);
+  EXPECT_EQ(uut.reuses(), 1u);
+  uut.deallocate(a, 64);
+}
+
+TEST(dds_DCPS_transport_framework_TransportQueueElementPool, max_free)
+{
+  TransportQueueElementPool uut("max_free", 64, 1);
+
+  void* elements[4];
+  for (size_t i = 0; i < 4; ++i) {
+    elements[i] = uut.allocate(64);
+  }
+  for (size_t i = 0; i < 4; ++i) {
+    uut.deallocate(elements[i], 64);
+  }
+
+  // At most one element per list is kept for reuse.
+  for (size_t i = 0; i < 4; ++i) {
+    elements[i] = uut.allocate(64);
+  }
+  EXPECT_GE(uut.reuses(), 1u);
+  EXPECT_LE(uut.reuses(), 2u);
+  EXPECT_EQ(uut.allocations() + uut.reuses(), 8u);
+  for (size_t i = 0; i < 4; ++i) {
+    uut.deallocate(elements[i], 64);
+  }
+}
+
+TEST(dds_DCPS_transport_framework_TransportQueueElementPool, other_sizes)
+{
+  TransportQueueElementPool uut("other_sizes", 64);
+
+  void* const a = uut.allocate(64);
+  uut.deallocate(a, 64);
+
+  // Derived classes are bigger and never get a pooled element.
+  void* const b = uut.allocate(128);
+  EXPECT_NE(b, a);
+  uut.deallocate(b, 128);
+  EXPECT_EQ(uut.allocate(64), a);
+  uut.deallocate(a, 64);
+}
+
+TEST(dds_DCPS_transport_framework_TransportQueueElementPool, append_counts)
+{
+  TransportQueueElementPool uut("append_counts", 64);
+  uut.deallocate(uut.allocate(64), 64);
+
+  QueueElementCountSequence seq;
+  TransportQueueElementPool::append_counts(seq);
+  bool found = false;
+  for (CORBA::ULong i = 0; i < seq.length(); ++i) {
+    if (std::strcmp(seq[i].element, "append_counts") == 0) {
+      found = true;
+      EXPECT_EQ(seq[i].allocations, 1u);
+      EXPECT_EQ(seq[i].reuses, 0u);
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+#ifdef ACE_HAS_CPP11
+TEST(dds_DCPS_transport_framework_TransportQueueElementPool, release_on_other_thread)
+{
+  const size_t count = 1000;
+  TransportQueueElementPool uut("release_on_other_thread", 64);
+
+  std::vector<void*> elements(count);
+  for (size_t i = 0; i < count; ++i) {
+    elements[i] = uut.allocate(64);
+  }
+
+  // Elements released by another thread come back through the shared list,
+  // except for those still on that thread's own list when it exits.
+  std::thread releaser([&]() {
+    for (size_t i = 0; i < count; ++i) {
+      uut.deallocate(elements[i], 64);
+    }
+  });
+  releaser.join();
+
+  for (size_t i = 0; i < count; ++i) {
+    elements[i] = uut.allocate(64);
+  }
+  EXPECT_GE(uut.reuses(), count - 64);
+  EXPECT_EQ(uut.allocations() + uut.reuses(), 2 * count);
+  for (size_t i = 0; i < count; ++i) {
+    uut.deallocate(elements[i], 64);
+  }
+}
+
+TEST(dds_DCPS_transport_framework_TransportQueueElementPool, counts_of_exited_thread)
+{
+  TransportQueueElementPool uut("counts_of_exited_thread", 64);
+
+  std::thread worker([&]() {
+    uut.deallocate(uut.allocate(64), 64);
+    uut.deallocate(uut.allocate(64), 64);
+    EXPECT_EQ(uut.allocations(), 1u);
+    EXPECT_EQ(uut.reuses(), 1u);
+  });
+  worker.join();
+
+  // The worker's counts are kept when it exits.
+  EXPECT_EQ(uut.allocations(), 1u);
+  EXPECT_EQ(uut.reuses(), 1u);
+  uut.deallocate(uut.allocate(64), 64);
+  EXPECT_EQ(uut.allocations(), 2u);
+  EXPECT_EQ(uut.reuses(), 1u);
+}
+#endif
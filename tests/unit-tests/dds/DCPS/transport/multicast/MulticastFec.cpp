@@ -0,0 +1,249 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+#ifndef OPENDDS_SAFETY_PROFILE
+
+#include <gtest/gtest.h>
+
+#include <dds/DCPS/transport/multicast/MulticastFec.h>
+
+#include <dds/DCPS/DataSampleHeader.h>
+#include <dds/DCPS/transport/framework/TransportHeader.h>
+
+#include <cstring>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  typedef OPENDDS_VECTOR(char) Datagram;
+
+  const Encoding encoding(Encoding::KIND_UNALIGNED_CDR);
+
+  Datagram make_datagram(ACE_INT64 seq, size_t payload_size,
+                         char message_id = SAMPLE_DATA, char submessage_id = SUBMESSAGE_NONE)
+  {
+    TransportHeader header;
+    header.length_ = static_cast<ACE_UINT32>(payload_size);
+    header.sequence_ = seq;
+    header.source_ = 1;
+    ACE_Message_Block mb(TRANSPORT_HDR_SERIALIZED_SZ);
+    mb << header;
+
+    Datagram datagram(mb.rd_ptr(), mb.wr_ptr());
+    datagram.push_back(message_id);
+    datagram.push_back(submessage_id);
+    for (size_t i = 2; i < payload_size; ++i) {
+      datagram.push_back(static_cast<char>(seq * 31 + i));
+    }
+    return datagram;
+  }
+
+  bool add(MulticastFecEncoder& encoder, const Datagram& datagram)
+  {
+    // Split across two iovecs like a header and body would be.
+    iovec iov[2];
+    iov[0].iov_base = const_cast<char*>(&datagram[0]);
+    iov[0].iov_len = TRANSPORT_HDR_SERIALIZED_SZ;
+    iov[1].iov_base = const_cast<char*>(&datagram[TRANSPORT_HDR_SERIALIZED_SZ]);
+    iov[1].iov_len = datagram.size() - TRANSPORT_HDR_SERIALIZED_SZ;
+    return encoder.add(iov, 2);
+  }
+
+  void record(MulticastFecDecoder& decoder, DisjointSequence& received,
+              ACE_INT64 seq, const Datagram& datagram)
+  {
+    decoder.record(seq, &datagram[0], datagram.size());
+    received.insert(SequenceNumber(seq));
+  }
+
+  MulticastFecDecoder::Result decode(MulticastFecDecoder& decoder,
+                                     const MulticastFecWindow& window, size_t group,
+                                     const DisjointSequence& received,
+                                     SequenceNumber& seq, Message_Block_Ptr& datagram)
+  {
+    Message_Block_Ptr payload;
+    EXPECT_TRUE(window.parity(group, payload));
+    Serializer serializer(payload.get(), encoding);
+    return decoder.decode(serializer, received, seq, datagram);
+  }
+
+  bool equal(const Message_Block_Ptr& block, const Datagram& datagram)
+  {
+    return block->length() == datagram.size()
+      && std::memcmp(block->rd_ptr(), &datagram[0], datagram.size()) == 0;
+  }
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, recover_one_loss)
+{
+  MulticastFecEncoder encoder(4, 1);
+  Datagram datagrams[5];
+  for (ACE_INT64 seq = 1; seq <= 4; ++seq) {
+    // Different sizes so the parity covers the longest.
+    datagrams[seq] = make_datagram(seq, 10 * seq);
+    EXPECT_TRUE(add(encoder, datagrams[seq]));
+  }
+  EXPECT_TRUE(encoder.window_complete());
+  MulticastFecWindow window;
+  encoder.take_window(window);
+  EXPECT_EQ(encoder.pending(), 0u);
+
+  MulticastFecDecoder decoder(16);
+  DisjointSequence received;
+  record(decoder, received, 1, datagrams[1]);
+  record(decoder, received, 2, datagrams[2]);
+  record(decoder, received, 4, datagrams[4]);
+
+  SequenceNumber seq;
+  Message_Block_Ptr rebuilt;
+  ASSERT_EQ(decode(decoder, window, 0, received, seq, rebuilt), MulticastFecDecoder::FEC_RECOVERED);
+  EXPECT_EQ(seq, SequenceNumber(3));
+  EXPECT_TRUE(equal(rebuilt, datagrams[3]));
+  EXPECT_EQ(decoder.high(), SequenceNumber(4));
+
+  // Once everything has arrived there is nothing to rebuild.
+  record(decoder, received, 3, datagrams[3]);
+  EXPECT_EQ(decode(decoder, window, 0, received, seq, rebuilt), MulticastFecDecoder::FEC_COMPLETE);
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, two_losses_in_group)
+{
+  MulticastFecEncoder encoder(4, 1);
+  Datagram datagrams[5];
+  for (ACE_INT64 seq = 1; seq <= 4; ++seq) {
+    datagrams[seq] = make_datagram(seq, 16);
+    add(encoder, datagrams[seq]);
+  }
+  MulticastFecWindow window;
+  encoder.take_window(window);
+
+  MulticastFecDecoder decoder(16);
+  DisjointSequence received;
+  record(decoder, received, 1, datagrams[1]);
+  record(decoder, received, 4, datagrams[4]);
+
+  SequenceNumber seq;
+  Message_Block_Ptr rebuilt;
+  EXPECT_EQ(decode(decoder, window, 0, received, seq, rebuilt), MulticastFecDecoder::FEC_UNRECOVERABLE);
+  EXPECT_FALSE(rebuilt.get());
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, interleaved_burst)
+{
+  // With two groups a burst of two consecutive losses is one loss per group.
+  MulticastFecEncoder encoder(6, 2);
+  Datagram datagrams[7];
+  for (ACE_INT64 seq = 1; seq <= 6; ++seq) {
+    datagrams[seq] = make_datagram(seq, 20);
+    add(encoder, datagrams[seq]);
+  }
+  MulticastFecWindow window;
+  encoder.take_window(window);
+  ASSERT_EQ(window.groups.size(), 2u);
+
+  MulticastFecDecoder decoder(16);
+  DisjointSequence received;
+  record(decoder, received, 1, datagrams[1]);
+  record(decoder, received, 2, datagrams[2]);
+  record(decoder, received, 5, datagrams[5]);
+  record(decoder, received, 6, datagrams[6]);
+
+  for (size_t group = 0; group < 2; ++group) {
+    SequenceNumber seq;
+    Message_Block_Ptr rebuilt;
+    ASSERT_EQ(decode(decoder, window, group, received, seq, rebuilt), MulticastFecDecoder::FEC_RECOVERED);
+    EXPECT_EQ(seq, SequenceNumber(ACE_INT64(3 + group)));
+    EXPECT_TRUE(equal(rebuilt, datagrams[3 + group]));
+  }
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, reordered)
+{
+  MulticastFecEncoder encoder(4, 1);
+  Datagram datagrams[5];
+  for (ACE_INT64 seq = 1; seq <= 4; ++seq) {
+    datagrams[seq] = make_datagram(seq, 12);
+    add(encoder, datagrams[seq]);
+  }
+  MulticastFecWindow window;
+  encoder.take_window(window);
+
+  // Datagrams arrive out of order, some after the parity.
+  MulticastFecDecoder decoder(16);
+  DisjointSequence received;
+  record(decoder, received, 4, datagrams[4]);
+  record(decoder, received, 1, datagrams[1]);
+
+  SequenceNumber seq;
+  Message_Block_Ptr rebuilt;
+  EXPECT_EQ(decode(decoder, window, 0, received, seq, rebuilt), MulticastFecDecoder::FEC_UNRECOVERABLE);
+
+  record(decoder, received, 3, datagrams[3]);
+  ASSERT_EQ(decode(decoder, window, 0, received, seq, rebuilt), MulticastFecDecoder::FEC_RECOVERED);
+  EXPECT_EQ(seq, SequenceNumber(2));
+  EXPECT_TRUE(equal(rebuilt, datagrams[2]));
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, encoder_skips)
+{
+  MulticastFecEncoder encoder(4, 1);
+  EXPECT_TRUE(add(encoder, make_datagram(2, 8)));
+
+  // Resends and parity are not covered by parity.
+  EXPECT_FALSE(add(encoder, make_datagram(1, 8)));
+  EXPECT_FALSE(add(encoder, make_datagram(2, 8)));
+  EXPECT_FALSE(add(encoder, make_datagram(3, 8, TRANSPORT_CONTROL, MULTICAST_FEC)));
+  EXPECT_EQ(encoder.pending(), 1u);
+
+  MulticastFecWindow window;
+  encoder.take_window(window);
+  Message_Block_Ptr payload;
+  EXPECT_TRUE(window.parity(0, payload));
+  EXPECT_FALSE(window.parity(1, payload));
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, statistics)
+{
+  // Each link's counts are added to the transport's TransportStatistics.
+  MulticastFecStatistics link1;
+  ++link1.parity_sent;
+  ++link1.parity_received;
+  link1.recovered += 2;
+  ++link1.unrecoverable;
+  link1.naked += 3;
+  MulticastFecStatistics link2;
+  ++link2.recovered;
+  ++link2.naked;
+
+  MulticastFecCount count = {0, 0, 0, 0, 0};
+  link1.take(count);
+  link2.take(count);
+  EXPECT_EQ(count.parity_sent, 1u);
+  EXPECT_EQ(count.parity_received, 1u);
+  EXPECT_EQ(count.recovered, 3u);
+  EXPECT_EQ(count.unrecoverable, 1u);
+  EXPECT_EQ(count.naked, 4u);
+
+  // Taking the counts resets them.
+  MulticastFecCount again = {0, 0, 0, 0, 0};
+  link1.take(again);
+  EXPECT_EQ(again.recovered, 0u);
+  EXPECT_EQ(again.naked, 0u);
+  EXPECT_EQ(link1.recovered.load(), 0u);
+}
+
+TEST(dds_DCPS_transport_multicast_MulticastFec, invalid_payload)
+{
+  MulticastFecDecoder decoder(16);
+  DisjointSequence received;
+  Message_Block_Ptr payload(new ACE_Message_Block(2));
+  payload->wr_ptr(2);
+  Serializer serializer(payload.get(), encoding);
+  SequenceNumber seq;
+  Message_Block_Ptr rebuilt;
+  EXPECT_EQ(decoder.decode(serializer, received, seq, rebuilt), MulticastFecDecoder::FEC_INVALID);
+}
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef OPENDDS_SAFETY_PROFILE
+
+#include <dds/DCPS/transport/shmem/ShmemInst.h>
+
+#include <dds/DCPS/Service_Participant.h>
+
+#include <gtest/gtest.h>
+
+using namespace OpenDDS::DCPS;
+
+namespace {
+  struct ShmemType {
+    RcHandle<ConfigStoreImpl> store;
+    RcHandle<ShmemInst> shmem;
+
+    ShmemType()
+    : store(make_rch<ConfigStoreImpl>(TheServiceParticipant->config_topic()))
+    , shmem(make_rch<ShmemInst>("SHMEM_INST_UNIT_TEST"))
+    {
+      store->unset_section(shmem->config_prefix());
+    }
+
+    ~ShmemType()
+    {
+      store->unset_section(shmem->config_prefix());
+    }
+  };
+}
+
+TEST(dds_DCPS_transport_shmem_ShmemInst, pool_defaults)
+{
+  ShmemType t;
+  EXPECT_FALSE(t.shmem->pool_huge_pages());
+  EXPECT_FALSE(t.shmem->pool_transparent_huge_pages());
+  EXPECT_FALSE(t.shmem->pool_prefault());
+  EXPECT_EQ(t.shmem->pool_numa_node(), -1);
+  EXPECT_EQ(t.shmem->pool_placement(), "none");
+}
+
+TEST(dds_DCPS_transport_shmem_ShmemInst, pool_setters)
+{
+  ShmemType t;
+  t.shmem->pool_huge_pages(true);
+  t.shmem->pool_transparent_huge_pages(true);
+  t.shmem->pool_prefault(true);
+  t.shmem->pool_numa_node(1);
+  EXPECT_TRUE(t.shmem->pool_huge_pages());
+  EXPECT_TRUE(t.shmem->pool_transparent_huge_pages());
+  EXPECT_TRUE(t.shmem->pool_prefault());
+  EXPECT_EQ(t.shmem->pool_numa_node(), 1);
+
+  EXPECT_TRUE(t.store->get_boolean(t.shmem->config_key("POOL_HUGE_PAGES").c_str(), false));
+  EXPECT_TRUE(t.store->get_boolean(t.shmem->config_key("POOL_TRANSPARENT_HUGE_PAGES").c_str(), false));
+  EXPECT_TRUE(t.store->get_boolean(t.shmem->config_key("POOL_PREFAULT").c_str(), false));
+  EXPECT_EQ(t.store->get_int32(t.shmem->config_key("POOL_NUMA_NODE").c_str(), -1), 1);
+}
+
+TEST(dds_DCPS_transport_shmem_ShmemInst, pool_config)
+{
+  ShmemType t;
+  // As if read from a [transport/SHMEM_INST_UNIT_TEST] section.
+  t.store->set_string(t.shmem->config_key("POOL_HUGE_PAGES").c_str(), "1");
+  t.store->set_string(t.shmem->config_key("POOL_TRANSPARENT_HUGE_PAGES").c_str(), "true");
+  t.store->set_string(t.shmem->config_key("POOL_PREFAULT").c_str(), "1");
+  t.store->set_string(t.shmem->config_key("POOL_NUMA_NODE").c_str(), "3");
+  EXPECT_TRUE(t.shmem->pool_huge_pages());
+  EXPECT_TRUE(t.shmem->pool_transparent_huge_pages());
+  EXPECT_TRUE(t.shmem->pool_prefault());
+  EXPECT_EQ(t.shmem->pool_numa_node(), 3);
+
+  const String dump = t.shmem->dump_to_str(0);
+  EXPECT_NE(dump.find("pool_huge_pages"), String::npos);
+  EXPECT_NE(dump.find("pool_numa_node"), String::npos);
+  EXPECT_NE(dump.find("pool_placement"), String::npos);
+}
+
+TEST(dds_DCPS_transport_shmem_ShmemInst, pool_placement)
+{
+  ShmemType t;
+  t.shmem->pool_placement("huge pages, NUMA node 0, prefaulted");
+  EXPECT_EQ(t.shmem->pool_placement(), "huge pages, NUMA node 0, prefaulted");
+  // The placement is what the transport did, not configuration.
+  EXPECT_FALSE(t.store->has(t.shmem->config_key("POOL_PLACEMENT").c_str()));
+}
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef OPENDDS_SAFETY_PROFILE
+
+#include <dds/DCPS/transport/shmem/ShmemTransport.h>
+#include <dds/DCPS/transport/shmem/ShmemInst.h>
+
+#include <dds/DCPS/Service_Participant.h>
+
+#include <ace/OS_NS_unistd.h>
+
+#include <gtest/gtest.h>
+
+using namespace OpenDDS::DCPS;
+
+class DDS_TEST {
+public:
+  static String place_pool(char* base, const ShmemInst& config, bool huge_pages)
+  {
+    return ShmemTransport::place_pool(base, config, huge_pages);
+  }
+};
+
+namespace {
+  struct ShmemType {
+    RcHandle<ConfigStoreImpl> store;
+    RcHandle<ShmemInst> shmem;
+
+    ShmemType()
+    : store(make_rch<ConfigStoreImpl>(TheServiceParticipant->config_topic()))
+    , shmem(make_rch<ShmemInst>("SHMEM_TRANSPORT_UNIT_TEST"))
+    {
+      store->unset_section(shmem->config_prefix());
+    }
+
+    ~ShmemType()
+    {
+      store->unset_section(shmem->config_prefix());
+    }
+  };
+}
+
+TEST(dds_DCPS_transport_shmem_ShmemTransport, place_pool_without_options)
+{
+  ShmemType t;
+  char pool[16] = {0};
+  t.shmem->pool_size(sizeof pool);
+  EXPECT_EQ(DDS_TEST::place_pool(pool, *t.shmem, false), "normal pages");
+  EXPECT_EQ(DDS_TEST::place_pool(pool, *t.shmem, true), "huge pages");
+}
+
+TEST(dds_DCPS_transport_shmem_ShmemTransport, place_pool_without_pool)
+{
+  ShmemType t;
+  t.shmem->pool_size(4 * ACE_OS::getpagesize());
+  t.shmem->pool_transparent_huge_pages(true);
+  t.shmem->pool_numa_node(0);
+  t.shmem->pool_prefault(true);
+  // Nothing is advised, bound, or written without a pool.
+  EXPECT_EQ(DDS_TEST::place_pool(0, *t.shmem, false), "none");
+}
+
+#ifdef OPENDDS_SHMEM_UNIX
+TEST(dds_DCPS_transport_shmem_ShmemTransport, place_pool_prefault)
+{
+  ShmemType t;
+  const size_t size = 4 * ACE_OS::getpagesize();
+  OPENDDS_VECTOR(char) pool(size);
+  for (size_t i = 0; i < size; ++i) {
+    pool[i] = static_cast<char>(i);
+  }
+  t.shmem->pool_size(size);
+  t.shmem->pool_prefault(true);
+
+  EXPECT_EQ(DDS_TEST::place_pool(&pool[0], *t.shmem, false), "normal pages, prefaulted");
+
+  // Prefaulting doesn't change the contents of the pool.
+  for (size_t i = 0; i < size; ++i) {
+    if (pool[i] != static_cast<char>(i)) {
+      ADD_FAILURE() << "pool changed at " << i;
+      break;
+    }
+  }
+}
+#endif
+
+#endif
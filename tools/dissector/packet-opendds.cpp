@@ -169,6 +169,7 @@ const value_string sample_sub_id_vals[] = {
   { OpenDDS::DCPS::MULTICAST_SYNACK,       "MULTICAST_SYNACK"      },
   { OpenDDS::DCPS::MULTICAST_NAK,          "MULTICAST_NAK"         },
   { OpenDDS::DCPS::MULTICAST_NAKACK,       "MULTICAST_NAKACK"      },
+  { OpenDDS::DCPS::MULTICAST_FEC,          "MULTICAST_FEC"         },
   { 0,                                     NULL                    }
 };
 
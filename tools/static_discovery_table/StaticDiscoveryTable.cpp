@@ -0,0 +1,60 @@
+/*
+ * Distributed under the OpenDDS License.
+ * See: http://www.opendds.org/license.html
+ */
+
+// Compiles the static discovery sections of a configuration into a match
+// table that StaticDiscovery loads instead of parsing the sections and
+// matching every reader with every writer.
+
+#include <dds/DCPS/Service_Participant.h>
+#include <dds/DCPS/StaticDiscovery.h>
+#if defined ACE_AS_STATIC_LIBS && !defined OPENDDS_SAFETY_PROFILE
+#  include <dds/DCPS/transport/rtps_udp/RtpsUdp.h>
+#endif
+
+#include <ace/Arg_Shifter.h>
+#include <ace/Log_Msg.h>
+
+using namespace OpenDDS::DCPS;
+
+int ACE_TMAIN(int argc, ACE_TCHAR* argv[])
+{
+  // Loads the configuration, including the -DCPSConfigFile, the same way an
+  // application would.
+  DDS::DomainParticipantFactory_var dpf = TheParticipantFactoryWithArgs(argc, argv);
+
+  String output;
+  ACE_Arg_Shifter args(argc, argv);
+  while (args.is_anything_left()) {
+    const ACE_TCHAR* arg = 0;
+    if ((arg = args.get_the_parameter(ACE_TEXT("-o")))) {
+      output = ACE_TEXT_ALWAYS_CHAR(arg);
+      args.consume_arg();
+    } else {
+      args.ignore_arg();
+    }
+  }
+
+  if (!dpf || output.empty()) {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: usage: %s -DCPSConfigFile <file> -o <table>\n", argv[0]));
+    return 1;
+  }
+
+  const StaticDiscovery_rch discovery = StaticDiscovery::instance();
+  MD5Result digest;
+  discovery->config_digest(digest);
+
+  int status = 0;
+  if (discovery->registry.save_table(output, digest)) {
+    ACE_DEBUG((LM_INFO, "(%P|%t) wrote %B writers and %B readers to %C\n",
+               discovery->registry.writer_map.size(), discovery->registry.reader_map.size(),
+               output.c_str()));
+  } else {
+    ACE_ERROR((LM_ERROR, "(%P|%t) ERROR: could not write %C\n", output.c_str()));
+    status = 1;
+  }
+
+  TheServiceParticipant->shutdown();
+  return status;
+}